@@ -22,6 +22,7 @@
 #include "Game/Lara/lara_tests.h"
 #include "Game/animation.h"
 #include "Game/camera.h"
+#include "Game/collision/BroadPhase.h"
 #include "Game/collision/collide_item.h"
 #include "Game/collision/floordata.h"
 #include "Game/control/flipeffect.h"
@@ -46,6 +47,7 @@
 #include "Specific/Input/Input.h"
 #include "Specific/winmain.h"
 
+using namespace TEN::Collision::BroadPhase;
 using namespace TEN::Collision::Floordata;
 using namespace TEN::Control::Volumes;
 using namespace TEN::Effects::Hair;
@@ -666,5 +668,6 @@ bool UpdateLaraRoom(ItemInfo* item, int height, int xOffset, int zOffset)
 		return true;
 	}
 
+	g_BroadPhase.UpdateItem(item->Index);
 	return false;
 }
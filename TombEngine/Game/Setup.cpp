@@ -29,6 +29,7 @@
 #include "Specific/level.h"
 
 using namespace TEN::Effects::Hair;
+using namespace TEN::Effects::ParticlePool;
 using namespace TEN::Entities;
 using namespace TEN::Entities::Switches;
 
@@ -140,13 +141,7 @@ void InitializeSpecialEffects()
 	memset(&Blood, 0, MAX_SPARKS_BLOOD * sizeof(BLOOD_STRUCT));
 	memset(&Splashes, 0, MAX_SPLASHES * sizeof(SPLASH_STRUCT));
 	memset(&ShockWaves, 0, MAX_SHOCKWAVE * sizeof(SHOCKWAVE_STRUCT));
-	memset(&Particles, 0, MAX_PARTICLES * sizeof(Particle));
-
-	for (int i = 0; i < MAX_PARTICLES; i++)
-	{
-		Particles[i].on = false;
-		Particles[i].dynamic = -1;
-	}
+	g_ParticlePool.Initialize(MAX_PARTICLES);
 
 	NextFireSpark = 1;
 	NextSmokeSpark = 0;
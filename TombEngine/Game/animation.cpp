@@ -1,6 +1,10 @@
 #include "framework.h"
 #include "Game/animation.h"
 
+#include <chrono>
+#include <iomanip>
+#include <sstream>
+
 #include "Game/camera.h"
 #include "Game/collision/collide_room.h"
 #include "Game/control/box.h"
@@ -537,6 +541,107 @@ const AnimFrame& GetBestFrame(const ItemInfo& item)
 	return ((frameData.Alpha <= 0.5f) ? *frameData.FramePtr0 : *frameData.FramePtr1);
 }
 
+const PackedQuaternion* GetFrameBoneOrientations(const AnimFrame& frame)
+{
+	return (g_Level.FrameOrientations.data() + frame.BoneOrientationIndex);
+}
+
+Quaternion GetFrameBoneOrientation(const AnimFrame& frame, int boneID)
+{
+	if (boneID < 0 || boneID >= frame.BoneCount)
+		return Quaternion::Identity;
+
+	return g_Level.FrameOrientations[frame.BoneOrientationIndex + boneID].ToQuaternion();
+}
+
+// Measures keyframe memory and orientation sampling cost on loaded level's animation frames, comparing packed
+// storage with original per-frame unquantized quaternions kept by level loader, and reports quantization error.
+std::string RunFrameSamplingBenchmark()
+{
+	constexpr auto SAMPLE_COUNT = 100000;
+
+	if (g_Level.Frames.size() < 2 || g_Level.SourceFrameOrientations.size() != g_Level.Frames.size())
+		return std::string();
+
+	size_t unpackedSize = 0;
+	for (const auto& orients : g_Level.SourceFrameOrientations)
+		unpackedSize += sizeof(std::vector<Quaternion>) + (orients.size() * sizeof(Quaternion));
+
+	// Interpolate between consecutive frames, as animated items do.
+	auto frameIndices = std::vector<int>(SAMPLE_COUNT);
+	auto alphas = std::vector<float>(SAMPLE_COUNT);
+	for (int i = 0; i < SAMPLE_COUNT; i++)
+	{
+		frameIndices[i] = Random::GenerateInt(0, (int)g_Level.Frames.size() - 2);
+		alphas[i] = Random::GenerateFloat();
+	}
+
+	// Sample buffers are sized up front, so timed loops don't reallocate.
+	size_t sampleCount = 0;
+	for (int frameIndex : frameIndices)
+		sampleCount += std::min(g_Level.Frames[frameIndex].BoneCount, g_Level.Frames[frameIndex + 1].BoneCount);
+
+	int boneCount = 0;
+	auto packedSamples = std::vector<Quaternion>{};
+	packedSamples.reserve(sampleCount);
+
+	auto startTime = std::chrono::high_resolution_clock::now();
+	for (int i = 0; i < SAMPLE_COUNT; i++)
+	{
+		const auto& frame0 = g_Level.Frames[frameIndices[i]];
+		const auto& frame1 = g_Level.Frames[frameIndices[i] + 1];
+		const auto* orients0 = GetFrameBoneOrientations(frame0);
+		const auto* orients1 = GetFrameBoneOrientations(frame1);
+
+		int count = std::min(frame0.BoneCount, frame1.BoneCount);
+		for (int boneID = 0; boneID < count; boneID++)
+			packedSamples.push_back(Quaternion::Slerp(orients0[boneID].ToQuaternion(), orients1[boneID].ToQuaternion(), alphas[i]));
+
+		boneCount += count;
+	}
+
+	auto packedEndTime = std::chrono::high_resolution_clock::now();
+
+	auto sourceSamples = std::vector<Quaternion>{};
+	sourceSamples.reserve(packedSamples.size());
+	for (int i = 0; i < SAMPLE_COUNT; i++)
+	{
+		const auto& orients0 = g_Level.SourceFrameOrientations[frameIndices[i]];
+		const auto& orients1 = g_Level.SourceFrameOrientations[frameIndices[i] + 1];
+
+		int count = (int)std::min(orients0.size(), orients1.size());
+		for (int boneID = 0; boneID < count; boneID++)
+			sourceSamples.push_back(Quaternion::Slerp(orients0[boneID], orients1[boneID], alphas[i]));
+	}
+
+	auto sourceEndTime = std::chrono::high_resolution_clock::now();
+
+	// Angular distance between sampled packed and source orientations.
+	float maxSampleError = 0.0f;
+	for (size_t i = 0; i < std::min(packedSamples.size(), sourceSamples.size()); i++)
+	{
+		float dot = std::abs(packedSamples[i].Dot(sourceSamples[i]));
+		maxSampleError = std::max(maxSampleError, 2.0f * std::acos(std::min(dot, 1.0f)));
+	}
+
+	double packedTime = std::chrono::duration<double, std::milli>(packedEndTime - startTime).count();
+	double sourceTime = std::chrono::duration<double, std::milli>(sourceEndTime - packedEndTime).count();
+	boneCount = std::max(boneCount, 1);
+
+	auto stream = std::ostringstream();
+	stream << std::fixed << std::setprecision(3);
+	stream << "Animation frames: " << g_Level.Frames.size() << ", samples: " << SAMPLE_COUNT << ", bones sampled: " << boneCount << std::endl;
+	stream << "Keyframe orientations (KB): " << ((g_Level.FrameOrientations.size() * sizeof(PackedQuaternion)) / 1024.0) << " packed, " <<
+		(unpackedSize / 1024.0) << " per-frame unpacked" << std::endl;
+	stream << "Packed sampling (ms): " << packedTime << " (" << ((packedTime * 1000000.0) / boneCount) << " ns/bone)" << std::endl;
+	stream << "Per-frame unpacked sampling (ms): " << sourceTime << " (" << ((sourceTime * 1000000.0) / boneCount) << " ns/bone)" << std::endl;
+	stream << std::setprecision(4);
+	stream << "Max quantization error (deg): " << RAD_TO_DEG(g_Level.FrameOrientationError) << " keyframes, " <<
+		RAD_TO_DEG(maxSampleError) << " interpolated samples" << std::endl;
+
+	return stream.str();
+}
+
 float GetEffectiveGravity(float verticalVel)
 {
 	return ((verticalVel >= VERTICAL_VELOCITY_GRAVITY_THRESHOLD) ? 1.0f : GRAVITY);
@@ -29,9 +29,10 @@ enum class AnimCommandType
 
 struct AnimFrame
 {
-	GameBoundingBox			BoundingBox		 = GameBoundingBox::Zero;
-	Vector3					Offset			 = Vector3::Zero;
-	std::vector<Quaternion> BoneOrientations = {};
+	GameBoundingBox BoundingBox			 = GameBoundingBox::Zero;
+	Vector3			Offset				 = Vector3::Zero;
+	int				BoneOrientationIndex = 0; // g_Level.FrameOrientations base index.
+	int				BoneCount			 = 0;
 };
 
 struct StateDispatchData
@@ -125,6 +126,10 @@ const AnimFrame*	GetFirstFrame(GAME_OBJECT_ID objectID, int animNumber);
 const AnimFrame*	GetLastFrame(GAME_OBJECT_ID objectID, int animNumber);
 const AnimFrame&	GetBestFrame(const ItemInfo& item);
 
+const PackedQuaternion* GetFrameBoneOrientations(const AnimFrame& frame);
+Quaternion				GetFrameBoneOrientation(const AnimFrame& frame, int boneID);
+std::string				RunFrameSamplingBenchmark();
+
 float GetEffectiveGravity(float verticalVel);
 
 int GetAnimNumber(const ItemInfo& item);
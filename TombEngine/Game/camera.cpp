@@ -1,7 +1,12 @@
 #include "framework.h"
 #include "Game/camera.h"
 
+#include <chrono>
+#include <iomanip>
+#include <sstream>
+
 #include "Game/animation.h"
+#include "Game/collision/BroadPhase.h"
 #include "Game/collision/collide_room.h"
 #include "Game/control/los.h"
 #include "Game/effects/debris.h"
@@ -18,15 +23,20 @@
 #include "Math/Math.h"
 #include "Objects/Generic/Object/burning_torch.h"
 #include "Sound/sound.h"
+#include "Specific/Benchmark.h"
 #include "Specific/Input/Input.h"
 #include "Specific/level.h"
+#include "Specific/memory/LinearArena.h"
 
 using TEN::Renderer::g_Renderer;
 
+using namespace TEN::Benchmark;
+using namespace TEN::Collision::BroadPhase;
 using namespace TEN::Effects::Environment;
 using namespace TEN::Entities::Generic;
 using namespace TEN::Input;
 using namespace TEN::Math;
+using namespace TEN::Memory;
 
 constexpr auto PARTICLE_FADE_THRESHOLD = BLOCK(14);
 constexpr auto COLL_CHECK_THRESHOLD    = BLOCK(4);
@@ -1321,7 +1331,7 @@ float GetParticleDistanceFade(const Vector3i& pos)
 	return std::clamp(1.0f - ((dist - PARTICLE_FADE_THRESHOLD) / COLL_CHECK_THRESHOLD), 0.0f, 1.0f);
 }
 
-void ItemPushCamera(GameBoundingBox* bounds, Pose* pos, short radius)
+static void PushCameraOutOfBounds(const GameBoundingBox* bounds, const Pose* pos, short radius)
 {
 	int dx = Camera.pos.x - pos->Position.x;
 	int dz = Camera.pos.z - pos->Position.z;
@@ -1358,12 +1368,21 @@ void ItemPushCamera(GameBoundingBox* bounds, Pose* pos, short radius)
 
 	Camera.pos.x = pos->Position.x + ((x * cosY) + (z * sinY));
 	Camera.pos.z = pos->Position.z + ((z * cosY) - (x * sinY));
+}
 
+static void RestoreCameraIfOutsideRoom()
+{
 	auto pointColl = GetCollision(Camera.pos.x, Camera.pos.y, Camera.pos.z, Camera.pos.RoomNumber);
 	if (pointColl.Position.Floor == NO_HEIGHT || Camera.pos.y > pointColl.Position.Floor || Camera.pos.y < pointColl.Position.Ceiling)
 		Camera.pos = GameVector(CamOldPos, pointColl.RoomNumber);
 }
 
+void ItemPushCamera(GameBoundingBox* bounds, Pose* pos, short radius)
+{
+	PushCameraOutOfBounds(bounds, pos, radius);
+	RestoreCameraIfOutsideRoom();
+}
+
 bool CheckItemCollideCamera(ItemInfo* item)
 {
 	bool isCloseEnough = Vector3i::Distance(item->Pose.Position, Camera.pos.ToVector3i()) <= COLL_CHECK_THRESHOLD;
@@ -1388,30 +1407,6 @@ bool CheckItemCollideCamera(ItemInfo* item)
 	return true;
 }
 
-static std::vector<int> FillCollideableItemList()
-{
-	auto itemList = std::vector<int>{};
-	auto& roomList = g_Level.Rooms[Camera.pos.RoomNumber].neighbors;
-
-	for (short i = 0; i < g_Level.NumItems; i++)
-	{
-		const auto& item = g_Level.Items[i];
-
-		if (std::find(roomList.begin(), roomList.end(), item.RoomNumber) == roomList.end())
-			continue;
-
-		if (!g_Level.Rooms[item.RoomNumber].Active())
-			continue;
-
-		if (!CheckItemCollideCamera(&g_Level.Items[i]))
-			continue;
-
-		itemList.push_back(i);
-	}
-
-	return itemList;
-}
-
 bool CheckStaticCollideCamera(MESH_INFO* mesh)
 {
 	bool isCloseEnough = Vector3i::Distance(mesh->pos.Position, Camera.pos.ToVector3i()) <= COLL_CHECK_THRESHOLD;
@@ -1438,82 +1433,306 @@ bool CheckStaticCollideCamera(MESH_INFO* mesh)
 	return true;
 }
 
-std::vector<MESH_INFO*> FillCollideableStaticsList()
+struct CameraCollider
 {
-	std::vector<MESH_INFO*> staticList;
-	auto& roomList = g_Level.Rooms[Camera.pos.RoomNumber].neighbors;
+	GameBoundingBox Bounds = {};
+	Pose			Pose   = {};
+};
+
+static LinearArena CameraCollisionArena = {};
+
+// Gathers items and statics near camera in rooms neighboring camera room.
+static void GetCameraColliders(ArenaVector<CameraCollider>& colliders)
+{
+	auto itemNumbers = ArenaVector<int>(LinearArenaAllocator<int>(CameraCollisionArena));
+	auto staticPtrs = ArenaVector<MESH_INFO*>(LinearArenaAllocator<MESH_INFO*>(CameraCollisionArena));
 
-	for (int i : roomList)
+	const auto& neighborRoomNumbers = g_Level.Rooms[Camera.pos.RoomNumber].neighbors;
+	auto cameraPos = Camera.pos.ToVector3i();
+	int scanCount = 0;
+
+	if (g_BroadPhase.IsEnabled())
 	{
-		auto* room = &g_Level.Rooms[i];
+		for (int roomNumber : neighborRoomNumbers)
+		{
+			if (!g_Level.Rooms[roomNumber].Active())
+				continue;
 
-		if (!room->Active())
-			continue;
+			g_BroadPhase.GetItems(roomNumber, cameraPos, COLL_CHECK_THRESHOLD, itemNumbers);
+		}
 
-		for (short j = 0; j < room->mesh.size(); j++)
+		scanCount += (int)itemNumbers.size();
+	}
+	else
+	{
+		// Legacy scan of all level items, kept to compare cost with -legacycollision.
+		for (int i = 0; i < g_Level.NumItems; i++)
 		{
-			if (!CheckStaticCollideCamera(&room->mesh[j]))
+			const auto& item = g_Level.Items[i];
+
+			if (std::find(neighborRoomNumbers.begin(), neighborRoomNumbers.end(), item.RoomNumber) == neighborRoomNumbers.end())
+				continue;
+
+			if (!g_Level.Rooms[item.RoomNumber].Active())
 				continue;
 
-			staticList.push_back(&room->mesh[j]);
+			itemNumbers.push_back(i);
 		}
+
+		scanCount += g_Level.NumItems;
+	}
+
+	for (int roomNumber : neighborRoomNumbers)
+	{
+		if (!g_Level.Rooms[roomNumber].Active())
+			continue;
+
+		g_BroadPhase.GetStatics(roomNumber, cameraPos, COLL_CHECK_THRESHOLD, staticPtrs);
 	}
 
-	return staticList;
+	scanCount += (int)staticPtrs.size();
+
+	// Break off if camera is stuck behind object and player runs off.
+	for (int itemNumber : itemNumbers)
+	{
+		auto& item = g_Level.Items[itemNumber];
+
+		if (!CheckItemCollideCamera(&item))
+			continue;
+
+		if (Vector3i::Distance(item.Pose.Position, LaraItem->Pose.Position) > COLL_CANCEL_THRESHOLD)
+			continue;
+
+		colliders.push_back(CameraCollider{ GameBoundingBox(&item), item.Pose });
+	}
+
+	for (auto* staticPtr : staticPtrs)
+	{
+		if (!CheckStaticCollideCamera(staticPtr))
+			continue;
+
+		if (Vector3i::Distance(staticPtr->pos.Position, LaraItem->Pose.Position) > COLL_CANCEL_THRESHOLD)
+			continue;
+
+		colliders.push_back(CameraCollider{ GetBoundsAccurate(*staticPtr, false), staticPtr->pos });
+	}
+
+	if (g_Benchmark.Profiler.IsEnabled())
+	{
+		g_Benchmark.Profiler.AddCount(ProfileCounter::CameraCandidates, colliders.size());
+		g_Benchmark.Profiler.AddCount(ProfileCounter::CameraScanned, scanCount);
+	}
 }
 
-void ItemsCollideCamera()
+// Returns distance camera can travel from start position toward end position before passing through any collider.
+static float GetCameraSweepDistance(const Vector3& startPos, const Vector3& endPos, const ArenaVector<CameraCollider>& colliders)
 {
-	constexpr auto RADIUS = CLICK(0.5f);
+	auto sweep = endPos - startPos;
+	float sweepDist = sweep.Length();
+	if (sweepDist <= 0.0f)
+		return 0.0f;
 
-	auto itemList = FillCollideableItemList();
+	auto sweepDir = sweep / sweepDist;
+	float closestDist = sweepDist;
 
-	// Collide with items in the items list.
-	for (int i = 0; i < itemList.size(); i++)
+	for (const auto& collider : colliders)
 	{
-		auto* item = &g_Level.Items[itemList[i]];
-		if (!item)
-			return;
+		auto box = collider.Bounds.ToBoundingOrientedBox(collider.Pose);
+		box.Extents = Vector3(box.Extents) + Vector3(CAMERA_RADIUS);
 
-		// Break off if camera is stuck behind an object and the player runs off.
-		auto distance = Vector3i::Distance(item->Pose.Position, LaraItem->Pose.Position);
-		if (distance > COLL_CANCEL_THRESHOLD)
+		// Only passing through box is swept. Overlaps at either end are left to push.
+		if (box.Contains(startPos) != DISJOINT || box.Contains(endPos) != DISJOINT)
 			continue;
 
-		auto bounds = GameBoundingBox(item);
-		if (TestBoundsCollideCamera(bounds, item->Pose, CAMERA_RADIUS))
-			ItemPushCamera(&bounds, &item->Pose, RADIUS);
+		float dist = 0.0f;
+		if (box.Intersects(startPos, sweepDir, dist) && dist < closestDist)
+			closestDist = dist;
+	}
+
+	return closestDist;
+}
+
+// Resolves camera against all colliders in one pass. Camera movement since previous frame is swept first, so that
+// fast camera can't tunnel through box it would pass completely; remaining overlaps are then pushed out.
+// Room bounds are probed once at the end instead of after every push.
+static void ResolveCameraCollisions(const ArenaVector<CameraCollider>& colliders)
+{
+	constexpr auto PUSH_RADIUS	  = CLICK(0.5f);
+	constexpr auto SWEEP_BACKOFF  = 4.0f;
+	constexpr auto SWEEP_DIST_MAX = COLL_CHECK_THRESHOLD; // Colliders are only gathered within this distance.
+
+	auto startPos = CamOldPos.ToVector3();
+	auto endPos = Camera.pos.ToVector3();
+	float sweepDist = Vector3::Distance(startPos, endPos);
+
+	// Camera cut teleports camera, so there is no path to sweep.
+	bool isCut = (Camera.type != Camera.oldType || sweepDist > SWEEP_DIST_MAX);
+	if (!isCut && sweepDist > 0.0f)
+	{
+		float closestDist = GetCameraSweepDistance(startPos, endPos, colliders);
+		if (closestDist < sweepDist)
+		{
+			auto sweepDir = (endPos - startPos) / sweepDist;
+			auto pos = startPos + (sweepDir * std::max(closestDist - SWEEP_BACKOFF, 0.0f));
+			Camera.pos.x = (int)round(pos.x);
+			Camera.pos.y = (int)round(pos.y);
+			Camera.pos.z = (int)round(pos.z);
+		}
+	}
+
+	bool isPushed = false;
+	for (const auto& collider : colliders)
+	{
+		if (TestBoundsCollideCamera(collider.Bounds, collider.Pose, CAMERA_RADIUS))
+		{
+			PushCameraOutOfBounds(&collider.Bounds, &collider.Pose, PUSH_RADIUS);
+			isPushed = true;
+		}
 
-		TEN::Renderer::g_Renderer.AddDebugBox(
-			bounds.ToBoundingOrientedBox(item->Pose),
+		g_Renderer.AddDebugBox(
+			collider.Bounds.ToBoundingOrientedBox(collider.Pose),
 			Vector4(1.0f, 0.0f, 0.0f, 1.0f), RendererDebugPage::CollisionStats);
 	}
 
-	// Done.
-	itemList.clear();
+	if (isPushed || Camera.pos.ToVector3() != endPos)
+		RestoreCameraIfOutsideRoom();
+}
+
+void ItemsCollideCamera()
+{
+	auto profile = ScopedProfile(ProfileSection::CameraCollision);
 
-	// Collide with static meshes.
-	auto staticList = FillCollideableStaticsList();
-	for (auto* mesh : staticList)
+	// Colliders live in arena, so steady-state frames make no allocations.
 	{
-		if (!mesh)
-			return;
+		auto colliders = ArenaVector<CameraCollider>(LinearArenaAllocator<CameraCollider>(CameraCollisionArena));
+		GetCameraColliders(colliders);
+		ResolveCameraCollisions(colliders);
+	}
 
-		auto distance = Vector3i::Distance(mesh->pos.Position, LaraItem->Pose.Position);
-		if (distance > COLL_CANCEL_THRESHOLD)
-			continue;
+	CameraCollisionArena.Reset();
+}
+
+std::string RunCameraBenchmark()
+{
+	constexpr auto ROOM_SIZE	   = 48; // In blocks.
+	constexpr auto ITEM_COUNT	   = 2048;
+	constexpr auto QUERY_COUNT	   = 10000;
+	constexpr auto CAMERA_STEP_MAX = CLICK(2);
 
-		auto bounds = GetBoundsAccurate(*mesh, false);
-		if (TestBoundsCollideCamera(bounds, mesh->pos, CAMERA_RADIUS))
-			ItemPushCamera(&bounds, &mesh->pos, RADIUS);
+	static const auto ITEM_BOUNDS = GameBoundingBox(-CLICK(1), CLICK(1), -CLICK(2), 0, -CLICK(1), CLICK(1));
 
-		TEN::Renderer::g_Renderer.AddDebugBox(
-			bounds.ToBoundingOrientedBox(mesh->pos),
-			Vector4(1.0f, 0.0f, 0.0f, 1.0f), RendererDebugPage::CollisionStats);
+	// Synthetic level: one large room filled with items. Real level rooms and items are swapped out and restored afterwards.
+	auto levelRooms = std::vector<ROOM_INFO>{};
+	auto levelItems = std::vector<ItemInfo>{};
+	int levelItemCount = g_Level.NumItems;
+	std::swap(levelRooms, g_Level.Rooms);
+	std::swap(levelItems, g_Level.Items);
+
+	auto room = ROOM_INFO{};
+	room.xSize = ROOM_SIZE;
+	room.zSize = ROOM_SIZE;
+	room.flipNumber = NO_VALUE;
+	room.flippedRoom = NO_VALUE;
+	room.itemNumber = 0;
+	g_Level.Rooms.push_back(room);
+
+	g_Level.Items.resize(ITEM_COUNT);
+	for (int i = 0; i < ITEM_COUNT; i++)
+	{
+		auto& item = g_Level.Items[i];
+		item.ObjectNumber = ID_NO_OBJECT;
+		item.RoomNumber = 0;
+		item.NextItem = (i < (ITEM_COUNT - 1)) ? (i + 1) : NO_VALUE;
+		item.Pose = Pose(Random::GenerateInt(0, BLOCK(ROOM_SIZE)), 0, Random::GenerateInt(0, BLOCK(ROOM_SIZE)), EulerAngles(0, Random::GenerateAngle(), 0));
 	}
 
-	// Done.
-	staticList.clear();
+	g_Level.NumItems = ITEM_COUNT;
+	g_BroadPhase.Initialize();
+
+	// Camera moves between two positions every query, as it does between frames.
+	auto rays = std::vector<std::pair<Vector3, Vector3>>(QUERY_COUNT);
+	for (auto& [startPos, endPos] : rays)
+	{
+		startPos = Vector3(Random::GenerateFloat(0.0f, BLOCK(ROOM_SIZE)), Random::GenerateFloat(-CLICK(3), 0.0f), Random::GenerateFloat(0.0f, BLOCK(ROOM_SIZE)));
+		endPos = startPos + Vector3(Random::GenerateFloat(-CAMERA_STEP_MAX, CAMERA_STEP_MAX), 0.0f, Random::GenerateFloat(-CAMERA_STEP_MAX, CAMERA_STEP_MAX));
+	}
+
+	auto runPass = [&](bool useBroadPhase, std::vector<float>& sweepDists, int& colliderCount, int& heapAllocCount)
+	{
+		for (int i = 0; i < QUERY_COUNT; i++)
+		{
+			const auto& [startPos, endPos] = rays[i];
+			auto cameraPos = Vector3i(endPos);
+
+			{
+				auto itemNumbers = ArenaVector<int>(LinearArenaAllocator<int>(CameraCollisionArena));
+				if (useBroadPhase)
+				{
+					g_BroadPhase.GetItems(0, cameraPos, COLL_CHECK_THRESHOLD, itemNumbers);
+				}
+				else
+				{
+					for (int itemNumber = 0; itemNumber < g_Level.NumItems; itemNumber++)
+						itemNumbers.push_back(itemNumber);
+				}
+
+				auto colliders = ArenaVector<CameraCollider>(LinearArenaAllocator<CameraCollider>(CameraCollisionArena));
+				for (int itemNumber : itemNumbers)
+				{
+					const auto& item = g_Level.Items[itemNumber];
+					if (Vector3i::Distance(item.Pose.Position, cameraPos) > COLL_CHECK_THRESHOLD)
+						continue;
+
+					colliders.push_back(CameraCollider{ ITEM_BOUNDS, item.Pose });
+				}
+
+				colliderCount += (int)colliders.size();
+				sweepDists[i] = GetCameraSweepDistance(startPos, endPos, colliders);
+			}
+
+			heapAllocCount += CameraCollisionArena.GetHeapAllocationCount();
+			CameraCollisionArena.Reset();
+		}
+	};
+
+	auto linearSweepDists = std::vector<float>(QUERY_COUNT);
+	auto gridSweepDists = std::vector<float>(QUERY_COUNT);
+	int linearColliderCount = 0;
+	int gridColliderCount = 0;
+	int linearHeapAllocCount = 0;
+	int gridHeapAllocCount = 0;
+
+	auto startTime = std::chrono::high_resolution_clock::now();
+	runPass(false, linearSweepDists, linearColliderCount, linearHeapAllocCount);
+	auto linearEndTime = std::chrono::high_resolution_clock::now();
+	runPass(true, gridSweepDists, gridColliderCount, gridHeapAllocCount);
+	auto gridEndTime = std::chrono::high_resolution_clock::now();
+
+	int mismatchCount = 0;
+	for (int i = 0; i < QUERY_COUNT; i++)
+	{
+		if (linearSweepDists[i] != gridSweepDists[i])
+			mismatchCount++;
+	}
+
+	double linearTime = std::chrono::duration<double, std::milli>(linearEndTime - startTime).count();
+	double gridTime = std::chrono::duration<double, std::milli>(gridEndTime - linearEndTime).count();
+
+	auto stream = std::ostringstream();
+	stream << std::fixed << std::setprecision(3);
+	stream << "Items: " << ITEM_COUNT << ", queries: " << QUERY_COUNT << std::endl;
+	stream << "Linear scan (ms): " << linearTime << " (" << ((linearTime * 1000000.0) / QUERY_COUNT) << " ns/query)" << std::endl;
+	stream << "Broad phase (ms): " << gridTime << " (" << ((gridTime * 1000000.0) / QUERY_COUNT) << " ns/query)" << std::endl;
+	stream << "Colliders per query: " << ((float)gridColliderCount / QUERY_COUNT) << std::endl;
+	stream << "Arena heap allocations: " << (linearHeapAllocCount + gridHeapAllocCount) << std::endl;
+	stream << "Mismatches: " << (mismatchCount + abs(linearColliderCount - gridColliderCount)) << std::endl;
+
+	std::swap(levelRooms, g_Level.Rooms);
+	std::swap(levelItems, g_Level.Items);
+	g_Level.NumItems = levelItemCount;
+	g_BroadPhase.Initialize();
+
+	return stream.str();
 }
 
 void UpdateMikePos(const ItemInfo& item)
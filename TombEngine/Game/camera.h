@@ -115,4 +115,6 @@ void UpdateFadeScreenAndCinematicBars();
 void UpdateMikePos(const ItemInfo& item);
 void ClearObjCamera();
 
+std::string RunCameraBenchmark();
+
 float GetParticleDistanceFade(const Vector3i& pos);
@@ -0,0 +1,492 @@
+#include "framework.h"
+#include "Game/collision/BroadPhase.h"
+
+#include <chrono>
+#include <iomanip>
+#include <sstream>
+
+#include "Game/animation.h"
+#include "Game/items.h"
+#include "Game/room.h"
+#include "Game/Setup.h"
+#include "Math/Math.h"
+#include "Specific/Benchmark.h"
+#include "Specific/level.h"
+
+using namespace TEN::Benchmark;
+using namespace TEN::Math;
+using namespace TEN::Memory;
+
+namespace TEN::Collision::BroadPhase
+{
+	BroadPhaseController g_BroadPhase = {};
+
+	static float GetItemRadius(const ItemInfo& item)
+	{
+		// Dummy items and nullmeshes have no meaningful bounds.
+		if (!Objects.CheckID(item.ObjectNumber, true) ||
+			(Objects[item.ObjectNumber].drawRoutine == nullptr && !item.IsLara()))
+		{
+			return 0.0f;
+		}
+
+		auto extents = GetBestFrame(item).BoundingBox.GetExtents();
+		return std::hypot(extents.x, extents.z);
+	}
+
+	static float GetStaticRadius(const MESH_INFO& staticObj)
+	{
+		const auto& bounds = GetBoundsAccurate(staticObj, false);
+		return (bounds.GetExtents() * Vector3(1.0f, 0.0f, 1.0f)).Length();
+	}
+
+	static void RemoveFromCell(std::vector<int>& cell, int id)
+	{
+		auto it = std::find(cell.begin(), cell.end(), id);
+		if (it == cell.end())
+			return;
+
+		*it = cell.back();
+		cell.pop_back();
+	}
+
+	const BroadPhaseStats& BroadPhaseController::GetStats() const
+	{
+		return _stats;
+	}
+
+	// Collects items in room which may lie within radius of center, padded by largest item radius in room.
+	void BroadPhaseController::GetItems(int roomNumber, const Vector3i& center, float radius, ArenaVector<int>& itemNumbers)
+	{
+		auto profile = ScopedProfile(ProfileSection::BroadPhase);
+
+		const auto& room = g_Level.Rooms[roomNumber];
+		int startCount = (int)itemNumbers.size();
+
+		if (!_isEnabled || _rooms.empty())
+		{
+			for (int itemNumber = room.itemNumber; itemNumber != NO_VALUE; itemNumber = g_Level.Items[itemNumber].NextItem)
+			{
+				itemNumbers.push_back(itemNumber);
+
+				// HACK: For some reason, sometimes an infinite loop may happen here.
+				if (itemNumber == g_Level.Items[itemNumber].NextItem)
+					break;
+			}
+
+			_stats.QueryCount++;
+			_stats.CandidateCount += (int)itemNumbers.size() - startCount;
+			_stats.ScanCount += (int)itemNumbers.size() - startCount;
+			return;
+		}
+
+		const auto& grid = _rooms[roomNumber];
+
+		int minX, maxX, minZ, maxZ;
+		GetCellRange(grid, center, radius + grid.ItemRadiusMax, minX, maxX, minZ, maxZ);
+
+		for (int x = minX; x <= maxX; x++)
+		{
+			for (int z = minZ; z <= maxZ; z++)
+			{
+				const auto& cell = grid.ItemCells[(x * grid.CellCountZ) + z];
+				itemNumbers.insert(itemNumbers.end(), cell.begin(), cell.end());
+			}
+		}
+
+		_stats.QueryCount++;
+		_stats.CandidateCount += (int)itemNumbers.size() - startCount;
+		_stats.ScanCount += grid.ItemCount;
+	}
+
+	// Collects statics in room which may lie within radius of center, padded by largest static radius in room.
+	void BroadPhaseController::GetStatics(int roomNumber, const Vector3i& center, float radius, ArenaVector<MESH_INFO*>& staticPtrs)
+	{
+		auto profile = ScopedProfile(ProfileSection::BroadPhase);
+
+		auto& room = g_Level.Rooms[roomNumber];
+		int startCount = (int)staticPtrs.size();
+
+		if (!_isEnabled || _rooms.empty())
+		{
+			for (auto& staticObj : room.mesh)
+				staticPtrs.push_back(&staticObj);
+
+			_stats.QueryCount++;
+			_stats.CandidateCount += (int)room.mesh.size();
+			_stats.ScanCount += (int)room.mesh.size();
+			return;
+		}
+
+		const auto& grid = _rooms[roomNumber];
+
+		int minX, maxX, minZ, maxZ;
+		GetCellRange(grid, center, radius + grid.StaticRadiusMax, minX, maxX, minZ, maxZ);
+
+		for (int x = minX; x <= maxX; x++)
+		{
+			for (int z = minZ; z <= maxZ; z++)
+			{
+				for (int staticIndex : grid.StaticCells[(x * grid.CellCountZ) + z])
+					staticPtrs.push_back(&room.mesh[staticIndex]);
+			}
+		}
+
+		_stats.QueryCount++;
+		_stats.CandidateCount += (int)staticPtrs.size() - startCount;
+		_stats.ScanCount += (int)room.mesh.size();
+	}
+
+	void BroadPhaseController::SetEnabled(bool value)
+	{
+		_isEnabled = value;
+	}
+
+	bool BroadPhaseController::IsEnabled() const
+	{
+		return _isEnabled;
+	}
+
+	void BroadPhaseController::Initialize()
+	{
+		_rooms.clear();
+		_rooms.resize(g_Level.Rooms.size());
+		_items.assign(g_Level.Items.size(), ItemEntry{});
+		ClearStats();
+
+		for (int roomNumber = 0; roomNumber < g_Level.Rooms.size(); roomNumber++)
+			RebuildRoom(roomNumber);
+	}
+
+	void BroadPhaseController::Deinitialize()
+	{
+		_rooms.clear();
+		_items.clear();
+		ClearStats();
+	}
+
+	void BroadPhaseController::Update()
+	{
+		if (g_Benchmark.Profiler.IsEnabled())
+		{
+			g_Benchmark.Profiler.AddCount(ProfileCounter::BroadPhaseQueries, _stats.QueryCount);
+			g_Benchmark.Profiler.AddCount(ProfileCounter::BroadPhaseCandidates, _stats.CandidateCount);
+			g_Benchmark.Profiler.AddCount(ProfileCounter::BroadPhaseScanned, _stats.ScanCount);
+		}
+
+		ClearStats();
+
+		// Re-bucket items which moved since last frame. Only cell changes cause actual work.
+		for (int itemNumber = 0; itemNumber < _items.size(); itemNumber++)
+		{
+			if (_items[itemNumber].RoomNumber != NO_VALUE)
+				UpdateItem(itemNumber);
+		}
+
+		// Shrink query padding of rooms which lost their largest item.
+		for (auto& grid : _rooms)
+		{
+			if (grid.IsItemRadiusDirty)
+				RecomputeItemRadius(grid);
+		}
+	}
+
+	void BroadPhaseController::UpdateItem(int itemNumber)
+	{
+		if (_rooms.empty() || itemNumber < 0 || itemNumber >= _items.size())
+			return;
+
+		const auto& item = g_Level.Items[itemNumber];
+		if (item.RoomNumber < 0 || item.RoomNumber >= _rooms.size())
+		{
+			RemoveItem(itemNumber);
+			return;
+		}
+
+		auto& entry = _items[itemNumber];
+		auto& grid = _rooms[item.RoomNumber];
+
+		int cellIndex = GetCellIndex(grid, item.Pose.Position.x, item.Pose.Position.z);
+		if (entry.RoomNumber != item.RoomNumber || entry.CellIndex != cellIndex)
+		{
+			RemoveItem(itemNumber);
+			InsertItem(itemNumber, item.RoomNumber);
+			return;
+		}
+
+		// Moving items may change their animated bounds, so track their radius continuously.
+		if (item.Active || item.IsLara())
+			SetItemRadius(grid, entry, GetItemRadius(item));
+	}
+
+	void BroadPhaseController::RemoveItem(int itemNumber)
+	{
+		if (_rooms.empty() || itemNumber < 0 || itemNumber >= _items.size())
+			return;
+
+		auto& entry = _items[itemNumber];
+		if (entry.RoomNumber == NO_VALUE)
+			return;
+
+		auto& grid = _rooms[entry.RoomNumber];
+		RemoveFromCell(grid.ItemCells[entry.CellIndex], itemNumber);
+		grid.ItemCount--;
+
+		if (entry.Radius >= grid.ItemRadiusMax)
+			grid.IsItemRadiusDirty = true;
+
+		entry = ItemEntry{};
+	}
+
+	// Room number must be index of room holding statics, which differs from MESH_INFO::roomNumber in flipped rooms.
+	void BroadPhaseController::UpdateStatics(int roomNumber)
+	{
+		if (_rooms.empty() || roomNumber < 0 || roomNumber >= _rooms.size())
+			return;
+
+		// Statics rarely move, so just re-bucket whole room's statics.
+		auto& grid = _rooms[roomNumber];
+		for (auto& cell : grid.StaticCells)
+			cell.clear();
+
+		grid.StaticRadiusMax = 0.0f;
+		InsertStatics(roomNumber);
+	}
+
+	void BroadPhaseController::RebuildRoom(int roomNumber)
+	{
+		if (roomNumber < 0 || roomNumber >= _rooms.size())
+			return;
+
+		const auto& room = g_Level.Rooms[roomNumber];
+		auto& grid = _rooms[roomNumber];
+
+		// Detach items still registered in room.
+		for (auto& entry : _items)
+		{
+			if (entry.RoomNumber == roomNumber)
+				entry = ItemEntry{};
+		}
+
+		grid = RoomGrid{};
+		grid.OriginX = room.x;
+		grid.OriginZ = room.z;
+		grid.CellCountX = std::max(1, (int)ceil(BLOCK(room.xSize) / (float)CELL_SIZE));
+		grid.CellCountZ = std::max(1, (int)ceil(BLOCK(room.zSize) / (float)CELL_SIZE));
+		grid.ItemCells.resize(grid.CellCountX * grid.CellCountZ);
+		grid.StaticCells.resize(grid.CellCountX * grid.CellCountZ);
+
+		InsertStatics(roomNumber);
+
+		for (int itemNumber = room.itemNumber; itemNumber != NO_VALUE; itemNumber = g_Level.Items[itemNumber].NextItem)
+		{
+			if (_items[itemNumber].RoomNumber != NO_VALUE)
+				RemoveItem(itemNumber);
+
+			InsertItem(itemNumber, roomNumber);
+
+			if (itemNumber == g_Level.Items[itemNumber].NextItem)
+				break;
+		}
+	}
+
+	void BroadPhaseController::ClearStats()
+	{
+		_stats = BroadPhaseStats{};
+	}
+
+	int BroadPhaseController::GetCellIndex(const RoomGrid& grid, int x, int z) const
+	{
+		// Items slightly outside room bounds are clamped to border cells.
+		int cellX = std::clamp((x - grid.OriginX) / CELL_SIZE, 0, grid.CellCountX - 1);
+		int cellZ = std::clamp((z - grid.OriginZ) / CELL_SIZE, 0, grid.CellCountZ - 1);
+		return ((cellX * grid.CellCountZ) + cellZ);
+	}
+
+	void BroadPhaseController::GetCellRange(const RoomGrid& grid, const Vector3i& center, float radius, int& minX, int& maxX, int& minZ, int& maxZ) const
+	{
+		int range = (int)ceil(radius + QUERY_MARGIN);
+
+		minX = std::clamp((center.x - range - grid.OriginX) / CELL_SIZE, 0, grid.CellCountX - 1);
+		maxX = std::clamp((center.x + range - grid.OriginX) / CELL_SIZE, 0, grid.CellCountX - 1);
+		minZ = std::clamp((center.z - range - grid.OriginZ) / CELL_SIZE, 0, grid.CellCountZ - 1);
+		maxZ = std::clamp((center.z + range - grid.OriginZ) / CELL_SIZE, 0, grid.CellCountZ - 1);
+	}
+
+	void BroadPhaseController::InsertItem(int itemNumber, int roomNumber)
+	{
+		const auto& item = g_Level.Items[itemNumber];
+		auto& grid = _rooms[roomNumber];
+
+		int cellIndex = GetCellIndex(grid, item.Pose.Position.x, item.Pose.Position.z);
+		grid.ItemCells[cellIndex].push_back(itemNumber);
+		grid.ItemCount++;
+
+		auto& entry = _items[itemNumber];
+		entry = ItemEntry{ roomNumber, cellIndex };
+		SetItemRadius(grid, entry, GetItemRadius(item));
+	}
+
+	void BroadPhaseController::InsertStatics(int roomNumber)
+	{
+		const auto& room = g_Level.Rooms[roomNumber];
+		auto& grid = _rooms[roomNumber];
+
+		for (int i = 0; i < room.mesh.size(); i++)
+		{
+			const auto& staticObj = room.mesh[i];
+
+			int cellIndex = GetCellIndex(grid, staticObj.pos.Position.x, staticObj.pos.Position.z);
+			grid.StaticCells[cellIndex].push_back(i);
+			grid.StaticRadiusMax = std::max(grid.StaticRadiusMax, GetStaticRadius(staticObj));
+		}
+	}
+	void BroadPhaseController::SetItemRadius(RoomGrid& grid, ItemEntry& entry, float radius)
+	{
+		// Largest item shrinking may leave room padded more than necessary.
+		if (radius < entry.Radius && entry.Radius >= grid.ItemRadiusMax)
+			grid.IsItemRadiusDirty = true;
+
+		entry.Radius = radius;
+		grid.ItemRadiusMax = std::max(grid.ItemRadiusMax, radius);
+	}
+
+	void BroadPhaseController::RecomputeItemRadius(RoomGrid& grid)
+	{
+		grid.ItemRadiusMax = 0.0f;
+		for (const auto& cell : grid.ItemCells)
+		{
+			for (int itemNumber : cell)
+				grid.ItemRadiusMax = std::max(grid.ItemRadiusMax, _items[itemNumber].Radius);
+		}
+
+		grid.IsItemRadiusDirty = false;
+	}
+
+	std::string RunBroadPhaseBenchmark()
+	{
+		constexpr auto ROOM_SIZE	 = 48; // In blocks.
+		constexpr auto ITEM_COUNT	 = 2048;
+		constexpr auto FRAME_COUNT	 = 100;
+		constexpr auto QUERY_COUNT	 = 100; // Per frame.
+		constexpr auto MOVE_DIST_MAX = CLICK(2);
+		constexpr auto RADIUS_MAX	 = BLOCK(2);
+
+		// Synthetic level: one large room filled with items. Real level rooms and items are swapped out and restored afterwards.
+		auto levelRooms = std::vector<ROOM_INFO>{};
+		auto levelItems = std::vector<ItemInfo>{};
+		int levelItemCount = g_Level.NumItems;
+		std::swap(levelRooms, g_Level.Rooms);
+		std::swap(levelItems, g_Level.Items);
+
+		auto room = ROOM_INFO{};
+		room.xSize = ROOM_SIZE;
+		room.zSize = ROOM_SIZE;
+		room.flipNumber = NO_VALUE;
+		room.flippedRoom = NO_VALUE;
+		room.itemNumber = 0;
+		g_Level.Rooms.push_back(room);
+
+		g_Level.Items.resize(ITEM_COUNT);
+		for (int i = 0; i < ITEM_COUNT; i++)
+		{
+			auto& item = g_Level.Items[i];
+			item.ObjectNumber = ID_NO_OBJECT;
+			item.RoomNumber = 0;
+			item.NextItem = (i < (ITEM_COUNT - 1)) ? (i + 1) : NO_VALUE;
+			item.Pose.Position = Vector3i(Random::GenerateInt(0, BLOCK(ROOM_SIZE)), 0, Random::GenerateInt(0, BLOCK(ROOM_SIZE)));
+		}
+
+		g_Level.NumItems = ITEM_COUNT;
+		g_BroadPhase.Initialize();
+
+		double scanTime = 0.0;
+		double gridTime = 0.0;
+		long long scanCandidateCount = 0;
+		long long gridCandidateCount = 0;
+		long long hitCount = 0;
+		int mismatchCount = 0;
+
+		auto scanHits = std::vector<int>{};
+		auto gridHits = std::vector<int>{};
+
+		// Items move between frames as they do in game, so queries also cover re-bucketed items.
+		for (int frame = 0; frame < FRAME_COUNT; frame++)
+		{
+			for (auto& item : g_Level.Items)
+			{
+				item.Pose.Position.x = std::clamp(item.Pose.Position.x + Random::GenerateInt(-MOVE_DIST_MAX, MOVE_DIST_MAX), 0, BLOCK(ROOM_SIZE));
+				item.Pose.Position.z = std::clamp(item.Pose.Position.z + Random::GenerateInt(-MOVE_DIST_MAX, MOVE_DIST_MAX), 0, BLOCK(ROOM_SIZE));
+			}
+
+			g_BroadPhase.Update();
+
+			for (int i = 0; i < QUERY_COUNT; i++)
+			{
+				auto center = Vector3i(Random::GenerateInt(0, BLOCK(ROOM_SIZE)), 0, Random::GenerateInt(0, BLOCK(ROOM_SIZE)));
+				float radius = Random::GenerateFloat(0.0f, RADIUS_MAX);
+
+				auto collectHits = [&](std::vector<int>& hits, int& candidateCount, bool useBroadPhase)
+				{
+					auto itemNumbers = ArenaVector<int>{};
+					if (useBroadPhase)
+					{
+						g_BroadPhase.GetItems(0, center, radius, itemNumbers);
+					}
+					else
+					{
+						for (int itemNumber = 0; itemNumber < g_Level.NumItems; itemNumber++)
+							itemNumbers.push_back(itemNumber);
+					}
+
+					hits.clear();
+					for (int itemNumber : itemNumbers)
+					{
+						if (Vector3i::Distance(g_Level.Items[itemNumber].Pose.Position, center) <= radius)
+							hits.push_back(itemNumber);
+					}
+
+					candidateCount = (int)itemNumbers.size();
+				};
+
+				int scanCount = 0;
+				int gridCount = 0;
+
+				auto startTime = std::chrono::high_resolution_clock::now();
+				collectHits(scanHits, scanCount, false);
+				auto scanEndTime = std::chrono::high_resolution_clock::now();
+				collectHits(gridHits, gridCount, true);
+				auto gridEndTime = std::chrono::high_resolution_clock::now();
+
+				scanTime += std::chrono::duration<double, std::milli>(scanEndTime - startTime).count();
+				gridTime += std::chrono::duration<double, std::milli>(gridEndTime - scanEndTime).count();
+				scanCandidateCount += scanCount;
+				gridCandidateCount += gridCount;
+				hitCount += scanHits.size();
+
+				// Grid returns candidates in cell order, so sort before comparing sets.
+				std::sort(gridHits.begin(), gridHits.end());
+				if (scanHits != gridHits)
+					mismatchCount++;
+			}
+		}
+
+		int totalQueryCount = FRAME_COUNT * QUERY_COUNT;
+
+		auto stream = std::ostringstream();
+		stream << std::fixed << std::setprecision(3);
+		stream << "Items: " << ITEM_COUNT << ", queries: " << totalQueryCount << std::endl;
+		stream << "Full scan (ms): " << scanTime << " (" << ((scanTime * 1000000.0) / totalQueryCount) << " ns/query)" << std::endl;
+		stream << "Broad phase (ms): " << gridTime << " (" << ((gridTime * 1000000.0) / totalQueryCount) << " ns/query)" << std::endl;
+		stream << "Candidates per query: " << ((double)gridCandidateCount / totalQueryCount) << " (full scan " << ((double)scanCandidateCount / totalQueryCount) << ")" << std::endl;
+		stream << "Hits per query: " << ((double)hitCount / totalQueryCount) << std::endl;
+		stream << "Mismatches: " << mismatchCount << std::endl;
+
+		std::swap(levelRooms, g_Level.Rooms);
+		std::swap(levelItems, g_Level.Items);
+		g_Level.NumItems = levelItemCount;
+		g_BroadPhase.Initialize();
+
+		return stream.str();
+	}
+}
@@ -0,0 +1,90 @@
+#pragma once
+#include "Math/Math.h"
+#include "Specific/memory/LinearArena.h"
+
+struct MESH_INFO;
+
+namespace TEN::Collision::BroadPhase
+{
+	struct BroadPhaseStats
+	{
+		int QueryCount	   = 0;
+		int CandidateCount = 0; // Objects returned by grid queries.
+		int ScanCount	   = 0; // Objects a full room scan would have visited.
+	};
+
+	// Uniform grid of room-local cells which buckets items and statics by position.
+	// Items are re-bucketed only when they cross a cell boundary or change rooms.
+	class BroadPhaseController
+	{
+	private:
+		// Constants
+		static constexpr auto CELL_SIZE	   = BLOCK(2);
+		static constexpr auto QUERY_MARGIN = BLOCK(0.5f); // Covers intra-frame movement of items not yet re-bucketed.
+
+		struct RoomGrid
+		{
+			int OriginX	  = 0;
+			int OriginZ	  = 0;
+			int CellCountX = 0;
+			int CellCountZ = 0;
+
+			std::vector<std::vector<int>> ItemCells	  = {};
+			std::vector<std::vector<int>> StaticCells = {};
+
+			int	  ItemCount			= 0;
+			float ItemRadiusMax		= 0.0f;
+			float StaticRadiusMax	= 0.0f;
+			bool  IsItemRadiusDirty = false; // Item with largest radius left room or shrank.
+		};
+
+		struct ItemEntry
+		{
+			int	  RoomNumber = NO_VALUE;
+			int	  CellIndex	 = NO_VALUE;
+			float Radius	 = 0.0f;
+		};
+
+		// Members
+		bool				   _isEnabled = true;
+		std::vector<RoomGrid>  _rooms	  = {};
+		std::vector<ItemEntry> _items	  = {};
+		BroadPhaseStats		   _stats	  = {};
+
+	public:
+		// Getters
+		const BroadPhaseStats& GetStats() const;
+
+		void GetItems(int roomNumber, const Vector3i& center, float radius, TEN::Memory::ArenaVector<int>& itemNumbers);
+		void GetStatics(int roomNumber, const Vector3i& center, float radius, TEN::Memory::ArenaVector<MESH_INFO*>& staticPtrs);
+
+		// Setters
+		void SetEnabled(bool value);
+
+		// Inquirers
+		bool IsEnabled() const;
+
+		// Utilities
+		void Initialize();
+		void Deinitialize();
+		void Update();
+		void UpdateItem(int itemNumber);
+		void RemoveItem(int itemNumber);
+		void UpdateStatics(int roomNumber);
+		void RebuildRoom(int roomNumber);
+		void ClearStats();
+
+	private:
+		// Helpers
+		int	 GetCellIndex(const RoomGrid& grid, int x, int z) const;
+		void GetCellRange(const RoomGrid& grid, const Vector3i& center, float radius, int& minX, int& maxX, int& minZ, int& maxZ) const;
+		void InsertItem(int itemNumber, int roomNumber);
+		void InsertStatics(int roomNumber);
+		void SetItemRadius(RoomGrid& grid, ItemEntry& entry, float radius);
+		void RecomputeItemRadius(RoomGrid& grid);
+	};
+
+	extern BroadPhaseController g_BroadPhase;
+
+	std::string RunBroadPhaseBenchmark();
+}
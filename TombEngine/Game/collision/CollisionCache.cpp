@@ -0,0 +1,98 @@
+#include "framework.h"
+#include "Game/collision/CollisionCache.h"
+
+#include "Specific/Benchmark.h"
+
+using namespace TEN::Benchmark;
+
+namespace TEN::Collision::CollisionCache
+{
+	CollisionCacheController g_CollisionCache = {};
+
+	const CollisionCacheStats& CollisionCacheController::GetStats() const
+	{
+		return _stats;
+	}
+
+	void CollisionCacheController::SetEnabled(bool value)
+	{
+		_isEnabled = value;
+	}
+
+	bool CollisionCacheController::IsEnabled() const
+	{
+		return _isEnabled;
+	}
+
+	bool CollisionCacheController::Find(const FloorInfo* sector, const Vector3i& pos, CollisionResult& result)
+	{
+		if (!IsUsable())
+			return false;
+
+		_stats.QueryCount++;
+
+		const auto& entry = _entries[GetEntryIndex(sector, pos)];
+		if (entry.Epoch != _epoch || entry.Sector != sector || entry.Position != pos)
+			return false;
+
+		_stats.HitCount++;
+		result = entry.Result;
+		return true;
+	}
+
+	void CollisionCacheController::Insert(const FloorInfo* sector, const Vector3i& pos, const CollisionResult& result)
+	{
+		if (!IsUsable())
+			return;
+
+		auto& entry = _entries[GetEntryIndex(sector, pos)];
+		entry.Sector = sector;
+		entry.Position = pos;
+		entry.Epoch = _epoch;
+		entry.Result = result;
+	}
+
+	void CollisionCacheController::Invalidate()
+	{
+		_epoch++;
+
+		// Stale entries could match again after wraparound.
+		if (_epoch == 0)
+		{
+			for (auto& entry : _entries)
+				entry.Epoch = 0;
+
+			_epoch = 1;
+		}
+	}
+
+	void CollisionCacheController::Update()
+	{
+		if (g_Benchmark.Profiler.IsEnabled())
+		{
+			g_Benchmark.Profiler.AddCount(ProfileCounter::CollisionProbes, _stats.QueryCount);
+			g_Benchmark.Profiler.AddCount(ProfileCounter::CollisionCacheHits, _stats.HitCount);
+		}
+
+		_stats = CollisionCacheStats{};
+		_threadID = std::this_thread::get_id();
+		Invalidate();
+	}
+
+	// Only game thread may use cache; probes from job workers are computed directly.
+	bool CollisionCacheController::IsUsable() const
+	{
+		return (_isEnabled && std::this_thread::get_id() == _threadID);
+	}
+
+	int CollisionCacheController::GetEntryIndex(const FloorInfo* sector, const Vector3i& pos) const
+	{
+		auto hash = (size_t)sector;
+		hash ^= (size_t)pos.x * 73856093u;
+		hash ^= (size_t)pos.y * 19349663u;
+		hash ^= (size_t)pos.z * 83492791u;
+		hash ^= (hash >> 16);
+
+		return int(hash & (ENTRY_COUNT - 1));
+	}
+}
@@ -0,0 +1,62 @@
+#pragma once
+#include <thread>
+
+#include "Game/collision/collide_room.h"
+
+namespace TEN::Collision::CollisionCache
+{
+	struct CollisionCacheStats
+	{
+		int QueryCount = 0;
+		int HitCount   = 0;
+	};
+
+	// Direct-mapped cache of point collision probes keyed by sector and exact probe position.
+	// Entries are valid only within current epoch, which advances every frame, on any bridge
+	// change or bridge pose change, and on flipmap, so cached results are identical to uncached ones.
+	class CollisionCacheController
+	{
+	private:
+		// Constants
+		static constexpr auto ENTRY_COUNT = 1024; // Must be power of 2.
+
+		struct Entry
+		{
+			const FloorInfo* Sector	  = nullptr;
+			Vector3i		 Position = Vector3i::Zero;
+			unsigned int	 Epoch	  = 0;
+
+			CollisionResult Result = {};
+		};
+
+		// Members
+		bool				_isEnabled = true;
+		unsigned int		_epoch	   = 1;
+		std::vector<Entry>	_entries   = std::vector<Entry>(ENTRY_COUNT);
+		std::thread::id		_threadID  = {};
+		CollisionCacheStats _stats	   = {};
+
+	public:
+		// Getters
+		const CollisionCacheStats& GetStats() const;
+
+		// Setters
+		void SetEnabled(bool value);
+
+		// Inquirers
+		bool IsEnabled() const;
+
+		// Utilities
+		bool Find(const FloorInfo* sector, const Vector3i& pos, CollisionResult& result);
+		void Insert(const FloorInfo* sector, const Vector3i& pos, const CollisionResult& result);
+		void Invalidate();
+		void Update();
+
+	private:
+		// Helpers
+		bool IsUsable() const;
+		int	 GetEntryIndex(const FloorInfo* sector, const Vector3i& pos) const;
+	};
+
+	extern CollisionCacheController g_CollisionCache;
+}
@@ -0,0 +1,585 @@
+#include "framework.h"
+#include "Game/collision/Raycast.h"
+
+#include <chrono>
+#include <iomanip>
+#include <sstream>
+
+#include "Game/collision/collide_room.h"
+#include "Game/collision/floordata.h"
+#include "Game/control/los.h"
+#include "Game/room.h"
+#include "Math/Math.h"
+#include "Specific/JobSystem.h"
+#include "Specific/level.h"
+
+using namespace TEN::Collision::Floordata;
+using namespace TEN::Jobs;
+using namespace TEN::Math;
+
+namespace TEN::Collision::Raycast
+{
+	constexpr auto RAY_PORTAL_DEPTH_MAX	  = 32;
+	constexpr auto RAY_HIT_BACKOFF		  = 4.0f;	// Hit position is pulled back toward origin to stay outside blocking surface.
+	constexpr auto RAY_SEGMENT_LENGTH_MIN = 0.001f; // Segments touching only sector corner are skipped.
+	constexpr auto RAY_BATCH_PARALLEL_MIN = 64;
+
+	RaycastController g_Raycast = {};
+
+	static void AddRoom(RoomRayHit& hit, int roomNumber)
+	{
+		if (hit.RoomCount > 0 && hit.RoomNumbers[hit.RoomCount - 1] == roomNumber)
+			return;
+
+		if (hit.RoomCount >= RAY_ROOM_COUNT_MAX)
+			return;
+
+		for (int i = 0; i < hit.RoomCount; i++)
+		{
+			if (hit.RoomNumbers[i] == roomNumber)
+				return;
+		}
+
+		hit.RoomNumbers[hit.RoomCount] = roomNumber;
+		hit.RoomCount++;
+	}
+
+	// Same split bias as FloorInfo::GetSurfaceTriangleID(), but on unwrapped float sector point.
+	static float GetSplitBias(const SectorSurfaceData& surface, const Vector2& sectorPoint)
+	{
+		auto rotMatrix = Matrix::CreateRotationZ(TO_RAD(surface.SplitAngle));
+		return Vector2::Transform(sectorPoint, rotMatrix).x;
+	}
+
+	// Same plane equation as FloorInfo::GetSurfaceHeight(), but on unwrapped float sector point.
+	static float GetPlaneHeight(const SectorSurfaceTriangleData& tri, const Vector2& sectorPoint)
+	{
+		auto normal = tri.Plane.Normal();
+		return (tri.Plane.D() - (((normal.x * sectorPoint.x) + (normal.z * sectorPoint.y)) / normal.y));
+	}
+
+	struct SectorRay
+	{
+		Vector3	 Start	= Vector3::Zero;
+		Vector3	 Delta	= Vector3::Zero;
+		Vector2i Sector = Vector2i::Zero;
+
+		// Getters
+		Vector3 GetPoint(float t) const
+		{
+			return (Start + (Delta * t));
+		}
+
+		// Point relative to sector center. Not wrapped, so it stays continuous up to sector edges.
+		Vector2 GetSectorPoint(float t) const
+		{
+			constexpr auto HALF_BLOCK = BLOCK(0.5f);
+
+			auto point = GetPoint(t);
+			return Vector2(
+				point.x - (BLOCK(Sector.x) + HALF_BLOCK),
+				point.z - (BLOCK(Sector.y) + HALF_BLOCK));
+		}
+
+		// Integer point inside sector, as expected by floordata queries.
+		Vector3i GetSectorPosition(float t) const
+		{
+			auto point = GetPoint(t);
+			return Vector3i(
+				std::clamp((int)round(point.x), BLOCK(Sector.x), BLOCK(Sector.x + 1) - 1),
+				(int)round(point.y),
+				std::clamp((int)round(point.z), BLOCK(Sector.y), BLOCK(Sector.y + 1) - 1));
+		}
+	};
+
+	// Splits [t0, t1] at sector surface split line. Returns number of pieces written to bounds.
+	static int SplitSegment(const SectorRay& ray, const SectorSurfaceData& surface, float t0, float t1, std::array<float, 3>& bounds)
+	{
+		float bias0 = GetSplitBias(surface, ray.GetSectorPoint(t0));
+		float bias1 = GetSplitBias(surface, ray.GetSectorPoint(t1));
+
+		bounds[0] = t0;
+		if ((bias0 < 0.0f) != (bias1 < 0.0f))
+		{
+			// Bias is linear along segment.
+			bounds[1] = t0 + ((t1 - t0) * (bias0 / (bias0 - bias1)));
+			bounds[2] = t1;
+			return 2;
+		}
+
+		bounds[1] = t1;
+		return 1;
+	}
+
+	// Returns first t in [t0, t1] at which ray is below floor or above ceiling of sector, or INFINITY.
+	static float IntersectSurface(const SectorRay& ray, const FloorInfo& sector, bool isFloor, float t0, float t1)
+	{
+		const auto& surface = isFloor ? sector.FloorSurface : sector.CeilingSurface;
+
+		auto bounds = std::array<float, 3>{};
+		int pieceCount = SplitSegment(ray, surface, t0, t1, bounds);
+
+		for (int i = 0; i < pieceCount; i++)
+		{
+			float tA = bounds[i];
+			float tB = bounds[i + 1];
+
+			float bias = GetSplitBias(surface, ray.GetSectorPoint((tA + tB) / 2));
+			const auto& tri = surface.Triangles[(bias < 0.0f) ? 0 : 1];
+
+			// Positive penetration means ray is behind surface. Both ray and plane are linear within piece.
+			float penetrationA = ray.GetPoint(tA).y - GetPlaneHeight(tri, ray.GetSectorPoint(tA));
+			float penetrationB = ray.GetPoint(tB).y - GetPlaneHeight(tri, ray.GetSectorPoint(tB));
+			if (!isFloor)
+			{
+				penetrationA = -penetrationA;
+				penetrationB = -penetrationB;
+			}
+
+			if (penetrationA > 0.0f)
+				return tA;
+
+			if (penetrationB > 0.0f)
+				return (tA + ((tB - tA) * (-penetrationA / (penetrationB - penetrationA))));
+		}
+
+		return INFINITY;
+	}
+
+	// Fallback for sectors with bridges, whose surfaces aren't planes of sector itself.
+	// Samples effective heights at segment ends and assumes they change linearly in between.
+	static float IntersectBridgeSurface(const SectorRay& ray, FloorInfo& sector, bool isFloor, float t0, float t1)
+	{
+		auto posA = ray.GetSectorPosition(t0);
+		auto posB = ray.GetSectorPosition(t1);
+
+		float penetrationA = isFloor ?
+			(posA.y - GetFloorHeight(&sector, posA.x, posA.y, posA.z)) :
+			(GetCeiling(&sector, posA.x, posA.y, posA.z) - posA.y);
+		float penetrationB = isFloor ?
+			(posB.y - GetFloorHeight(&sector, posB.x, posB.y, posB.z)) :
+			(GetCeiling(&sector, posB.x, posB.y, posB.z) - posB.y);
+
+		if (penetrationA > 0.0f)
+			return t0;
+
+		if (penetrationB > 0.0f)
+			return (t0 + ((t1 - t0) * (-penetrationA / (penetrationB - penetrationA))));
+
+		return INFINITY;
+	}
+
+	// Returns first t in [t0, t1] at which ray leaves open space of sector column, or INFINITY.
+	// Portal chain below (floor) or above (ceiling) is followed per triangle, as it may differ between triangles.
+	static float IntersectSectorColumn(const SectorRay& ray, FloorInfo& sideSector, bool isFloor, float t0, float t1)
+	{
+		const auto& surface = isFloor ? sideSector.FloorSurface : sideSector.CeilingSurface;
+
+		auto bounds = std::array<float, 3>{};
+		int pieceCount = SplitSegment(ray, surface, t0, t1, bounds);
+
+		for (int i = 0; i < pieceCount; i++)
+		{
+			float tA = bounds[i];
+			float tB = bounds[i + 1];
+			auto pos = ray.GetSectorPosition((tA + tB) / 2);
+
+			auto* sectorPtr = &sideSector;
+			bool hasBridges = !sectorPtr->Bridges.IsEmpty();
+			for (int depth = 0; depth < RAY_PORTAL_DEPTH_MAX; depth++)
+			{
+				auto nextRoomNumber = sectorPtr->GetNextRoomNumber(pos.x, pos.z, isFloor);
+				if (!nextRoomNumber.has_value())
+					break;
+
+				sectorPtr = &GetSideSector(*nextRoomNumber, pos.x, pos.z);
+				hasBridges |= !sectorPtr->Bridges.IsEmpty();
+			}
+
+			float t = hasBridges ?
+				IntersectBridgeSurface(ray, sideSector, isFloor, tA, tB) :
+				IntersectSurface(ray, *sectorPtr, isFloor, tA, tB);
+
+			if (t != INFINITY)
+				return t;
+		}
+
+		return INFINITY;
+	}
+
+	RoomRayHit CastRoomRay(const GameVector& origin, const GameVector& target)
+	{
+		auto hit = RoomRayHit{};
+		hit.Position = GameVector(target.ToVector3i(), origin.RoomNumber);
+		AddRoom(hit, origin.RoomNumber);
+
+		auto ray = SectorRay{};
+		ray.Start = origin.ToVector3();
+		ray.Delta = target.ToVector3() - ray.Start;
+		ray.Sector = Vector2i(
+			(int)floor(ray.Start.x / BLOCK(1)),
+			(int)floor(ray.Start.z / BLOCK(1)));
+
+		// Set up 2D DDA across sector boundaries. t is normalized distance along ray.
+		int stepX = (ray.Delta.x > 0.0f) ? 1 : ((ray.Delta.x < 0.0f) ? -1 : 0);
+		int stepZ = (ray.Delta.z > 0.0f) ? 1 : ((ray.Delta.z < 0.0f) ? -1 : 0);
+		float tDeltaX = (stepX != 0) ? (BLOCK(1) / std::abs(ray.Delta.x)) : INFINITY;
+		float tDeltaZ = (stepZ != 0) ? (BLOCK(1) / std::abs(ray.Delta.z)) : INFINITY;
+		float tMaxX = (stepX != 0) ? ((BLOCK(ray.Sector.x + ((stepX > 0) ? 1 : 0)) - ray.Start.x) / ray.Delta.x) : INFINITY;
+		float tMaxZ = (stepZ != 0) ? ((BLOCK(ray.Sector.y + ((stepZ > 0) ? 1 : 0)) - ray.Start.z) / ray.Delta.z) : INFINITY;
+
+		float dist = ray.Delta.Length();
+		short roomNumber = origin.RoomNumber;
+		float tEnter = 0.0f;
+		float tHit = INFINITY;
+
+		while (true)
+		{
+			float tExit = std::min({ tMaxX, tMaxZ, 1.0f });
+			if (((tExit - tEnter) * dist) >= RAY_SEGMENT_LENGTH_MIN || (stepX == 0 && stepZ == 0))
+			{
+				// Resolve room at segment midpoint, following portals from previous room.
+				auto pos = ray.GetSectorPosition((tEnter + tExit) / 2);
+				GetFloor(pos.x, pos.y, pos.z, &roomNumber);
+				AddRoom(hit, roomNumber);
+
+				auto& sideSector = GetSideSector(roomNumber, pos.x, pos.z);
+
+				tHit = std::min(
+					IntersectSectorColumn(ray, sideSector, true, tEnter, tExit),
+					IntersectSectorColumn(ray, sideSector, false, tEnter, tExit));
+
+				if (tHit != INFINITY)
+					break;
+			}
+
+			if (tExit >= 1.0f)
+				break;
+
+			// Step into next sector.
+			if (tMaxX < tMaxZ)
+			{
+				ray.Sector.x += stepX;
+				tMaxX += tDeltaX;
+			}
+			else
+			{
+				ray.Sector.y += stepZ;
+				tMaxZ += tDeltaZ;
+			}
+
+			tEnter = tExit;
+		}
+
+		if (tHit == INFINITY)
+		{
+			GetFloor(target.x, target.y, target.z, &roomNumber);
+			hit.Position.RoomNumber = roomNumber;
+			return hit;
+		}
+
+		float tClear = (dist > 0.0f) ? std::max(tHit - (RAY_HIT_BACKOFF / dist), 0.0f) : 0.0f;
+
+		auto point = ray.GetPoint(tClear);
+		hit.IsBlocked = true;
+		hit.Position = GameVector((int)round(point.x), (int)round(point.y), (int)round(point.z), roomNumber);
+		GetFloor(hit.Position.x, hit.Position.y, hit.Position.z, &hit.Position.RoomNumber);
+		return hit;
+	}
+
+	// Batched rays are independent, so large batches are spread across job workers.
+	// Must be called from game thread, as job system doesn't support nested jobs.
+	void CastRoomRays(const std::vector<RoomRay>& rays, std::vector<RoomRayHit>& hits)
+	{
+		hits.resize(rays.size());
+
+		if (rays.size() < RAY_BATCH_PARALLEL_MIN)
+		{
+			for (int i = 0; i < rays.size(); i++)
+				hits[i] = CastRoomRay(rays[i].Origin, rays[i].Target);
+
+			return;
+		}
+
+		g_Jobs.ParallelFor((int)rays.size(), [&](int i)
+		{
+			hits[i] = CastRoomRay(rays[i].Origin, rays[i].Target);
+		});
+	}
+
+	BoundingOrientedBox GetStaticRayBox(const MESH_INFO& staticObj)
+	{
+		// Object pass has always tested statics with yaw only.
+		auto pose = Pose(staticObj.pos.Position, EulerAngles(0, staticObj.pos.Orientation.y, 0));
+		return GetBoundsAccurate(staticObj, false).ToBoundingOrientedBox(pose);
+	}
+
+	// Collects statics in room whose bounds ray may hit within dist.
+	void RaycastController::GetStatics(int roomNumber, const Vector3& origin, const Vector3& dir, float dist, std::vector<MESH_INFO*>& staticPtrs) const
+	{
+		auto& room = g_Level.Rooms[roomNumber];
+
+		if (!_isEnabled || roomNumber >= _rooms.size())
+		{
+			for (auto& staticObj : room.mesh)
+				staticPtrs.push_back(&staticObj);
+
+			return;
+		}
+
+		const auto& bvh = _rooms[roomNumber];
+		if (bvh.Nodes.empty())
+			return;
+
+		auto stack = std::array<int, 64>{};
+		int stackSize = 0;
+		stack[stackSize++] = 0;
+
+		while (stackSize > 0)
+		{
+			const auto& node = bvh.Nodes[stack[--stackSize]];
+
+			float intersectDist = 0.0f;
+			if (!node.Box.Contains(origin) &&
+				(!node.Box.Intersects(origin, dir, intersectDist) || intersectDist > dist))
+			{
+				continue;
+			}
+
+			if (node.Count > 0)
+			{
+				for (int i = 0; i < node.Count; i++)
+					staticPtrs.push_back(&room.mesh[bvh.StaticIndices[node.FirstIndex + i]]);
+			}
+			else if ((stackSize + 2) <= stack.size())
+			{
+				stack[stackSize++] = node.FirstIndex;
+				stack[stackSize++] = node.FirstIndex + 1;
+			}
+		}
+	}
+
+	const std::vector<RoomRay>& RaycastController::GetRecordedRays() const
+	{
+		return _recordedRays;
+	}
+
+	void RaycastController::SetEnabled(bool value)
+	{
+		_isEnabled = value;
+	}
+
+	void RaycastController::SetRecording(bool value)
+	{
+		_isRecording = value;
+	}
+
+	bool RaycastController::IsEnabled() const
+	{
+		return _isEnabled;
+	}
+
+	void RaycastController::Initialize()
+	{
+		_rooms.clear();
+		_rooms.resize(g_Level.Rooms.size());
+		_recordedRays.clear();
+
+		for (int roomNumber = 0; roomNumber < g_Level.Rooms.size(); roomNumber++)
+			RebuildRoom(roomNumber);
+	}
+
+	void RaycastController::Deinitialize()
+	{
+		_rooms.clear();
+		_recordedRays.clear();
+	}
+
+	void RaycastController::RebuildRoom(int roomNumber)
+	{
+		if (roomNumber < 0 || roomNumber >= _rooms.size())
+			return;
+
+		const auto& room = g_Level.Rooms[roomNumber];
+		auto& bvh = _rooms[roomNumber];
+
+		bvh = RoomBvh{};
+		if (room.mesh.empty())
+			return;
+
+		auto boxes = std::vector<BoundingBox>{};
+		boxes.reserve(room.mesh.size());
+
+		for (int i = 0; i < room.mesh.size(); i++)
+		{
+			auto corners = std::array<Vector3, 8>{};
+			GetStaticRayBox(room.mesh[i]).GetCorners(corners.data());
+
+			auto box = BoundingBox{};
+			BoundingBox::CreateFromPoints(box, corners.size(), corners.data(), sizeof(Vector3));
+
+			boxes.push_back(box);
+			bvh.StaticIndices.push_back(i);
+		}
+
+		bvh.Nodes.reserve(room.mesh.size() * 2);
+		bvh.Nodes.push_back(BvhNode{});
+		BuildNode(bvh, boxes, 0, 0, (int)room.mesh.size());
+	}
+
+	void RaycastController::RecordRay(const GameVector& origin, const GameVector& target)
+	{
+		if (!_isRecording || _recordedRays.size() >= RECORDED_RAY_COUNT_MAX)
+			return;
+
+		_recordedRays.push_back(RoomRay{ origin, target });
+	}
+
+	// Median split along longest axis of box centers. Boxes are kept in same order as static indices.
+	void RaycastController::BuildNode(RoomBvh& bvh, std::vector<BoundingBox>& boxes, int nodeIndex, int start, int count)
+	{
+		auto bounds = boxes[start];
+		auto centerMin = Vector3(boxes[start].Center);
+		auto centerMax = centerMin;
+
+		for (int i = start + 1; i < (start + count); i++)
+		{
+			BoundingBox::CreateMerged(bounds, bounds, boxes[i]);
+			centerMin = Vector3::Min(centerMin, boxes[i].Center);
+			centerMax = Vector3::Max(centerMax, boxes[i].Center);
+		}
+
+		bvh.Nodes[nodeIndex].Box = bounds;
+
+		if (count <= LEAF_SIZE_MAX)
+		{
+			bvh.Nodes[nodeIndex].FirstIndex = start;
+			bvh.Nodes[nodeIndex].Count = count;
+			return;
+		}
+
+		auto extents = centerMax - centerMin;
+		int axis = (extents.x >= extents.y && extents.x >= extents.z) ? 0 : ((extents.y >= extents.z) ? 1 : 2);
+
+		auto getAxisCenter = [axis](const BoundingBox& box)
+		{
+			return ((axis == 0) ? box.Center.x : ((axis == 1) ? box.Center.y : box.Center.z));
+		};
+
+		// Sort index range by center along axis, then split at median.
+		auto order = std::vector<int>(count);
+		for (int i = 0; i < count; i++)
+			order[i] = start + i;
+
+		int half = count / 2;
+		std::nth_element(order.begin(), order.begin() + half, order.end(), [&](int a, int b)
+		{
+			return (getAxisCenter(boxes[a]) < getAxisCenter(boxes[b]));
+		});
+
+		auto sortedBoxes = std::vector<BoundingBox>(count);
+		auto sortedIndices = std::vector<int>(count);
+		for (int i = 0; i < count; i++)
+		{
+			sortedBoxes[i] = boxes[order[i]];
+			sortedIndices[i] = bvh.StaticIndices[order[i]];
+		}
+
+		std::copy(sortedBoxes.begin(), sortedBoxes.end(), boxes.begin() + start);
+		std::copy(sortedIndices.begin(), sortedIndices.end(), bvh.StaticIndices.begin() + start);
+
+		// Children are allocated as pair, so right child is always FirstIndex + 1.
+		int childIndex = (int)bvh.Nodes.size();
+		bvh.Nodes[nodeIndex].FirstIndex = childIndex;
+		bvh.Nodes[nodeIndex].Count = 0;
+		bvh.Nodes.push_back(BvhNode{});
+		bvh.Nodes.push_back(BvhNode{});
+
+		BuildNode(bvh, boxes, childIndex, start, half);
+		BuildNode(bvh, boxes, childIndex + 1, start + half, count - half);
+	}
+
+	// Replays LOS queries recorded during headless run against level still loaded, comparing legacy axis stepping,
+	// sector raycaster called per ray, and sector raycaster batch.
+	std::string ReplayRecordedRays()
+	{
+		constexpr auto PASS_COUNT = 10;
+
+		g_Raycast.SetRecording(false);
+
+		auto rays = g_Raycast.GetRecordedRays();
+		if (rays.empty())
+			return "LOS replay: no queries recorded.\n";
+
+		auto legacyTargets = std::vector<GameVector>(rays.size());
+		auto legacyResults = std::vector<char>(rays.size());
+		auto rayTargets = std::vector<GameVector>(rays.size());
+		auto rayResults = std::vector<char>(rays.size());
+		auto batchHits = std::vector<RoomRayHit>{};
+
+		bool isEnabled = g_Raycast.IsEnabled();
+
+		auto startTime = std::chrono::high_resolution_clock::now();
+		g_Raycast.SetEnabled(false);
+		for (int pass = 0; pass < PASS_COUNT; pass++)
+		{
+			for (int i = 0; i < rays.size(); i++)
+			{
+				legacyTargets[i] = rays[i].Target;
+				legacyResults[i] = LOS(&rays[i].Origin, &legacyTargets[i]);
+			}
+		}
+
+		auto legacyEndTime = std::chrono::high_resolution_clock::now();
+		g_Raycast.SetEnabled(true);
+		for (int pass = 0; pass < PASS_COUNT; pass++)
+		{
+			for (int i = 0; i < rays.size(); i++)
+			{
+				rayTargets[i] = rays[i].Target;
+				rayResults[i] = LOS(&rays[i].Origin, &rayTargets[i]);
+			}
+		}
+
+		auto rayEndTime = std::chrono::high_resolution_clock::now();
+		for (int pass = 0; pass < PASS_COUNT; pass++)
+			CastRoomRays(rays, batchHits);
+
+		auto batchEndTime = std::chrono::high_resolution_clock::now();
+		g_Raycast.SetEnabled(isEnabled);
+
+		// Compare visibility and hit positions of rays blocked in both.
+		int agreeCount = 0;
+		int blockedCount = 0;
+		double deviationSum = 0.0;
+		float maxDeviation = 0.0f;
+		for (int i = 0; i < rays.size(); i++)
+		{
+			if (legacyResults[i] == rayResults[i])
+				agreeCount++;
+
+			if (!legacyResults[i] && !rayResults[i])
+			{
+				float deviation = Vector3::Distance(legacyTargets[i].ToVector3(), rayTargets[i].ToVector3());
+				deviationSum += deviation;
+				maxDeviation = std::max(maxDeviation, deviation);
+				blockedCount++;
+			}
+		}
+
+		double legacyTime = std::chrono::duration<double, std::milli>(legacyEndTime - startTime).count() / PASS_COUNT;
+		double rayTime = std::chrono::duration<double, std::milli>(rayEndTime - legacyEndTime).count() / PASS_COUNT;
+		double batchTime = std::chrono::duration<double, std::milli>(batchEndTime - rayEndTime).count() / PASS_COUNT;
+
+		auto stream = std::ostringstream();
+		stream << std::fixed << std::setprecision(3);
+		stream << "LOS replay: " << rays.size() << " queries, passes: " << PASS_COUNT << std::endl;
+		stream << "Legacy xLOS/zLOS (ms/pass): " << legacyTime << " (" << ((legacyTime * 1000000.0) / rays.size()) << " ns/ray)" << std::endl;
+		stream << "Sector raycast (ms/pass): " << rayTime << " (" << ((rayTime * 1000000.0) / rays.size()) << " ns/ray)" << std::endl;
+		stream << "Sector raycast batch (ms/pass): " << batchTime << " (" << ((batchTime * 1000000.0) / rays.size()) << " ns/ray)" << std::endl;
+		stream << "Visibility agreement: " << ((agreeCount * 100.0) / rays.size()) << "%" << std::endl;
+		stream << "Hit deviation (blocked in both): mean " << (blockedCount ? (deviationSum / blockedCount) : 0.0) << ", max " << maxDeviation << std::endl;
+
+		return stream.str();
+	}
+}
@@ -0,0 +1,86 @@
+#pragma once
+#include "Math/Math.h"
+
+struct MESH_INFO;
+
+namespace TEN::Collision::Raycast
+{
+	constexpr auto RAY_ROOM_COUNT_MAX = 32;
+
+	struct RoomRay
+	{
+		GameVector Origin = {};
+		GameVector Target = {};
+	};
+
+	struct RoomRayHit
+	{
+		bool	   IsBlocked = false;
+		GameVector Position	 = {}; // Last clear position before blocking surface, or target if ray is clear.
+
+		int									RoomCount	= 0; // Rooms traversed up to position, in traversal order.
+		std::array<int, RAY_ROOM_COUNT_MAX> RoomNumbers = {};
+	};
+
+	// Per-room bounding volume hierarchies of static bounds used by object pass of line-of-sight tests.
+	// Items are not stored, as they move every frame and rooms hold few of them. Object pass scans room item lists instead.
+	class RaycastController
+	{
+	private:
+		// Constants
+		static constexpr auto LEAF_SIZE_MAX			 = 4;
+		static constexpr auto RECORDED_RAY_COUNT_MAX = 1 << 16;
+
+		struct BvhNode
+		{
+			BoundingBox Box		   = {};
+			int			FirstIndex = 0; // First child node if inner node, first static index if leaf.
+			int			Count	   = 0; // Static count if leaf, 0 if inner node.
+		};
+
+		struct RoomBvh
+		{
+			std::vector<BvhNode> Nodes		   = {};
+			std::vector<int>	 StaticIndices = {};
+		};
+
+		// Members
+		bool				 _isEnabled	   = true;
+		bool				 _isRecording  = false;
+		std::vector<RoomBvh> _rooms		   = {};
+		std::vector<RoomRay> _recordedRays = {}; // LOS queries kept for benchmark replay.
+
+	public:
+		// Getters
+		void GetStatics(int roomNumber, const Vector3& origin, const Vector3& dir, float dist, std::vector<MESH_INFO*>& staticPtrs) const;
+
+		const std::vector<RoomRay>& GetRecordedRays() const;
+
+		// Setters
+		void SetEnabled(bool value);
+		void SetRecording(bool value);
+
+		// Inquirers
+		bool IsEnabled() const;
+
+		// Utilities
+		void Initialize();
+		void Deinitialize();
+		void RebuildRoom(int roomNumber);
+		void RecordRay(const GameVector& origin, const GameVector& target);
+
+	private:
+		// Helpers
+		void BuildNode(RoomBvh& bvh, std::vector<BoundingBox>& boxes, int nodeIndex, int start, int count);
+	};
+
+	extern RaycastController g_Raycast;
+
+	// Reentrant sector raycasts. Safe to call from job workers while room geometry isn't modified.
+	RoomRayHit CastRoomRay(const GameVector& origin, const GameVector& target);
+	void	   CastRoomRays(const std::vector<RoomRay>& rays, std::vector<RoomRayHit>& hits);
+
+	BoundingOrientedBox GetStaticRayBox(const MESH_INFO& staticObj);
+
+	std::string ReplayRecordedRays();
+}
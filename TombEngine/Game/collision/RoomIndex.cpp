@@ -0,0 +1,243 @@
+#include "framework.h"
+#include "Game/collision/RoomIndex.h"
+
+#include <chrono>
+#include <iomanip>
+#include <sstream>
+
+#include "Game/room.h"
+#include "Specific/level.h"
+
+using namespace TEN::Math;
+
+namespace TEN::Collision::RoomIndex
+{
+	RoomIndexController g_RoomIndex = {};
+
+	RoomRange RoomIndexController::GetRooms(int x, int z) const
+	{
+		if (_cellOffsets.empty())
+			return RoomRange{};
+
+		int cellX = GetCellX(x);
+		int cellZ = GetCellZ(z);
+		if (cellX < 0 || cellX >= _cellCountX ||
+			cellZ < 0 || cellZ >= _cellCountZ)
+		{
+			return RoomRange{};
+		}
+
+		int cellIndex = cellX + (cellZ * _cellCountX);
+		return RoomRange{ _roomNumbers.data() + _cellOffsets[cellIndex], _roomNumbers.data() + _cellOffsets[cellIndex + 1] };
+	}
+
+	// Returns first active room containing position, or NO_VALUE if none.
+	int RoomIndexController::GetRoomNumber(const Vector3i& pos) const
+	{
+		for (int roomNumber : GetRooms(pos.x, pos.z))
+		{
+			if (IsPointInRoom(pos, roomNumber) && g_Level.Rooms[roomNumber].Active())
+				return roomNumber;
+		}
+
+		return NO_VALUE;
+	}
+
+	void RoomIndexController::Initialize()
+	{
+		Deinitialize();
+
+		if (g_Level.Rooms.empty())
+			return;
+
+		// Map each flipped room back to its original room.
+		auto flipSourceRooms = std::vector<int>(g_Level.Rooms.size(), NO_VALUE);
+		for (int roomNumber = 0; roomNumber < g_Level.Rooms.size(); roomNumber++)
+		{
+			int flippedRoomNumber = g_Level.Rooms[roomNumber].flippedRoom;
+			if (flippedRoomNumber >= 0 && flippedRoomNumber < g_Level.Rooms.size())
+				flipSourceRooms[flippedRoomNumber] = roomNumber;
+		}
+
+		int minX = INT_MAX;
+		int minZ = INT_MAX;
+		int maxX = INT_MIN;
+		int maxZ = INT_MIN;
+
+		for (const auto& room : g_Level.Rooms)
+		{
+			minX = std::min(minX, room.x);
+			minZ = std::min(minZ, room.z);
+			maxX = std::max(maxX, room.x + BLOCK(room.xSize));
+			maxZ = std::max(maxZ, room.z + BLOCK(room.zSize));
+		}
+
+		_originX = minX;
+		_originZ = minZ;
+		_cellCountX = ((maxX - minX) / CELL_SIZE) + 1;
+		_cellCountZ = ((maxZ - minZ) / CELL_SIZE) + 1;
+
+		// Flipmaps swap room data between room numbers, so both rooms of flipped pair cover union of their footprints.
+		auto getFootprint = [&](int roomNumber)
+		{
+			const auto& room = g_Level.Rooms[roomNumber];
+			auto footprint = std::array<int, 4>{ room.x, room.z, room.x + BLOCK(room.xSize), room.z + BLOCK(room.zSize) };
+
+			for (int otherRoomNumber : { room.flippedRoom, flipSourceRooms[roomNumber] })
+			{
+				if (otherRoomNumber < 0 || otherRoomNumber >= g_Level.Rooms.size())
+					continue;
+
+				const auto& otherRoom = g_Level.Rooms[otherRoomNumber];
+				footprint[0] = std::min(footprint[0], otherRoom.x);
+				footprint[1] = std::min(footprint[1], otherRoom.z);
+				footprint[2] = std::max(footprint[2], otherRoom.x + BLOCK(otherRoom.xSize));
+				footprint[3] = std::max(footprint[3], otherRoom.z + BLOCK(otherRoom.zSize));
+			}
+
+			return footprint;
+		};
+
+		// Count rooms per cell first, then fill flat list in room order so each cell stays sorted.
+		auto cellCounts = std::vector<int>(_cellCountX * _cellCountZ, 0);
+		auto forEachCell = [&](int roomNumber, const std::function<void(int)>& func)
+		{
+			auto footprint = getFootprint(roomNumber);
+			int cellXMin = GetCellX(footprint[0]);
+			int cellZMin = GetCellZ(footprint[1]);
+			int cellXMax = GetCellX(footprint[2]);
+			int cellZMax = GetCellZ(footprint[3]);
+
+			for (int cellZ = cellZMin; cellZ <= cellZMax; cellZ++)
+			{
+				for (int cellX = cellXMin; cellX <= cellXMax; cellX++)
+					func(cellX + (cellZ * _cellCountX));
+			}
+		};
+
+		for (int roomNumber = 0; roomNumber < g_Level.Rooms.size(); roomNumber++)
+			forEachCell(roomNumber, [&](int cellIndex) { cellCounts[cellIndex]++; });
+
+		_cellOffsets.resize(cellCounts.size() + 1);
+		_cellOffsets[0] = 0;
+		for (int i = 0; i < cellCounts.size(); i++)
+			_cellOffsets[i + 1] = _cellOffsets[i] + cellCounts[i];
+
+		_roomNumbers.resize(_cellOffsets.back());
+		auto cellCursors = std::vector<int>(_cellOffsets.begin(), _cellOffsets.end() - 1);
+
+		for (int roomNumber = 0; roomNumber < g_Level.Rooms.size(); roomNumber++)
+			forEachCell(roomNumber, [&](int cellIndex) { _roomNumbers[cellCursors[cellIndex]++] = roomNumber; });
+	}
+
+	void RoomIndexController::Deinitialize()
+	{
+		_originX = 0;
+		_originZ = 0;
+		_cellCountX = 0;
+		_cellCountZ = 0;
+		_cellOffsets.clear();
+		_roomNumbers.clear();
+	}
+
+	int RoomIndexController::GetCellX(int x) const
+	{
+		return (int)floor((x - _originX) / (float)CELL_SIZE);
+	}
+
+	int RoomIndexController::GetCellZ(int z) const
+	{
+		return (int)floor((z - _originZ) / (float)CELL_SIZE);
+	}
+
+	std::string RunRoomBenchmark()
+	{
+		constexpr auto ROOM_COUNT_X	 = 24;
+		constexpr auto ROOM_COUNT_Z	 = 24;
+		constexpr auto ROOM_SIZE	 = 8; // In blocks.
+		constexpr auto ROOM_HEIGHT	 = BLOCK(4);
+		constexpr auto LAYER_COUNT	 = 2;
+		constexpr auto QUERY_COUNT	 = 100000;
+
+		// Synthetic level: stacked layers of rooms on regular grid. Real level rooms are swapped out and restored afterwards.
+		auto levelRooms = std::vector<ROOM_INFO>{};
+		std::swap(levelRooms, g_Level.Rooms);
+
+		for (int layer = 0; layer < LAYER_COUNT; layer++)
+		{
+			for (int roomZ = 0; roomZ < ROOM_COUNT_Z; roomZ++)
+			{
+				for (int roomX = 0; roomX < ROOM_COUNT_X; roomX++)
+				{
+					auto room = ROOM_INFO{};
+					room.index = (int)g_Level.Rooms.size();
+					room.x = BLOCK(roomX * (ROOM_SIZE - 2));
+					room.z = BLOCK(roomZ * (ROOM_SIZE - 2));
+					room.y = 0;
+					room.xSize = ROOM_SIZE;
+					room.zSize = ROOM_SIZE;
+					room.minfloor = -(layer * ROOM_HEIGHT);
+					room.maxceiling = room.minfloor - ROOM_HEIGHT;
+					room.flipNumber = NO_VALUE;
+					room.flippedRoom = NO_VALUE;
+					g_Level.Rooms.push_back(room);
+				}
+			}
+		}
+
+		auto positions = std::vector<Vector3i>(QUERY_COUNT);
+		for (auto& pos : positions)
+		{
+			pos = Vector3i(
+				Random::GenerateInt(0, BLOCK(ROOM_COUNT_X * (ROOM_SIZE - 2))),
+				Random::GenerateInt(-(ROOM_HEIGHT * LAYER_COUNT), 0),
+				Random::GenerateInt(0, BLOCK(ROOM_COUNT_Z * (ROOM_SIZE - 2))));
+		}
+
+		auto startTime = std::chrono::high_resolution_clock::now();
+		g_RoomIndex.Initialize();
+		auto buildEndTime = std::chrono::high_resolution_clock::now();
+
+		// Previous linear scan over all rooms.
+		auto linearResults = std::vector<int>(QUERY_COUNT, NO_VALUE);
+		for (int i = 0; i < QUERY_COUNT; i++)
+		{
+			for (int roomNumber = 0; roomNumber < g_Level.Rooms.size(); roomNumber++)
+			{
+				if (IsPointInRoom(positions[i], roomNumber) && g_Level.Rooms[roomNumber].Active())
+				{
+					linearResults[i] = roomNumber;
+					break;
+				}
+			}
+		}
+
+		auto linearEndTime = std::chrono::high_resolution_clock::now();
+
+		int mismatchCount = 0;
+		for (int i = 0; i < QUERY_COUNT; i++)
+		{
+			if (g_RoomIndex.GetRoomNumber(positions[i]) != linearResults[i])
+				mismatchCount++;
+		}
+
+		auto indexEndTime = std::chrono::high_resolution_clock::now();
+
+		double buildTime = std::chrono::duration<double, std::milli>(buildEndTime - startTime).count();
+		double linearTime = std::chrono::duration<double, std::milli>(linearEndTime - buildEndTime).count();
+		double indexTime = std::chrono::duration<double, std::milli>(indexEndTime - linearEndTime).count();
+
+		auto stream = std::ostringstream();
+		stream << std::fixed << std::setprecision(3);
+		stream << "Rooms: " << g_Level.Rooms.size() << ", queries: " << QUERY_COUNT << std::endl;
+		stream << "Index build (ms): " << buildTime << std::endl;
+		stream << "Linear scan (ms): " << linearTime << " (" << ((linearTime * 1000000.0) / QUERY_COUNT) << " ns/query)" << std::endl;
+		stream << "Room index (ms):  " << indexTime << " (" << ((indexTime * 1000000.0) / QUERY_COUNT) << " ns/query)" << std::endl;
+		stream << "Mismatches: " << mismatchCount << std::endl;
+
+		std::swap(levelRooms, g_Level.Rooms);
+		g_RoomIndex.Initialize();
+
+		return stream.str();
+	}
+}
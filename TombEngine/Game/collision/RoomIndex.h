@@ -0,0 +1,51 @@
+#pragma once
+#include "Math/Math.h"
+
+namespace TEN::Collision::RoomIndex
+{
+	struct RoomRange
+	{
+		const int* First = nullptr;
+		const int* Last	 = nullptr;
+
+		const int* begin() const { return First; }
+		const int* end() const { return Last; }
+	};
+
+	// Uniform world-space grid over room footprints for point-to-room queries. Flipped and original
+	// rooms are both indexed, so flipmap state is checked on query and the grid is built only once per level.
+	// Each cell lists overlapping rooms in ascending order, matching results of linear scan over all rooms.
+	class RoomIndexController
+	{
+	private:
+		// Constants
+		static constexpr auto CELL_SIZE = BLOCK(4);
+
+		// Members
+		int _originX	= 0;
+		int _originZ	= 0;
+		int _cellCountX = 0;
+		int _cellCountZ = 0;
+
+		std::vector<int> _cellOffsets = {}; // Start of each cell's list in _roomNumbers, plus end sentinel.
+		std::vector<int> _roomNumbers = {};
+
+	public:
+		// Getters
+		RoomRange GetRooms(int x, int z) const;
+		int		  GetRoomNumber(const Vector3i& pos) const;
+
+		// Utilities
+		void Initialize();
+		void Deinitialize();
+
+	private:
+		// Helpers
+		int GetCellX(int x) const;
+		int GetCellZ(int z) const;
+	};
+
+	extern RoomIndexController g_RoomIndex;
+
+	std::string RunRoomBenchmark();
+}
@@ -3,6 +3,7 @@
 
 #include "Game/animation.h"
 #include "Game/control/los.h"
+#include "Game/collision/BroadPhase.h"
 #include "Game/collision/collide_room.h"
 #include "Game/collision/sphere.h"
 #include "Game/effects/debris.h"
@@ -20,7 +21,9 @@
 #include "Scripting/Include/ScriptInterfaceGame.h"
 #include "Sound/sound.h"
 
+using namespace TEN::Collision::BroadPhase;
 using namespace TEN::Math;
+using namespace TEN::Memory;
 using namespace TEN::Renderer;
 
 constexpr auto ANIMATED_ALIGNMENT_FRAME_COUNT_THRESHOLD = 6;
@@ -119,6 +122,10 @@ CollidedObjectData GetCollidedObjects(ItemInfo& collidingItem, bool onlyVisible,
 	if (collidingSphere.Radius <= EXTENTS_LENGTH_MIN)
 		return collObjects;
 
+	auto queryCenter = Vector3i(collidingSphere.Center);
+	auto itemNumbers = ArenaVector<int>{};
+	auto staticPtrs = ArenaVector<MESH_INFO*>{};
+
 	// Run through neighboring rooms.
 	const auto& room = g_Level.Rooms[collidingItem.RoomNumber];
 	for (int roomNumber : room.neighbors)
@@ -131,78 +138,75 @@ CollidedObjectData GetCollidedObjects(ItemInfo& collidingItem, bool onlyVisible,
 		if (mode == ObjectCollectionMode::All ||
 			mode == ObjectCollectionMode::Items)
 		{
-			int itemNumber = neighborRoom.itemNumber;
-			if (itemNumber != NO_VALUE)
-			{
-				do
-				{
-					auto& item = g_Level.Items[itemNumber];
-					const auto& object = Objects[item.ObjectNumber];
+			// Gather broad-phase candidates which may intersect colliding circle.
+			itemNumbers.clear();
+			g_BroadPhase.GetItems(roomNumber, queryCenter, collidingCircle.z, itemNumbers);
 
-					itemNumber = item.NextItem;
+			for (int itemNumber : itemNumbers)
+			{
+				auto& item = g_Level.Items[itemNumber];
+				const auto& object = Objects[item.ObjectNumber];
 
-					// Ignore player (if applicable).
-					if (ignorePlayer && item.IsLara())
-						continue;
+				// Ignore player (if applicable).
+				if (ignorePlayer && item.IsLara())
+					continue;
 
-					// Ignore invisible item (if applicable).
-					if (onlyVisible && item.Status == ITEM_INVISIBLE)
-						continue;
+				// Ignore invisible item (if applicable).
+				if (onlyVisible && item.Status == ITEM_INVISIBLE)
+					continue;
 
-					// Ignore items not feasible for collision.
-					if (item.Index == collidingItem.Index ||
-						item.Flags & IFLAG_KILLED || item.MeshBits == NO_JOINT_BITS ||
-						(object.drawRoutine == nullptr && !item.IsLara()) ||
-						(object.collision == nullptr && !item.IsLara()))
-					{
-						continue;
-					}
+				// Ignore items not feasible for collision.
+				if (item.Index == collidingItem.Index ||
+					item.Flags & IFLAG_KILLED || item.MeshBits == NO_JOINT_BITS ||
+					(object.drawRoutine == nullptr && !item.IsLara()) ||
+					(object.collision == nullptr && !item.IsLara()))
+				{
+					continue;
+				}
 
-					// HACK: Ignore UPV and big gun.
-					if ((item.ObjectNumber == ID_UPV || item.ObjectNumber == ID_BIGGUN) && item.HitPoints == 1)
-						continue;
+				// HACK: Ignore UPV and big gun.
+				if ((item.ObjectNumber == ID_UPV || item.ObjectNumber == ID_BIGGUN) && item.HitPoints == 1)
+					continue;
 
-					// Test rough distance to discard objects more than 6 blocks away.
-					float dist = Vector3i::Distance(item.Pose.Position, collidingItem.Pose.Position);
-					if (dist > COLLISION_CHECK_DISTANCE)
-						continue;
+				// Test rough distance to discard objects more than 6 blocks away.
+				float dist = Vector3i::Distance(item.Pose.Position, collidingItem.Pose.Position);
+				if (dist > COLLISION_CHECK_DISTANCE)
+					continue;
 
-					const auto& bounds = GetBestFrame(item).BoundingBox;
-					auto extents = bounds.GetExtents();
+				const auto& bounds = GetBestFrame(item).BoundingBox;
+				auto extents = bounds.GetExtents();
 
-					// If item bounding box extents is below tolerance threshold, discard object.
-					if (extents.Length() <= EXTENTS_LENGTH_MIN)
-						continue;
+				// If item bounding box extents is below tolerance threshold, discard object.
+				if (extents.Length() <= EXTENTS_LENGTH_MIN)
+					continue;
 
-					// Test rough vertical distance to discard objects not intersecting vertically.
-					if (((collidingItem.Pose.Position.y + collidingBounds.Y1) - ROUGH_BOX_HEIGHT_MIN) >
-						((item.Pose.Position.y + bounds.Y2) + ROUGH_BOX_HEIGHT_MIN))
-					{
-						continue;
-					}
-					if (((collidingItem.Pose.Position.y + collidingBounds.Y2) + ROUGH_BOX_HEIGHT_MIN) <
-						((item.Pose.Position.y + bounds.Y1) - ROUGH_BOX_HEIGHT_MIN))
-					{
-						continue;
-					}
+				// Test rough vertical distance to discard objects not intersecting vertically.
+				if (((collidingItem.Pose.Position.y + collidingBounds.Y1) - ROUGH_BOX_HEIGHT_MIN) >
+					((item.Pose.Position.y + bounds.Y2) + ROUGH_BOX_HEIGHT_MIN))
+				{
+					continue;
+				}
+				if (((collidingItem.Pose.Position.y + collidingBounds.Y2) + ROUGH_BOX_HEIGHT_MIN) <
+					((item.Pose.Position.y + bounds.Y1) - ROUGH_BOX_HEIGHT_MIN))
+				{
+					continue;
+				}
 
-					// Test rough circle intersection to discard objects not intersecting horizontally.
-					auto circle = Vector3(item.Pose.Position.x, item.Pose.Position.z, std::hypot(extents.x, extents.z));
-					if (!Geometry::CircleIntersects(circle, collidingCircle))
-						continue;
+				// Test rough circle intersection to discard objects not intersecting horizontally.
+				auto circle = Vector3(item.Pose.Position.x, item.Pose.Position.z, std::hypot(extents.x, extents.z));
+				if (!Geometry::CircleIntersects(circle, collidingCircle))
+					continue;
 
-					auto box0 = bounds.ToBoundingOrientedBox(item.Pose);
-					auto box1 = collidingBounds.ToBoundingOrientedBox(collidingItem.Pose);
+				auto box0 = bounds.ToBoundingOrientedBox(item.Pose);
+				auto box1 = collidingBounds.ToBoundingOrientedBox(collidingItem.Pose);
 
-					// Override extents if specified.
-					if (customRadius > 0.0f)
-						box1.Extents = Vector3(customRadius);
+				// Override extents if specified.
+				if (customRadius > 0.0f)
+					box1.Extents = Vector3(customRadius);
 
-					// Test accurate box intersection.
-					if (box0.Intersects(box1))
-						collObjects.ItemPtrs.push_back(&item);
-				}
-				while (itemNumber != NO_VALUE);
+				// Test accurate box intersection.
+				if (box0.Intersects(box1))
+					collObjects.ItemPtrs.push_back(&item);
 			}
 		}
 
@@ -210,8 +214,13 @@ CollidedObjectData GetCollidedObjects(ItemInfo& collidingItem, bool onlyVisible,
 		if (mode == ObjectCollectionMode::All ||
 			mode == ObjectCollectionMode::Statics)
 		{
-			for (auto& staticObj : neighborRoom.mesh)
+			staticPtrs.clear();
+			g_BroadPhase.GetStatics(roomNumber, queryCenter, collidingCircle.z, staticPtrs);
+
+			for (auto* staticPtr : staticPtrs)
 			{
+				auto& staticObj = *staticPtr;
+
 				// Discard invisible statics.
 				if (!(staticObj.flags & StaticMeshFlags::SM_VISIBLE))
 					continue;
@@ -1802,6 +1811,9 @@ void DoObjectCollision(ItemInfo* item, CollisionInfo* coll)
 	if (Objects[item->ObjectNumber].intelligent)
 		return;
 
+	auto itemNumbers = ArenaVector<int>{};
+	auto staticPtrs = ArenaVector<MESH_INFO*>{};
+
 	const auto& room = g_Level.Rooms[item->RoomNumber];
 	for (int neighborRoomNumber : room.neighbors)
 	{
@@ -1809,17 +1821,12 @@ void DoObjectCollision(ItemInfo* item, CollisionInfo* coll)
 		if (!neighborRoom.Active())
 			continue;
 
-		int nextItemNumber = neighborRoom.itemNumber;
-		while (nextItemNumber != NO_VALUE)
-		{
-			auto& linkItem = g_Level.Items[nextItemNumber];
-			int itemNumber = nextItemNumber;
-
-			// HACK: For some reason, sometimes an infinite loop may happen here.
-			if (nextItemNumber == linkItem.NextItem)
-				break;
+		itemNumbers.clear();
+		g_BroadPhase.GetItems(neighborRoomNumber, item->Pose.Position, COLLISION_CHECK_DISTANCE, itemNumbers);
 
-			nextItemNumber = linkItem.NextItem;
+		for (int itemNumber : itemNumbers)
+		{
+			auto& linkItem = g_Level.Items[itemNumber];
 
 			if (&linkItem == item)
 				continue;
@@ -1887,8 +1894,13 @@ void DoObjectCollision(ItemInfo* item, CollisionInfo* coll)
 			}
 		}
 
-		for (auto& staticObject : neighborRoom.mesh)
+		staticPtrs.clear();
+		g_BroadPhase.GetStatics(neighborRoomNumber, item->Pose.Position, COLLISION_CHECK_DISTANCE, staticPtrs);
+
+		for (auto* staticPtr : staticPtrs)
 		{
+			auto& staticObject = *staticPtr;
+
 			if (!(staticObject.flags & StaticMeshFlags::SM_VISIBLE))
 				continue;
 
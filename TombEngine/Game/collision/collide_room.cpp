@@ -4,6 +4,7 @@
 #include "Game/control/box.h"
 #include "Game/control/los.h"
 #include "Game/collision/collide_item.h"
+#include "Game/collision/CollisionCache.h"
 #include "Game/animation.h"
 #include "Game/Lara/lara.h"
 #include "Game/items.h"
@@ -12,6 +13,7 @@
 #include "Sound/sound.h"
 #include "Renderer/Renderer.h"
 
+using namespace TEN::Collision::CollisionCache;
 using namespace TEN::Collision::Floordata;
 using namespace TEN::Math;
 using namespace TEN::Renderer;
@@ -216,6 +218,11 @@ CollisionResult GetCollision(FloorInfo* floor, int x, int y, int z)
 {
 	auto result = CollisionResult{};
 
+	// Identical probes within same frame are served from cache.
+	auto* sector = floor;
+	if (g_CollisionCache.Find(sector, Vector3i(x, y, z), result))
+		return result;
+
 	// Record coordinates.
 	result.Coordinates = Vector3i(x, y, z);
 
@@ -227,10 +234,12 @@ CollisionResult GetCollision(FloorInfo* floor, int x, int y, int z)
 	result.Position.Ceiling = GetSurfaceHeight(RoomVector(floor->RoomNumber, y), x, z, false).value_or(NO_HEIGHT);
 
 	// Probe bottom collision block through portals.
-	while (floor->GetNextRoomNumber(Vector3i(x, y, z), true).has_value())
+	auto nextRoomNumber = floor->GetNextRoomNumber(Vector3i(x, y, z), true);
+	while (nextRoomNumber.has_value())
 	{
-		auto* room = &g_Level.Rooms[floor->GetNextRoomNumber(Vector3i(x, y, z), true).value_or(floor->RoomNumber)];
+		auto* room = &g_Level.Rooms[*nextRoomNumber];
 		floor = GetSector(room, x - room->x, z - room->z);
+		nextRoomNumber = floor->GetNextRoomNumber(Vector3i(x, y, z), true);
 	}
 
 	// Return probed bottom collision block into result.
@@ -253,6 +262,7 @@ CollisionResult GetCollision(FloorInfo* floor, int x, int y, int z)
 	result.Position.CeilingSlope = Geometry::GetSurfaceSlopeAngle(result.CeilingNormal, -Vector3::UnitY) >=
 		result.BottomBlock->GetSurfaceIllegalSlopeAngle(x, z, false); // TODO: Fix on bridges placed beneath ceiling slopes. @Sezz 2022.01.29
 
+	g_CollisionCache.Insert(sector, Vector3i(x, y, z), result);
 	return result;
 }
 
@@ -1,6 +1,7 @@
 #include "framework.h"
 #include "Game/collision/floordata.h"
 #include "Game/collision/collide_room.h"
+#include "Game/collision/CollisionCache.h"
 #include "Game/items.h"
 #include "Game/room.h"
 #include "Game/Setup.h"
@@ -10,12 +11,117 @@
 #include "Specific/level.h"
 #include "Specific/trutils.h"
 
+using namespace TEN::Collision::CollisionCache;
 using namespace TEN::Collision::Floordata;
 using namespace TEN::Entities::Generic;
 using namespace TEN::Math;
 using namespace TEN::Utils;
 using namespace TEN::Renderer;
 
+static bool CompareBridgeItemNumber(const SectorBridgeData& bridgeData, int itemNumber)
+{
+	return (bridgeData.ItemNumber < itemNumber);
+}
+
+int SectorBridgeList::GetCount() const
+{
+	return _count;
+}
+
+bool SectorBridgeList::IsEmpty() const
+{
+	return (_count == 0);
+}
+
+void SectorBridgeList::Insert(const SectorBridgeData& bridgeData)
+{
+	auto* data = GetData();
+	auto* it = std::lower_bound(data, data + _count, bridgeData.ItemNumber, CompareBridgeItemNumber);
+
+	// Already exists; refresh extents.
+	if (it != (data + _count) && it->ItemNumber == bridgeData.ItemNumber)
+	{
+		*it = bridgeData;
+		return;
+	}
+
+	int index = int(it - data);
+
+	// Spill inline storage to overflow vector.
+	if (_count == INLINE_CAPACITY)
+		_overflowBridges.assign(_inlineBridges.begin(), _inlineBridges.end());
+
+	if (_count >= INLINE_CAPACITY)
+	{
+		_overflowBridges.insert(_overflowBridges.begin() + index, bridgeData);
+	}
+	else
+	{
+		std::move_backward(_inlineBridges.begin() + index, _inlineBridges.begin() + _count, _inlineBridges.begin() + _count + 1);
+		_inlineBridges[index] = bridgeData;
+	}
+
+	_count++;
+}
+
+bool SectorBridgeList::Erase(int itemNumber)
+{
+	auto* data = GetData();
+	auto* it = std::lower_bound(data, data + _count, itemNumber, CompareBridgeItemNumber);
+
+	if (it == (data + _count) || it->ItemNumber != itemNumber)
+		return false;
+
+	int index = int(it - data);
+
+	if (IsInline())
+	{
+		std::move(_inlineBridges.begin() + index + 1, _inlineBridges.begin() + _count, _inlineBridges.begin() + index);
+	}
+	else
+	{
+		_overflowBridges.erase(_overflowBridges.begin() + index);
+
+		// Move back to inline storage.
+		if (_overflowBridges.size() == INLINE_CAPACITY)
+		{
+			std::copy(_overflowBridges.begin(), _overflowBridges.end(), _inlineBridges.begin());
+			_overflowBridges.clear();
+		}
+	}
+
+	_count--;
+	return true;
+}
+
+const SectorBridgeData* SectorBridgeList::begin() const
+{
+	return (IsInline() ? _inlineBridges.data() : _overflowBridges.data());
+}
+
+const SectorBridgeData* SectorBridgeList::end() const
+{
+	return (begin() + _count);
+}
+
+bool SectorBridgeList::IsInline() const
+{
+	return (_count <= INLINE_CAPACITY);
+}
+
+SectorBridgeData* SectorBridgeList::GetData()
+{
+	return (IsInline() ? _inlineBridges.data() : _overflowBridges.data());
+}
+
+// Conservatively tests if bridge surfaces can lie within vertical range.
+static bool TestBridgeVerticalRange(const SectorBridgeData& bridgeData, int minHeight, int maxHeight)
+{
+	int bridgeHeight = g_Level.Items[bridgeData.ItemNumber].Pose.Position.y;
+	return ((bridgeHeight + bridgeData.TopOffset) <= maxHeight &&
+			(bridgeHeight + bridgeData.BottomOffset) >= minHeight);
+}
+
 int FloorInfo::GetSurfaceTriangleID(int x, int z, bool isFloor) const
 {
 	constexpr auto TRI_ID_0 = 0;
@@ -130,17 +236,25 @@ std::optional<int> FloorInfo::GetNextRoomNumber(const Vector3i& pos, bool isBelo
 	int ceilingHeight = GetSurfaceHeight(pos.x, pos.z, false);
 
 	// 2) Run through bridges in sector to test access to room below or above.
-	for (int itemNumber : BridgeItemNumbers)
+	for (const auto& bridgeData : Bridges)
 	{
-		const auto& bridgeItem = g_Level.Items[itemNumber];
+		// 2.1) Test if bridge can block access at all.
+		if (isBelow ?
+			!TestBridgeVerticalRange(bridgeData, std::max(pos.y, ceilingHeight), floorHeight) :
+			!TestBridgeVerticalRange(bridgeData, ceilingHeight, std::min(pos.y, floorHeight)))
+		{
+			continue;
+		}
+
+		const auto& bridgeItem = g_Level.Items[bridgeData.ItemNumber];
 		const auto& bridge = GetBridgeObject(bridgeItem);
 
-		// 2.1) Get bridge floor or ceiling height.
+		// 2.2) Get bridge floor or ceiling height.
 		auto bridgeSurfaceHeight = isBelow ? bridge.GetFloorHeight(bridgeItem, pos) : bridge.GetCeilingHeight(bridgeItem, pos);
 		if (!bridgeSurfaceHeight.has_value())
 			continue;
 
-		// 2.2) Test if bridge blocks access to room below or above.
+		// 2.3) Test if bridge blocks access to room below or above.
 		// TODO: Check for potential edge case inaccuracies.
 		if (isBelow ?
 			*bridgeSurfaceHeight >= pos.y : // Bridge floor height is below current position.
@@ -184,55 +298,79 @@ int FloorInfo::GetSurfaceHeight(int x, int z, bool isFloor) const
 }
 
 int FloorInfo::GetSurfaceHeight(const Vector3i& pos, bool isFloor) const
+{
+	auto heights = GetSurfaceHeightData(pos, isFloor, !isFloor);
+	return (isFloor ? heights.Floor : heights.Ceiling);
+}
+
+SectorSurfaceHeightData FloorInfo::GetSurfaceHeights(const Vector3i& pos) const
+{
+	return GetSurfaceHeightData(pos, true, true);
+}
+
+SectorSurfaceHeightData FloorInfo::GetSurfaceHeightData(const Vector3i& pos, bool testFloor, bool testCeiling) const
 {
 	// 1) Get sector floor and ceiling heights.
-	int floorHeight = GetSurfaceHeight(pos.x, pos.z, true);
-	int ceilingHeight = GetSurfaceHeight(pos.x, pos.z, false);
+	int sectorFloorHeight = GetSurfaceHeight(pos.x, pos.z, true);
+	int sectorCeilingHeight = GetSurfaceHeight(pos.x, pos.z, false);
+	auto heights = SectorSurfaceHeightData{ sectorFloorHeight, sectorCeilingHeight };
 
-	// 2) Run through bridges in sector to find potential closer surface height.
-	for (int itemNumber : BridgeItemNumbers)
+	// 2) Run through bridges in sector to find potential closer surface heights.
+	for (const auto& bridgeData : Bridges)
 	{
-		const auto& bridgeItem = g_Level.Items[itemNumber];
-		const auto& bridge = GetBridgeObject(bridgeItem);
-
-		// 2.1) Get bridge surface height.
-		auto bridgeSurfaceHeight = isFloor ? bridge.GetFloorHeight(bridgeItem, pos) : bridge.GetCeilingHeight(bridgeItem, pos);
-		if (!bridgeSurfaceHeight.has_value())
+		// 2.1) Test if bridge surfaces can be closer before querying them.
+		bool canAffectFloor = testFloor && TestBridgeVerticalRange(bridgeData, std::max(pos.y, sectorCeilingHeight), heights.Floor);
+		bool canAffectCeiling = testCeiling && TestBridgeVerticalRange(bridgeData, heights.Ceiling, std::min(pos.y, sectorFloorHeight));
+		if (!canAffectFloor && !canAffectCeiling)
 			continue;
 
-		// 2.2) Track closest floor or ceiling height.
-		if (isFloor)
+		const auto& bridgeItem = g_Level.Items[bridgeData.ItemNumber];
+		const auto& bridge = GetBridgeObject(bridgeItem);
+
+		// 2.2) Track closest floor height.
+		if (canAffectFloor)
 		{
+			auto bridgeFloorHeight = bridge.GetFloorHeight(bridgeItem, pos);
+
 			// Test if bridge floor height is closer.
-			if (*bridgeSurfaceHeight >= pos.y &&	   // Bridge floor height is below position.
-				*bridgeSurfaceHeight < floorHeight &&  // Bridge floor height is above current closest floor height.
-				*bridgeSurfaceHeight >= ceilingHeight) // Bridge ceiling height is below sector ceiling height.
+			if (bridgeFloorHeight.has_value() &&
+				*bridgeFloorHeight >= pos.y &&			   // Bridge floor height is below position.
+				*bridgeFloorHeight < heights.Floor &&	   // Bridge floor height is above current closest floor height.
+				*bridgeFloorHeight >= sectorCeilingHeight) // Bridge floor height is below sector ceiling height.
 			{
-				floorHeight = *bridgeSurfaceHeight;
+				heights.Floor = *bridgeFloorHeight;
 			}
 		}
-		else
+
+		// 2.3) Track closest ceiling height.
+		if (canAffectCeiling)
 		{
+			auto bridgeCeilingHeight = bridge.GetCeilingHeight(bridgeItem, pos);
+
 			// Test if bridge ceiling height is closer.
-			if (*bridgeSurfaceHeight <= pos.y &&		// Bridge ceiling height is above position.
-				*bridgeSurfaceHeight > ceilingHeight && // Bridge ceiling height is below current closest ceiling height.
-				*bridgeSurfaceHeight <= floorHeight)	// Bridge floor height is above sector floor height.
+			if (bridgeCeilingHeight.has_value() &&
+				*bridgeCeilingHeight <= pos.y &&		   // Bridge ceiling height is above position.
+				*bridgeCeilingHeight > heights.Ceiling &&  // Bridge ceiling height is below current closest ceiling height.
+				*bridgeCeilingHeight <= sectorFloorHeight) // Bridge ceiling height is above sector floor height.
 			{
-				ceilingHeight = *bridgeSurfaceHeight;
+				heights.Ceiling = *bridgeCeilingHeight;
 			}
 		}
 	}
 
-	// 3) Return floor or ceiling height. NOTE: Bridges considered.
-	return (isFloor ? floorHeight : ceilingHeight);
+	// 3) Return floor and ceiling heights. NOTE: Bridges considered.
+	return heights;
 }
 
 int FloorInfo::GetBridgeSurfaceHeight(const Vector3i& pos, bool isFloor) const
 {
 	// 1) Find and return intersected bridge floor or ceiling height (if applicable).
-	for (int itemNumber : BridgeItemNumbers)
+	for (const auto& bridgeData : Bridges)
 	{
-		const auto& bridgeItem = g_Level.Items[itemNumber];
+		if (!TestBridgeVerticalRange(bridgeData, pos.y, pos.y))
+			continue;
+
+		const auto& bridgeItem = g_Level.Items[bridgeData.ItemNumber];
 		const auto& bridge = GetBridgeObject(bridgeItem);
 
 		// 1.1) Get bridge floor and ceiling heights.
@@ -287,9 +425,12 @@ bool FloorInfo::IsWall(int x, int z) const
 int FloorInfo::GetInsideBridgeItemNumber(const Vector3i& pos, bool testFloorBorder, bool testCeilingBorder) const
 {
 	// 1) Find and return intersected bridge item number (if applicable).
-	for (int itemNumber : BridgeItemNumbers)
+	for (const auto& bridgeData : Bridges)
 	{
-		const auto& bridgeItem = g_Level.Items[itemNumber];
+		if (!TestBridgeVerticalRange(bridgeData, pos.y, pos.y))
+			continue;
+
+		const auto& bridgeItem = g_Level.Items[bridgeData.ItemNumber];
 		const auto& bridge = GetBridgeObject(bridgeItem);
 
 		// 1.1) Get bridge floor and ceiling heights.
@@ -302,7 +443,7 @@ int FloorInfo::GetInsideBridgeItemNumber(const Vector3i& pos, bool testFloorBord
 		if (pos.y > *floorHeight && // Position is below bridge floor height.
 			pos.y < *ceilingHeight) // Position is above bridge ceiling height.
 		{
-			return itemNumber;
+			return bridgeData.ItemNumber;
 		}
 
 		// TODO: Check what this does.
@@ -310,7 +451,7 @@ int FloorInfo::GetInsideBridgeItemNumber(const Vector3i& pos, bool testFloorBord
 		if ((testFloorBorder && pos.y == *floorHeight) ||	// Position matches floor height.
 			(testCeilingBorder && pos.y == *ceilingHeight)) // Position matches ceiling height.
 		{
-			return itemNumber;
+			return bridgeData.ItemNumber;
 		}
 	}
 
@@ -320,12 +461,19 @@ int FloorInfo::GetInsideBridgeItemNumber(const Vector3i& pos, bool testFloorBord
 
 void FloorInfo::AddBridge(int itemNumber)
 {
-	BridgeItemNumbers.insert(itemNumber);
+	AddBridge(GetSectorBridgeData(g_Level.Items[itemNumber]));
+}
+
+void FloorInfo::AddBridge(const SectorBridgeData& bridgeData)
+{
+	Bridges.Insert(bridgeData);
+	g_CollisionCache.Invalidate();
 }
 
 void FloorInfo::RemoveBridge(int itemNumber)
 {
-	BridgeItemNumbers.erase(itemNumber);
+	if (Bridges.Erase(itemNumber))
+		g_CollisionCache.Invalidate();
 }
 
 namespace TEN::Collision::Floordata
@@ -546,8 +694,9 @@ namespace TEN::Collision::Floordata
 			}
 		}
 
-		int floorHeight = sectorPtr->GetSurfaceHeight(pos, true);
-		int ceilingHeight = sectorPtr->GetSurfaceHeight(pos, false);
+		auto heights = sectorPtr->GetSurfaceHeights(pos);
+		int floorHeight = heights.Floor;
+		int ceilingHeight = heights.Ceiling;
 
 		pos.y = std::clamp(pos.y, std::min(floorHeight, ceilingHeight), std::max(floorHeight, ceilingHeight));
 
@@ -604,8 +753,9 @@ namespace TEN::Collision::Floordata
 			location.Height = sectorPtr->GetSurfaceHeight(pos.x, pos.z, !isBottom);
 		}
 
-		int floorHeight = sectorPtr->GetSurfaceHeight(Vector3i(pos.x, location.Height, pos.z), true);
-		int ceilingHeight = sectorPtr->GetSurfaceHeight(Vector3i(pos.x, location.Height, pos.z), false);
+		auto heights = sectorPtr->GetSurfaceHeights(Vector3i(pos.x, location.Height, pos.z));
+		int floorHeight = heights.Floor;
+		int ceilingHeight = heights.Ceiling;
 
 		location.Height = std::clamp(location.Height, std::min(ceilingHeight, floorHeight), std::max(ceilingHeight, floorHeight));
 
@@ -693,8 +843,10 @@ namespace TEN::Collision::Floordata
 		x += bridgeItem.Pose.Position.x;
 		z += bridgeItem.Pose.Position.z;
 
+		auto bridgeData = GetSectorBridgeData(bridgeItem);
+
 		auto* sectorPtr = &GetSideSector(bridgeItem.RoomNumber, x, z);
-		sectorPtr->AddBridge(itemNumber);
+		sectorPtr->AddBridge(bridgeData);
 
 		if (bridge.GetFloorBorder != nullptr)
 		{
@@ -706,7 +858,7 @@ namespace TEN::Collision::Floordata
 					break;
 
 				sectorPtr = &GetSideSector(*roomNumberAbove, x, z);
-				sectorPtr->AddBridge(itemNumber);
+				sectorPtr->AddBridge(bridgeData);
 			}
 		}
 		
@@ -720,7 +872,7 @@ namespace TEN::Collision::Floordata
 					break;
 
 				sectorPtr = &GetSideSector(*roomNumberBelow, x, z);
-				sectorPtr->AddBridge(itemNumber);
+				sectorPtr->AddBridge(bridgeData);
 			}
 		}
 	}
@@ -768,6 +920,31 @@ namespace TEN::Collision::Floordata
 		}
 	}
 
+	// Gets conservative vertical extents of bridge surfaces relative to bridge item's vertical position.
+	// Bridge height routines may offset surfaces from bounds (e.g. tilted bridges, raising blocks), hence the margin.
+	SectorBridgeData GetSectorBridgeData(const ItemInfo& item)
+	{
+		constexpr auto VERTICAL_MARGIN = BLOCK(2);
+
+		auto bounds = GameBoundingBox(&item);
+		auto box = bounds.ToBoundingOrientedBox(item.Pose);
+
+		auto corners = std::array<Vector3, 8>{};
+		box.GetCorners(corners.data());
+
+		float cornerMin = corners[0].y;
+		float cornerMax = corners[0].y;
+		for (const auto& corner : corners)
+		{
+			cornerMin = std::min(cornerMin, corner.y);
+			cornerMax = std::max(cornerMax, corner.y);
+		}
+
+		int topOffset = std::min({ (int)floor(cornerMin) - item.Pose.Position.y, bounds.Y1, -bounds.GetHeight(), 0 });
+		int bottomOffset = std::max({ (int)ceil(cornerMax) - item.Pose.Position.y, bounds.Y2, 0 });
+		return SectorBridgeData{ item.Index, topOffset - VERTICAL_MARGIN, bottomOffset + VERTICAL_MARGIN };
+	}
+
 	// Get precise floor/ceiling height from object's bounding box.
 	// Animated objects are also supported, although horizontal collision shifting is unstable.
 	// Method: get accurate bounds in world transform by converting to OBB, then do a ray test
@@ -862,6 +1039,26 @@ namespace TEN::Collision::Floordata
 		}
 	}
 
+	// Invalidates collision cache if bridge position, orientation or height changed since last check.
+	// Bridge surfaces are evaluated from item pose at query time, so controls may move bridge vertically
+	// without UpdateBridgeItem(); cached probes must not outlive such movement.
+	void UpdateBridgeItemPose(ItemInfo& item)
+	{
+		auto& bridge = GetBridgeObject(item);
+		auto bounds = GameBoundingBox(&item);
+
+		if (item.Pose == bridge.PrevPose &&
+			bounds.Y1 == bridge.PrevBoundsTop && bounds.Y2 == bridge.PrevBoundsBottom)
+		{
+			return;
+		}
+
+		bridge.PrevPose = item.Pose;
+		bridge.PrevBoundsTop = bounds.Y1;
+		bridge.PrevBoundsBottom = bounds.Y2;
+		g_CollisionCache.Invalidate();
+	}
+
 	bool TestMaterial(MaterialType refMaterial, const std::vector<MaterialType>& materials)
 	{
 		return Contains(materials, refMaterial);
@@ -131,6 +131,54 @@ struct SectorFlagData
 	}
 };
 
+// NOTE: Vertical extents are relative to bridge item's vertical position, so moving bridge vertically
+// doesn't require readding it. Rotation or bounds changes must go through UpdateBridgeItem().
+struct SectorBridgeData
+{
+	int ItemNumber	 = NO_VALUE;
+	int TopOffset	 = 0;
+	int BottomOffset = 0;
+};
+
+// Bridge item numbers in ascending order. Most sectors hold few bridges, so they are stored inline.
+class SectorBridgeList
+{
+private:
+	// Constants
+	static constexpr auto INLINE_CAPACITY = 4;
+
+	// Members
+	std::array<SectorBridgeData, INLINE_CAPACITY> _inlineBridges   = {};
+	std::vector<SectorBridgeData>				  _overflowBridges = {};
+	int											  _count		   = 0;
+
+public:
+	// Getters
+	int GetCount() const;
+
+	// Inquirers
+	bool IsEmpty() const;
+
+	// Utilities
+	void Insert(const SectorBridgeData& bridgeData);
+	bool Erase(int itemNumber);
+
+	// Iterators
+	const SectorBridgeData* begin() const;
+	const SectorBridgeData* end() const;
+
+private:
+	// Helpers
+	bool			  IsInline() const;
+	SectorBridgeData* GetData();
+};
+
+struct SectorSurfaceHeightData
+{
+	int Floor	= 0;
+	int Ceiling = 0;
+};
+
 // SectorData
 class FloorInfo
 {
@@ -140,7 +188,7 @@ public:
 	int				  SidePortalRoomNumber = 0;
 	SectorSurfaceData FloorSurface		   = {};
 	SectorSurfaceData CeilingSurface	   = {};
-	std::set<int>	  BridgeItemNumbers	   = {};
+	SectorBridgeList  Bridges			   = {};
 	SectorFlagData	  Flags				   = {};
 
 	int	 Box		  = 0;
@@ -161,6 +209,7 @@ public:
 
 	int GetSurfaceHeight(int x, int z, bool isFloor) const;
 	int GetSurfaceHeight(const Vector3i& pos, bool isFloor) const;
+	SectorSurfaceHeightData GetSurfaceHeights(const Vector3i& pos) const;
 	int GetBridgeSurfaceHeight(const Vector3i& pos, bool isFloor) const;
 
 	// Inquirers
@@ -173,7 +222,12 @@ public:
 	// Bridge utilities
 	int	 GetInsideBridgeItemNumber(const Vector3i& pos, bool floorBorder, bool ceilingBorder) const;
 	void AddBridge(int itemNumber);
+	void AddBridge(const SectorBridgeData& bridgeData);
 	void RemoveBridge(int itemNumber);
+
+private:
+	// Helpers
+	SectorSurfaceHeightData GetSurfaceHeightData(const Vector3i& pos, bool testFloor, bool testCeiling) const;
 };
 
 namespace TEN::Collision::Floordata
@@ -197,9 +251,11 @@ namespace TEN::Collision::Floordata
 	void AddBridge(int itemNumber, int x = 0, int z = 0);
 	void RemoveBridge(int itemNumber, int x = 0, int z = 0);
 
+	SectorBridgeData   GetSectorBridgeData(const ItemInfo& item);
 	std::optional<int> GetBridgeItemIntersect(const ItemInfo& item, const Vector3i& pos, bool useBottomHeight);
 	int	 GetBridgeBorder(const ItemInfo& item, bool isBottom);
 	void UpdateBridgeItem(const ItemInfo& item, bool forceRemoval = false);
+	void UpdateBridgeItemPose(ItemInfo& item);
 
 	bool TestMaterial(MaterialType refMaterial, const std::vector<MaterialType>& materials);
 	
@@ -0,0 +1,393 @@
+#include "framework.h"
+#include "Game/control/Pathfinding.h"
+
+#include "Game/control/box.h"
+#include "Game/control/control.h"
+#include "Game/itemdata/creature_info.h"
+#include "Game/items.h"
+#include "Game/room.h"
+#include "Specific/Benchmark.h"
+#include "Specific/JobSystem.h"
+#include "Specific/level.h"
+
+using namespace TEN::Benchmark;
+using namespace TEN::Jobs;
+
+namespace TEN::Control::Pathfinding
+{
+	PathfindingController g_Pathfinding = {};
+
+	static Vector3 GetBoxCenter(int boxNumber)
+	{
+		const auto& box = g_Level.Boxes[boxNumber];
+		return Vector3((box.top + box.bottom) * BLOCK(0.5f), (float)box.height, (box.left + box.right) * BLOCK(0.5f));
+	}
+
+	bool PathfindingController::PathKey::operator ==(const PathKey& key) const
+	{
+		return (Zone == key.Zone && StartBox == key.StartBox && TargetBox == key.TargetBox && FlipStatus == key.FlipStatus &&
+				Step == key.Step && Drop == key.Drop && Fly == key.Fly && BlockMask == key.BlockMask &&
+				CanJump == key.CanJump && CanMonkey == key.CanMonkey);
+	}
+
+	size_t PathfindingController::PathKeyHasher::operator ()(const PathKey& key) const
+	{
+		auto hashCombine = [](size_t seed, size_t value)
+		{
+			return (seed ^ (value + 0x9E3779B9 + (seed << 6) + (seed >> 2)));
+		};
+
+		size_t seed = std::hash<int>()(key.StartBox);
+		seed = hashCombine(seed, std::hash<int>()(key.TargetBox));
+		seed = hashCombine(seed, std::hash<int>()(key.Zone | (key.FlipStatus << 8) | (key.CanJump << 9) | (key.CanMonkey << 10)));
+		seed = hashCombine(seed, std::hash<int>()(key.Step ^ (key.Drop << 16)));
+		seed = hashCombine(seed, std::hash<int>()(key.Fly ^ (key.BlockMask << 16)));
+		return seed;
+	}
+
+	PathfindingMode PathfindingController::GetMode() const
+	{
+		return _mode;
+	}
+
+	const PathfindingStats& PathfindingController::GetStats() const
+	{
+		return _stats;
+	}
+
+	void PathfindingController::SetMode(PathfindingMode mode)
+	{
+		_mode = mode;
+	}
+
+	// Finds complete path from creature's box to LOT target box and writes it into LOT nodes,
+	// so that exit box chain can be consumed by CalculateTarget() the same way as with legacy search.
+	bool PathfindingController::Search(LOTInfo& LOT, int startBoxNumber)
+	{
+		if (LOT.RequiredBox != NO_VALUE)
+			LOT.TargetBox = LOT.RequiredBox;
+
+		if (startBoxNumber == NO_VALUE || LOT.TargetBox == NO_VALUE)
+			return false;
+
+		_stats.SearchCount++;
+
+		auto key = GetPathKey(LOT, startBoxNumber, LOT.TargetBox);
+
+		auto it = _cache.find(key);
+		if (it != _cache.end() && IsPathValid(LOT, it->second) && !IsPathExpired(it->second))
+		{
+			_stats.CacheHitCount++;
+			ApplyPath(LOT, startBoxNumber, it->second);
+			return !it->second.Boxes.empty();
+		}
+
+		if (_cache.size() >= CACHE_SIZE_MAX)
+			_cache.clear();
+
+		auto& entry = _cache[key];
+		entry = FindPath(key, _stats.ExpansionCount);
+		entry.Frame = GlobalCounter;
+
+		ApplyPath(LOT, startBoxNumber, entry);
+		return !entry.Boxes.empty();
+	}
+
+	// Think phase: resolves searches creatures are expected to request this frame before their control routines run.
+	// Creatures think in parallel, reading only their own and their enemy's state, and searches only read level data.
+	// Both write to per-creature or per-request slots, so they run on job system workers. Slots are merged serially
+	// in creature order, so results don't depend on worker count, and are identical to those Search() would compute
+	// itself, so cache hits change only frame time, never gameplay outcome. Creatures which pick different target box
+	// during their mood update simply miss and search serially as before.
+	void PathfindingController::Prefetch(const std::vector<CreatureInfo*>& creatures)
+	{
+		if (_mode != PathfindingMode::AStar)
+			return;
+
+		auto profile = ScopedProfile(ProfileSection::Think);
+
+		_thoughts.clear();
+		_thoughts.resize(creatures.size());
+
+		g_Jobs.ParallelFor((int)creatures.size(), [this, &creatures](int index)
+		{
+			_thoughts[index] = Think(*creatures[index]);
+		});
+
+		_prefetchKeys.clear();
+		for (const auto& thought : _thoughts)
+		{
+			for (int i = 0; i < thought.KeyCount; i++)
+			{
+				const auto& key = thought.Keys[i];
+
+				auto it = _cache.find(key);
+				if ((it != _cache.end() && !IsPathExpired(it->second)) ||
+					std::find(_prefetchKeys.begin(), _prefetchKeys.end(), key) != _prefetchKeys.end())
+				{
+					continue;
+				}
+
+				_prefetchKeys.push_back(key);
+			}
+		}
+
+		_prefetchResults.clear();
+		_prefetchResults.resize(_prefetchKeys.size());
+
+		g_Jobs.ParallelFor((int)_prefetchKeys.size(), [this](int index)
+		{
+			auto& result = _prefetchResults[index];
+			result.Entry = FindPath(_prefetchKeys[index], result.ExpansionCount);
+		});
+
+		for (int i = 0; i < _prefetchKeys.size(); i++)
+		{
+			if (_cache.size() >= CACHE_SIZE_MAX)
+				_cache.clear();
+
+			auto& entry = _cache[_prefetchKeys[i]];
+			entry = std::move(_prefetchResults[i].Entry);
+			entry.Frame = GlobalCounter;
+			_stats.ExpansionCount += _prefetchResults[i].ExpansionCount;
+		}
+
+		_stats.PrefetchCount += (int)_prefetchKeys.size();
+	}
+
+	// Must be called whenever box blocking flags change.
+	void PathfindingController::InvalidateCache()
+	{
+		_cache.clear();
+	}
+
+	void PathfindingController::Update()
+	{
+		if (g_Benchmark.Profiler.IsEnabled())
+		{
+			g_Benchmark.Profiler.AddCount(ProfileCounter::PathSearches, _stats.SearchCount);
+			g_Benchmark.Profiler.AddCount(ProfileCounter::PathCacheHits, _stats.CacheHitCount);
+			g_Benchmark.Profiler.AddCount(ProfileCounter::PathExpansions, _stats.ExpansionCount);
+			g_Benchmark.Profiler.AddCount(ProfileCounter::PathPrefetches, _stats.PrefetchCount);
+		}
+
+		_stats = PathfindingStats{};
+	}
+
+	PathfindingController::PathKey PathfindingController::GetPathKey(const LOTInfo& LOT, int startBoxNumber, int targetBoxNumber) const
+	{
+		auto key = PathKey{};
+		key.Zone = (int)LOT.Zone;
+		key.StartBox = startBoxNumber;
+		key.TargetBox = targetBoxNumber;
+		key.FlipStatus = FlipStatus;
+		key.Step = LOT.Step;
+		key.Drop = LOT.Drop;
+		key.Fly = LOT.Fly;
+		key.BlockMask = LOT.BlockMask;
+		key.CanJump = LOT.CanJump;
+		key.CanMonkey = LOT.CanMonkey;
+		return key;
+	}
+
+	// Predicts searches creature's control routine will request. Reads only creature, its enemy and level data.
+	PathfindingController::CreatureThought PathfindingController::Think(const CreatureInfo& creature) const
+	{
+		auto thought = CreatureThought{};
+		if (creature.ItemNumber == NO_VALUE)
+			return thought;
+
+		const auto& item = g_Level.Items[creature.ItemNumber];
+		const auto& LOT = creature.LOT;
+		if (item.RoomNumber == NO_VALUE)
+			return thought;
+
+		// Same box lookup as CreatureAIInfo(), which runs before CalculateTarget() on unmoved creature.
+		auto& room = g_Level.Rooms[item.RoomNumber];
+		int startBoxNumber = GetSector(&room, item.Pose.Position.x - room.x, item.Pose.Position.z - room.z)->Box;
+		if (startBoxNumber == NO_VALUE)
+			return thought;
+
+		int targetBoxNumber = (LOT.RequiredBox != NO_VALUE) ? LOT.RequiredBox : LOT.TargetBox;
+		if (targetBoxNumber != NO_VALUE)
+			thought.Keys[thought.KeyCount++] = GetPathKey(LOT, startBoxNumber, targetBoxNumber);
+
+		// Attacking creature retargets to enemy's current box in CreatureMood(). Enemy doesn't move before
+		// creature acts unless it's another item updated earlier, in which case prediction simply misses.
+		const auto* enemy = creature.Enemy;
+		if (creature.Mood == MoodType::Attack && enemy != nullptr && enemy->RoomNumber != NO_VALUE)
+		{
+			auto& enemyRoom = g_Level.Rooms[enemy->RoomNumber];
+			int enemyBoxNumber = GetSector(&enemyRoom, enemy->Pose.Position.x - enemyRoom.x, enemy->Pose.Position.z - enemyRoom.z)->Box;
+			if (enemyBoxNumber != NO_VALUE && enemyBoxNumber != targetBoxNumber)
+				thought.Keys[thought.KeyCount++] = GetPathKey(LOT, startBoxNumber, enemyBoxNumber);
+		}
+
+		return thought;
+	}
+
+	// Runs A* backwards from target box, so that parent of every visited box is its exit box towards target.
+	// Depends only on key and level data, so it's safe to run concurrently on game thread and job workers.
+	PathfindingController::PathEntry PathfindingController::FindPath(const PathKey& key, int& expansionCount) const
+	{
+		thread_local auto context = SearchContext{};
+
+		auto entry = PathEntry{};
+
+		int startBoxNumber = key.StartBox;
+		int targetBoxNumber = key.TargetBox;
+
+		const auto* zone = g_Level.Zones[key.Zone][(int)key.FlipStatus].data();
+		int searchZone = zone[targetBoxNumber];
+
+		// Different zones are never connected for walking creatures.
+		if (key.Fly == NO_FLYING && zone[startBoxNumber] != searchZone)
+			return entry;
+
+		auto& nodes = context.Nodes;
+		auto& openSet = context.OpenSet;
+
+		if (nodes.size() != g_Level.Boxes.size())
+		{
+			nodes.assign(g_Level.Boxes.size(), SearchNode{});
+			context.SearchId = 0;
+		}
+
+		// Search ID avoids clearing all nodes before every search.
+		unsigned int searchId = ++context.SearchId;
+		openSet.clear();
+
+		auto startCenter = GetBoxCenter(startBoxNumber);
+		auto compare = [](const std::pair<float, int>& a, const std::pair<float, int>& b) { return (a.first > b.first); };
+
+		auto& targetNode = nodes[targetBoxNumber];
+		targetNode = SearchNode{ 0.0f, NO_VALUE, searchId, false };
+		openSet.push_back({ Vector3::Distance(GetBoxCenter(targetBoxNumber), startCenter), targetBoxNumber });
+
+		bool isFound = false;
+		while (!openSet.empty())
+		{
+			std::pop_heap(openSet.begin(), openSet.end(), compare);
+			int boxNumber = openSet.back().second;
+			openSet.pop_back();
+
+			auto& node = nodes[boxNumber];
+			if (node.IsClosed)
+				continue;
+
+			node.IsClosed = true;
+			expansionCount++;
+
+			if (boxNumber == startBoxNumber)
+			{
+				isFound = true;
+				break;
+			}
+
+			const auto& box = g_Level.Boxes[boxNumber];
+			auto center = GetBoxCenter(boxNumber);
+
+			int index = box.overlapIndex;
+			if (index < 0)
+				continue;
+
+			bool done = false;
+			do
+			{
+				int nextBoxNumber = g_Level.Overlaps[index].box;
+				int flags = g_Level.Overlaps[index++].flags;
+
+				if (flags & BOX_END_BIT)
+					done = true;
+
+				// Same traversal rules as legacy search.
+				if (key.Fly == NO_FLYING && searchZone != zone[nextBoxNumber])
+					continue;
+
+				int delta = g_Level.Boxes[nextBoxNumber].height - box.height;
+				if ((delta > key.Step || delta < key.Drop) && (!(flags & BOX_MONKEY) || !key.CanMonkey))
+					continue;
+
+				if ((flags & BOX_JUMP) && !key.CanJump)
+					continue;
+
+				// Creature may stand in blocked box, but can't path through one.
+				if (nextBoxNumber != startBoxNumber && (g_Level.Boxes[nextBoxNumber].flags & key.BlockMask))
+				{
+					entry.IsBlocked = true;
+					continue;
+				}
+
+				auto nextCenter = GetBoxCenter(nextBoxNumber);
+				float cost = node.Cost + Vector3::Distance(center, nextCenter);
+
+				auto& nextNode = nodes[nextBoxNumber];
+				if (nextNode.SearchId == searchId && (nextNode.IsClosed || nextNode.Cost <= cost))
+					continue;
+
+				nextNode = SearchNode{ cost, boxNumber, searchId, false };
+
+				openSet.push_back({ cost + Vector3::Distance(nextCenter, startCenter), nextBoxNumber });
+				std::push_heap(openSet.begin(), openSet.end(), compare);
+			}
+			while (!done);
+		}
+
+		if (!isFound)
+			return entry;
+
+		for (int boxNumber = startBoxNumber; boxNumber != NO_VALUE; boxNumber = nodes[boxNumber].ParentBox)
+			entry.Boxes.push_back(boxNumber);
+
+		entry.IsBlocked = false;
+		return entry;
+	}
+
+	bool PathfindingController::IsPathValid(const LOTInfo& LOT, const PathEntry& entry) const
+	{
+		// Safety net in case blocking flags changed without cache invalidation.
+		// Start and target boxes are exempt, same as during search.
+		for (int i = 1; i < ((int)entry.Boxes.size() - 1); i++)
+		{
+			if (g_Level.Boxes[entry.Boxes[i]].flags & LOT.BlockMask)
+				return false;
+		}
+
+		return true;
+	}
+
+	bool PathfindingController::IsPathExpired(const PathEntry& entry) const
+	{
+		// Unreachable target may become reachable through state cache isn't invalidated for (e.g. creature moving out of blocked box).
+		if (!entry.Boxes.empty())
+			return false;
+
+		return ((GlobalCounter - entry.Frame) >= FAILED_PATH_LIFETIME);
+	}
+
+	void PathfindingController::ApplyPath(LOTInfo& LOT, int startBoxNumber, const PathEntry& entry) const
+	{
+		// Clear previous path so that stale exit boxes aren't followed.
+		for (int boxNumber : LOT.Path)
+			LOT.Node[boxNumber].exitBox = NO_VALUE;
+
+		LOT.Path = entry.Boxes;
+
+		if (entry.Boxes.empty())
+		{
+			auto& node = LOT.Node[startBoxNumber];
+			node.exitBox = NO_VALUE;
+			node.searchNumber = entry.IsBlocked ? (LOT.SearchNumber | BLOCKED_SEARCH) : LOT.SearchNumber;
+
+			LOT.Path.push_back(startBoxNumber);
+			return;
+		}
+
+		for (int i = 0; i < entry.Boxes.size(); i++)
+		{
+			auto& node = LOT.Node[entry.Boxes[i]];
+			node.exitBox = ((i + 1) < entry.Boxes.size()) ? entry.Boxes[i + 1] : NO_VALUE;
+			node.searchNumber = LOT.SearchNumber;
+		}
+	}
+}
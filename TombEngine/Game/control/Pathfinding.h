@@ -0,0 +1,124 @@
+#pragma once
+#include <unordered_map>
+
+#include "Specific/clock.h"
+
+struct CreatureInfo;
+struct LOTInfo;
+
+namespace TEN::Control::Pathfinding
+{
+	enum class PathfindingMode
+	{
+		Legacy, // Incremental breadth-first expansion over several frames.
+		AStar	// Complete heuristic search with shared path cache.
+	};
+
+	struct PathfindingStats
+	{
+		int SearchCount	   = 0;
+		int CacheHitCount  = 0;
+		int ExpansionCount = 0;
+		int PrefetchCount  = 0; // Searches resolved ahead of time by parallel think phase.
+	};
+
+	class PathfindingController
+	{
+	private:
+		// Constants
+		static constexpr auto CACHE_SIZE_MAX	   = 4096;
+		static constexpr auto FAILED_PATH_LIFETIME = FPS; // Failed searches are retried after this many frames.
+
+		struct PathKey
+		{
+			int	 Zone		= 0;
+			int	 StartBox	= 0;
+			int	 TargetBox	= 0;
+			bool FlipStatus = false;
+
+			// Creature traversal capabilities.
+			int	 Step	   = 0;
+			int	 Drop	   = 0;
+			int	 Fly	   = 0;
+			int	 BlockMask = 0;
+			bool CanJump   = false;
+			bool CanMonkey = false;
+
+			bool operator ==(const PathKey& key) const;
+		};
+
+		struct PathKeyHasher
+		{
+			size_t operator ()(const PathKey& key) const;
+		};
+
+		struct PathEntry
+		{
+			std::vector<int> Boxes	   = {}; // From start box to target box. Empty if target is unreachable.
+			bool			 IsBlocked = false;
+			int				 Frame	   = 0;	 // Frame of search, used to expire failed searches.
+		};
+
+		struct SearchNode
+		{
+			float		 Cost	   = 0.0f;
+			int			 ParentBox = NO_VALUE;
+			unsigned int SearchId  = 0;
+			bool		 IsClosed  = false;
+		};
+
+		// Per-thread search state, so concurrent searches never share nodes.
+		struct SearchContext
+		{
+			std::vector<SearchNode>				Nodes	 = {};
+			std::vector<std::pair<float, int>>	OpenSet	 = {}; // Binary heap of estimated total cost and box number.
+			unsigned int						SearchId = 0;
+		};
+
+		struct PrefetchResult
+		{
+			PathEntry Entry			 = {};
+			int		  ExpansionCount = 0;
+		};
+
+		// Searches one creature is expected to request during its control routine.
+		struct CreatureThought
+		{
+			std::array<PathKey, 2> Keys		= {}; // Current target and target predicted from mood.
+			int					   KeyCount = 0;
+		};
+
+		// Members
+		PathfindingMode										  _mode			   = PathfindingMode::AStar;
+		std::unordered_map<PathKey, PathEntry, PathKeyHasher> _cache		   = {};
+		PathfindingStats									  _stats		   = {};
+		std::vector<CreatureThought>						  _thoughts		   = {};
+		std::vector<PathKey>								  _prefetchKeys	   = {};
+		std::vector<PrefetchResult>							  _prefetchResults = {};
+
+	public:
+		// Getters
+		PathfindingMode			GetMode() const;
+		const PathfindingStats& GetStats() const;
+
+		// Setters
+		void SetMode(PathfindingMode mode);
+
+		// Utilities
+		bool Search(LOTInfo& LOT, int startBoxNumber);
+		void Prefetch(const std::vector<CreatureInfo*>& creatures);
+		void InvalidateCache();
+		void Update();
+
+	private:
+		// Helpers
+		PathKey			GetPathKey(const LOTInfo& LOT, int startBoxNumber, int targetBoxNumber) const;
+		CreatureThought Think(const CreatureInfo& creature) const;
+		PathEntry		FindPath(const PathKey& key, int& expansionCount) const;
+		bool			IsPathValid(const LOTInfo& LOT, const PathEntry& entry) const;
+		bool			IsPathExpired(const PathEntry& entry) const;
+		void			ApplyPath(LOTInfo& LOT, int startBoxNumber, const PathEntry& entry) const;
+	};
+
+	extern PathfindingController g_Pathfinding;
+}
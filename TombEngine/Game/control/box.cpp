@@ -7,6 +7,7 @@
 #include "Game/collision/collide_room.h"
 #include "Game/control/control.h"
 #include "Game/control/lot.h"
+#include "Game/control/Pathfinding.h"
 #include "Game/effects/smoke.h"
 #include "Game/effects/tomb4fx.h"
 #include "Game/itemdata/creature_info.h"
@@ -22,6 +23,7 @@
 #include "Objects/Generic/Object/Pushable/PushableObject.h"
 #include "Renderer/Renderer.h"
 
+using namespace TEN::Control::Pathfinding;
 using namespace TEN::Effects::Smoke;
 
 constexpr auto ESCAPE_DIST = BLOCK(5);
@@ -1884,7 +1886,14 @@ void GetCreatureMood(ItemInfo* item, AI_INFO* AI, bool isViolent)
 
 TARGET_TYPE CalculateTarget(Vector3i* target, ItemInfo* item, LOTInfo* LOT)
 {
-	UpdateLOT(LOT, 5);
+	if (g_Pathfinding.GetMode() == PathfindingMode::Legacy)
+	{
+		UpdateLOT(LOT, 5);
+	}
+	else
+	{
+		g_Pathfinding.Search(*LOT, item->BoxNumber);
+	}
 
 	*target = item->Pose.Position;
 
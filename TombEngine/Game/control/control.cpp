@@ -5,10 +5,13 @@
 #include <process.h>
 
 #include "Game/camera.h"
+#include "Game/collision/BroadPhase.h"
+#include "Game/collision/CollisionCache.h"
 #include "Game/collision/collide_room.h"
 #include "Game/collision/sphere.h"
 #include "Game/control/flipeffect.h"
 #include "Game/control/lot.h"
+#include "Game/control/Pathfinding.h"
 #include "Game/control/volume.h"
 #include "Game/effects/debris.h"
 #include "Game/effects/Blood.h"
@@ -56,12 +59,15 @@
 #include "Scripting/Include/ScriptInterfaceGame.h"
 #include "Scripting/Include/Strings/ScriptInterfaceStringsHandler.h"
 #include "Sound/sound.h"
+#include "Specific/Benchmark.h"
 #include "Specific/clock.h"
+#include "Specific/configuration.h"
 #include "Specific/Input/Input.h"
 #include "Specific/level.h"
 #include "Specific/winmain.h"
 
 using namespace std::chrono;
+using namespace TEN::Benchmark;
 using namespace TEN::Effects;
 using namespace TEN::Effects::Blood;
 using namespace TEN::Effects::Bubble;
@@ -79,7 +85,10 @@ using namespace TEN::Effects::Streamer;
 using namespace TEN::Entities::Generic;
 using namespace TEN::Entities::Switches;
 using namespace TEN::Entities::TR4;
+using namespace TEN::Collision::BroadPhase;
+using namespace TEN::Collision::CollisionCache;
 using namespace TEN::Collision::Floordata;
+using namespace TEN::Control::Pathfinding;
 using namespace TEN::Control::Volumes;
 using namespace TEN::Hud;
 using namespace TEN::Input;
@@ -113,8 +122,18 @@ short NextFxFree;
 
 int ControlPhaseTime;
 
+// Accumulated 1/60 s ticks not yet simulated. Logic runs ahead, so value stays within (-LOOP_FRAME_COUNT, 0] between calls.
+static int ControlFrameCount = 0;
+
 int DrawPhase(bool isTitle)
 {
+	// Title menu is processed once per loop iteration, so it always runs at logic rate.
+	bool isHighFramerate = (g_Configuration.EnableHighFramerate && !isTitle);
+
+	// Simulation is ahead of real time by accumulated remainder, so blend toward current logic frame accordingly.
+	if (isHighFramerate)
+		g_Renderer.SetInterpolationFactor(1.0f + ((ControlFrameCount + GetSyncTickFraction()) / LOOP_FRAME_COUNT));
+
 	if (isTitle)
 	{
 		g_Renderer.RenderTitle();
@@ -124,9 +143,19 @@ int DrawPhase(bool isTitle)
 		g_Renderer.Render();
 	}
 
+	// Game logic must never see interpolated state.
+	g_Renderer.SetInterpolationFactor(1.0f);
+
 	// Clear display sprites.
 	ClearDisplaySprites();
 
+	// Render as often as display allows, logic frames are scheduled by ControlPhase().
+	if (isHighFramerate)
+	{
+		Camera.numberFrames = Sync();
+		return Camera.numberFrames;
+	}
+
 	Camera.numberFrames = g_Renderer.Synchronize();
 	return Camera.numberFrames;
 }
@@ -137,10 +166,17 @@ GameStatus ControlPhase(int numFrames)
 
 	bool isTitle = (CurrentLevel == 0);
 
-	RegeneratePickups();
-
 	numFrames = std::clamp(numFrames, 0, 10);
 
+	// Not enough time elapsed for new logic frame; only possible with high framerate.
+	if ((ControlFrameCount + numFrames) <= 0)
+	{
+		ControlFrameCount += numFrames;
+		return GameStatus::Normal;
+	}
+
+	RegeneratePickups();
+
 	if (TrackCameraInit)
 	{
 		UseSpotCam = false;
@@ -150,17 +186,33 @@ GameStatus ControlPhase(int numFrames)
 	g_GameStringsHandler->ProcessDisplayStrings(DELTA_TIME);
 	
 	bool isFirstTime = true;
-	static int framesCount = 0;
 
-	for (framesCount += numFrames; framesCount > 0; framesCount -= LOOP_FRAME_COUNT)
+	for (ControlFrameCount += numFrames; ControlFrameCount > 0; ControlFrameCount -= LOOP_FRAME_COUNT)
 	{
+		g_Benchmark.BeginFrame();
+
+		// Keep poses from previous logic frame to interpolate rendered frames.
+		if (g_Configuration.EnableHighFramerate && !g_Benchmark.IsHeadless())
+			g_Renderer.SaveOldState();
+
+		// Re-bucket objects which moved since previous frame.
+		g_BroadPhase.Update();
+		g_Pathfinding.Update();
+		g_CollisionCache.Update();
+
 		// Controls are polled before OnLoop, so input data could be
 		// overwritten by script API methods.
-		HandleControls(isTitle);
+		{
+			auto profile = ScopedProfile(ProfileSection::Input);
+			HandleControls(isTitle);
+		}
 
 		// Pre-loop script and event handling.
-		g_GameScript->OnLoop(DELTA_TIME, false); // TODO: Don't use DELTA_TIME constant with variable framerate
-		HandleAllGlobalEvents(EventType::Loop, (Activator)LaraItem->Index);
+		{
+			auto profile = ScopedProfile(ProfileSection::Scripts);
+			g_GameScript->OnLoop(DELTA_TIME, false); // TODO: Don't use DELTA_TIME constant with variable framerate
+			HandleAllGlobalEvents(EventType::Loop, (Activator)LaraItem->Index);
+		}
 
 		// Control lock is processed after handling scripts, because builder may want to
 		// process input externally, while still locking Lara from input.
@@ -183,22 +235,43 @@ GameStatus ControlPhase(int numFrames)
 		ApplyActionQueue();
 		ClearActionQueue();
 
-		UpdateAllItems();
-		UpdateAllEffects();
-		UpdateLara(LaraItem, isTitle);
+		{
+			auto profile = ScopedProfile(ProfileSection::Items);
 
-		g_GameScriptEntities->TestCollidingObjects();
+			// Think phase runs creature path searches in parallel, act phase runs item controls serially.
+			g_Pathfinding.Prefetch(ActiveCreatures);
+			UpdateAllItems();
+		}
 
-		if (UseSpotCam)
 		{
-			// Draw flyby cameras.
-			CalculateSpotCameras();
+			auto profile = ScopedProfile(ProfileSection::Effects);
+			UpdateAllEffects();
 		}
-		else
+
 		{
-			// Do the standard camera.
-			TrackCameraInit = false;
-			CalculateCamera(LaraCollision);
+			auto profile = ScopedProfile(ProfileSection::Player);
+			UpdateLara(LaraItem, isTitle);
+		}
+
+		{
+			auto profile = ScopedProfile(ProfileSection::Collision);
+			g_GameScriptEntities->TestCollidingObjects();
+		}
+
+		{
+			auto profile = ScopedProfile(ProfileSection::Camera);
+
+			if (UseSpotCam)
+			{
+				// Draw flyby cameras.
+				CalculateSpotCameras();
+			}
+			else
+			{
+				// Do the standard camera.
+				TrackCameraInit = false;
+				CalculateCamera(LaraCollision);
+			}
 		}
 
 		// Update oscillator seed.
@@ -211,32 +284,36 @@ GameStatus ControlPhase(int numFrames)
 		Weather.Update();
 
 		// Update effects.
-		StreamerEffect.Update();
-		UpdateSparks();
-		UpdateFireSparks();
-		UpdateSmoke();
-		UpdateBlood();
-		UpdateBubbles();
-		UpdateDebris();
-		UpdateGunShells();
-		UpdateFootprints();
-		UpdateSplashes();
-		UpdateElectricityArcs();
-		UpdateHelicalLasers();
-		UpdateDrips();
-		UpdateRats();
-		UpdateRipples();
-		UpdateBats();
-		UpdateSpiders();
-		UpdateSparkParticles();
-		UpdateSmokeParticles();
-		UpdateSimpleParticles();
-		UpdateExplosionParticles();
-		UpdateShockwaves();
-		UpdateBeetleSwarm();
-		UpdateFishSwarm();
-		UpdateLocusts();
-		UpdateUnderwaterBloodParticles();
+		{
+			auto profile = ScopedProfile(ProfileSection::Particles);
+
+			StreamerEffect.Update();
+			UpdateSparks();
+			UpdateFireSparks();
+			UpdateSmoke();
+			UpdateBlood();
+			UpdateBubbles();
+			UpdateDebris();
+			UpdateGunShells();
+			UpdateFootprints();
+			UpdateSplashes();
+			UpdateElectricityArcs();
+			UpdateHelicalLasers();
+			UpdateDrips();
+			UpdateRats();
+			UpdateRipples();
+			UpdateBats();
+			UpdateSpiders();
+			UpdateSparkParticles();
+			UpdateSmokeParticles();
+			UpdateSimpleParticles();
+			UpdateExplosionParticles();
+			UpdateShockwaves();
+			UpdateBeetleSwarm();
+			UpdateFishSwarm();
+			UpdateLocusts();
+			UpdateUnderwaterBloodParticles();
+		}
 
 		// Update HUD.
 		g_Hud.Update(*LaraItem);
@@ -250,7 +327,10 @@ GameStatus ControlPhase(int numFrames)
 		DoFlipEffect(FlipEffect, LaraItem);
 
 		// Post-loop script and event handling.
-		g_GameScript->OnLoop(DELTA_TIME, true);
+		{
+			auto profile = ScopedProfile(ProfileSection::Scripts);
+			g_GameScript->OnLoop(DELTA_TIME, true);
+		}
 
 		// Clear savegame loaded flag.
 		JustLoaded = false;
@@ -265,6 +345,8 @@ GameStatus ControlPhase(int numFrames)
 			g_Renderer.Lock();
 			isFirstTime = false;
 		}
+
+		g_Benchmark.EndFrame();
 	}
 
 	using ns = std::chrono::nanoseconds;
@@ -283,7 +365,9 @@ unsigned CALLBACK GameMain(void *)
 	TimeInit();
 
 	// Do a fixed time title image.
-	if (g_GameFlow->IntroImagePath.empty())
+	if (g_Benchmark.IsHeadless())
+		TENLog("Skipping intro image in headless mode.", LogLevel::Info);
+	else if (g_GameFlow->IntroImagePath.empty())
 		TENLog("Intro image path is not set.", LogLevel::Warning);
 	else
 		g_Renderer.RenderTitleImage();
@@ -291,6 +375,18 @@ unsigned CALLBACK GameMain(void *)
 	// Execute the Lua gameflow and play the game.
 	g_GameFlow->DoFlow();
 
+	// Determinism check plays same run again from fresh game with all jobs on game thread.
+	if (g_Benchmark.BeginJobCheckPass())
+	{
+		InitializeGame = true;
+		DoTheGame = true;
+		g_GameFlow->DoFlow();
+	}
+
+	// Flush input recording and benchmark report.
+	g_Benchmark.Deinitialize();
+	TimeDeinit();
+
 	DoTheGame = false;
 
 	// Finish the thread.
@@ -561,6 +657,7 @@ GameStatus DoGameLoop(int levelIndex)
 	while (DoTheGame)
 	{
 		status = ControlPhase(numFrames);
+		SaveGame::Update();
 
 		if (!levelIndex)
 		{
@@ -598,6 +695,19 @@ GameStatus DoGameLoop(int levelIndex)
 			}
 		}
 
+		// Headless benchmark runs at fixed step without rendering or audio.
+		if (g_Benchmark.IsHeadless())
+		{
+			if (g_Benchmark.TestFinished())
+			{
+				status = GameStatus::ExitGame;
+				break;
+			}
+
+			numFrames = LOOP_FRAME_COUNT;
+			continue;
+		}
+
 		numFrames = DrawPhase(!levelIndex);
 		Sound_UpdateScene();
 	}
@@ -619,10 +729,10 @@ void EndGameLoop(int levelIndex, GameStatus reason)
 void HandleControls(bool isTitle)
 {
 	// Poll input devices and update input variables.
+	// Benchmark controller may substitute recorded input.
 	if (!isTitle)
 	{
-		// TODO: To allow cutscene skipping later, don't clear Deselect action.
-		UpdateInputActions(LaraItem, true);
+		g_Benchmark.UpdateInput(LaraItem);
 	}
 	else
 	{
@@ -79,7 +79,6 @@ extern short NextFxFree;
 
 extern int ControlPhaseTime;
 
-extern std::vector<short> OutsideRoomTable[OUTSIDE_SIZE][OUTSIDE_SIZE];
 
 int DrawPhase(bool isTitle);
 
@@ -1,6 +1,8 @@
 #pragma once
 #include <variant>
 
+#include "Scripting/Include/ScriptCallback.h"
+
 struct CAMERA_INFO;
 struct MESH_INFO;
 
@@ -48,7 +50,7 @@ namespace TEN::Control::Volumes
 	struct Event
 	{
 		EventMode Mode = EventMode::LevelScript;
-		std::string		Function = {};
+		ScriptCallback	Function = {}; // Name relative to LevelFuncs.
 		std::string		Data = {};
 
 		int CallCounter = NO_CALL_COUNTER;
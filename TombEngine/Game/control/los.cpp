@@ -3,6 +3,7 @@
 
 #include "Game/animation.h"
 #include "Game/collision/collide_room.h"
+#include "Game/collision/Raycast.h"
 #include "Game/effects/tomb4fx.h"
 #include "Game/effects/debris.h"
 #include "Game/items.h"
@@ -18,15 +19,17 @@
 #include "Sound/sound.h"
 #include "Specific/Input/Input.h"
 
+using namespace TEN::Collision::Raycast;
 using namespace TEN::Math;
 using TEN::Renderer::g_Renderer;
 
-// Globals
-int NumberLosRooms;
-int LosRooms[20];
-int ClosestItem;
-int ClosestDist;
-Vector3i ClosestCoord;
+// Legacy LOS rooms, only used when sector raycaster is disabled.
+static int NumberLosRooms;
+static int LosRooms[20];
+
+static int ClosestItem;
+static int ClosestDist;
+static Vector3i ClosestCoord;
 
 static int xLOS(const GameVector& origin, GameVector& target)
 {
@@ -217,41 +220,59 @@ static bool ClipTarget(const GameVector& origin, GameVector& target)
 	return true;
 }
 
-bool LOS(const GameVector* origin, GameVector* target)
+static bool LegacyLOS(const GameVector& origin, GameVector& target)
 {
 	int losAxis0 = 0;
 	int losAxis1 = 0;
 
-	target->RoomNumber = origin->RoomNumber;
-	if (abs(target->z - origin->z) > abs(target->x - origin->x))
+	target.RoomNumber = origin.RoomNumber;
+	if (abs(target.z - origin.z) > abs(target.x - origin.x))
 	{
-		losAxis0 = xLOS(*origin, *target);
-		losAxis1 = zLOS(*origin, *target);
+		losAxis0 = xLOS(origin, target);
+		losAxis1 = zLOS(origin, target);
 	}
 	else
 	{
-		losAxis0 = zLOS(*origin, *target);
-		losAxis1 = xLOS(*origin, *target);
+		losAxis0 = zLOS(origin, target);
+		losAxis1 = xLOS(origin, target);
 	}
 
 	if (losAxis1)
 	{
-		GetFloor(target->x, target->y, target->z, &target->RoomNumber);
+		GetFloor(target.x, target.y, target.z, &target.RoomNumber);
 
-		if (ClipTarget(*origin, *target) && losAxis0 == 1 && losAxis1 == 1)
+		if (ClipTarget(origin, target) && losAxis0 == 1 && losAxis1 == 1)
 			return true;
 	}
 
 	return false;
 }
 
+// Optional hit receives rooms traversed by sector raycaster, so caller can pass them to ObjectOnLOS2() for same ray.
+bool LOS(const GameVector* origin, GameVector* target, RoomRayHit* hit)
+{
+	g_Raycast.RecordRay(*origin, *target);
+
+	if (!g_Raycast.IsEnabled())
+		return LegacyLOS(*origin, *target);
+
+	auto rayHit = CastRoomRay(*origin, *target);
+	*target = rayHit.Position;
+
+	if (hit != nullptr)
+		*hit = rayHit;
+
+	return !rayHit.IsBlocked;
+}
+
 bool GetTargetOnLOS(GameVector* origin, GameVector* target, bool drawTarget, bool isFiring)
 {
 	auto dir = target->ToVector3() - origin->ToVector3();
 	dir.Normalize();
 
 	auto target2 = *target;
-	int result = LOS(origin, &target2);
+	auto rayHit = RoomRayHit{};
+	int result = LOS(origin, &target2, &rayHit);
 
 	GetFloor(target2.x, target2.y, target2.z, &target2.RoomNumber);
 
@@ -268,7 +289,7 @@ bool GetTargetOnLOS(GameVector* origin, GameVector* target, bool drawTarget, boo
 
 	MESH_INFO* mesh = nullptr;
 	auto vector = Vector3i::Zero;
-	int itemNumber = ObjectOnLOS2(origin, target, &vector, &mesh);
+	int itemNumber = ObjectOnLOS2(origin, target, &vector, &mesh, GAME_OBJECT_ID::ID_NO_OBJECT, &rayHit);
 
 	if (itemNumber != NO_LOS_ITEM)
 	{
@@ -637,22 +658,50 @@ static bool DoRayBox(const GameVector& origin, const GameVector& target, const G
 	return true;
 }
 
-int ObjectOnLOS2(GameVector* origin, GameVector* target, Vector3i* vec, MESH_INFO** mesh, GAME_OBJECT_ID priorityObjectID)
+int ObjectOnLOS2(GameVector* origin, GameVector* target, Vector3i* vec, MESH_INFO** mesh, GAME_OBJECT_ID priorityObjectID, const RoomRayHit* rayHit)
 {
 	ClosestItem = NO_LOS_ITEM;
 	ClosestDist = SQUARE(target->x - origin->x) + SQUARE(target->y - origin->y) + SQUARE(target->z - origin->z);
 
-	for (int r = 0; r < NumberLosRooms; ++r)
+	// Collect rooms along ray. Hit of preceding LOS() call for same ray is reused if caller passed it,
+	// either cast to same target or to position LOS() clipped target to. Legacy path always reuses rooms of preceding LOS().
+	auto roomNumbers = std::vector<int>{};
+	if (g_Raycast.IsEnabled())
 	{
-		auto& room = g_Level.Rooms[LosRooms[r]];
+		auto castHit = RoomRayHit{};
+		if (rayHit == nullptr)
+		{
+			castHit = CastRoomRay(*origin, *target);
+			rayHit = &castHit;
+		}
+
+		roomNumbers.assign(rayHit->RoomNumbers.begin(), rayHit->RoomNumbers.begin() + rayHit->RoomCount);
+	}
+	else
+	{
+		roomNumbers.assign(LosRooms, LosRooms + NumberLosRooms);
+	}
+
+	auto rayOrigin = origin->ToVector3();
+	auto rayDir = target->ToVector3() - rayOrigin;
+	rayDir.Normalize();
+
+	auto staticPtrs = std::vector<MESH_INFO*>{};
+
+	for (int roomNumber : roomNumbers)
+	{
+		auto& room = g_Level.Rooms[roomNumber];
 
 		auto pose = Pose::Zero;
 
-		if (mesh)
+		if (mesh && rayDir != Vector3::Zero)
 		{
-			for (int m = 0; m < room.mesh.size(); m++)
+			staticPtrs.clear();
+			g_Raycast.GetStatics(roomNumber, rayOrigin, rayDir, sqrt((float)ClosestDist), staticPtrs);
+
+			for (auto* staticPtr : staticPtrs)
 			{
-				auto& meshp = room.mesh[m];
+				auto& meshp = *staticPtr;
 
 				if (meshp.flags & StaticMeshFlags::SM_VISIBLE)
 				{
@@ -662,7 +711,7 @@ int ObjectOnLOS2(GameVector* origin, GameVector* target, Vector3i* vec, MESH_INF
 					if (DoRayBox(*origin, *target, bounds, pose, *vec, -1 - meshp.staticNumber))
 					{
 						*mesh = &meshp;
-						target->RoomNumber = LosRooms[r];
+						target->RoomNumber = roomNumber;
 					}
 				}
 			}
@@ -688,7 +737,7 @@ int ObjectOnLOS2(GameVector* origin, GameVector* target, Vector3i* vec, MESH_INF
 			pose = Pose(item.Pose.Position, EulerAngles(0, item.Pose.Orientation.y, 0));
 
 			if (DoRayBox(*origin, *target, bounds, pose, *vec, linkNumber))
-				target->RoomNumber = LosRooms[r];
+				target->RoomNumber = roomNumber;
 		}
 	}
 
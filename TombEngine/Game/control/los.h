@@ -1,13 +1,15 @@
 #pragma once
+#include "Game/collision/Raycast.h"
 #include "Game/room.h"
 #include "Objects/objectslist.h"
 #include "Math/Math.h"
 
 constexpr auto NO_LOS_ITEM = INT_MAX;
 
-bool LOS(const GameVector* origin, GameVector* target);
+bool LOS(const GameVector* origin, GameVector* target, TEN::Collision::Raycast::RoomRayHit* hit = nullptr);
 bool GetTargetOnLOS(GameVector* origin, GameVector* target, bool drawTarget, bool isFiring);
-int	 ObjectOnLOS2(GameVector* origin, GameVector* target, Vector3i* vec, MESH_INFO** mesh, GAME_OBJECT_ID priorityObjectID = GAME_OBJECT_ID::ID_NO_OBJECT);
+int	 ObjectOnLOS2(GameVector* origin, GameVector* target, Vector3i* vec, MESH_INFO** mesh, GAME_OBJECT_ID priorityObjectID = GAME_OBJECT_ID::ID_NO_OBJECT,
+				  const TEN::Collision::Raycast::RoomRayHit* rayHit = nullptr);
 bool LOSAndReturnTarget(GameVector* origin, GameVector* target, int push);
 
 std::optional<Vector3> GetStaticObjectLos(const Vector3& origin, int roomNumber, const Vector3& dir, float dist, bool onlySolid);
@@ -223,6 +223,7 @@ void ClearLOT(LOTInfo* LOT)
 	LOT->SearchNumber = 0;
 	LOT->TargetBox = NO_VALUE;
 	LOT->RequiredBox = NO_VALUE;
+	LOT->Path.clear();
 
 	auto* node = LOT->Node.data();
 	for (auto& node : LOT->Node) 
@@ -91,7 +91,7 @@ namespace TEN::Control::Volumes
 
 	void HandleEvent(Event& event, Activator& activator)
 	{
-		if (event.Function.empty() || event.CallCounter == 0 || event.CallCounter < NO_CALL_COUNTER)
+		if (event.Function.Name.empty() || event.CallCounter == 0 || event.CallCounter < NO_CALL_COUNTER)
 			return;
 
 		g_GameScript->ExecuteFunction(event.Function, activator, event.Data);
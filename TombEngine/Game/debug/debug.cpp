@@ -1,61 +1,329 @@
 #include "framework.h"
 #include "Game/debug/debug.h"
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
 #include <spdlog.h>
 #include <spdlog/sinks/basic_file_sink.h>
 #include <spdlog/sinks/stdout_color_sinks.h>
 
+// Messages are pushed into bounded lock-free ring buffer by any thread and written to sinks
+// by background thread, so game thread never waits for disk or console I/O.
+namespace
+{
+	using Clock = std::chrono::steady_clock;
+
+	constexpr auto LOG_RING_SIZE			 = 1024; // Must be power of 2.
+	constexpr auto LOG_FLUSH_INTERVAL		 = std::chrono::milliseconds(100);
+	constexpr auto LOG_RATE_LIMIT_INTERVAL	 = std::chrono::seconds(5);
+	constexpr auto LOG_RATE_LIMIT_BURST		 = 8; // Messages per call site allowed within rate limit interval.
+	constexpr auto LOG_RATE_LIMIT_TABLE_SIZE = 1024;
+	constexpr auto LOG_CRASH_DRAIN_TIMEOUT	 = std::chrono::milliseconds(500);
+
+	struct LogMessage
+	{
+		std::atomic<unsigned int> Sequence = 0;
+
+		LogLevel	Level = LogLevel::Info;
+		std::string Text  = {};
+	};
+
+	struct LogRateLimit
+	{
+		Clock::time_point StartTime		  = {};
+		unsigned int	  Count			  = 0;
+		unsigned int	  SuppressedCount = 0;
+	};
+
+	std::unique_ptr<LogMessage[]>	LogRing		  = nullptr;
+	std::atomic<unsigned int>		LogWriteIndex = 0;
+	unsigned int					LogReadIndex  = 0; // Owned by consumer.
+	std::shared_ptr<spdlog::logger> LogSink		  = nullptr;
+
+	std::thread				LogThread		 = {};
+	std::timed_mutex		LogConsumerMutex = {};
+	std::mutex				LogWakeMutex	 = {};
+	std::condition_variable LogWakeCondition = {};
+	std::atomic<bool>		LogIsRunning	 = false;
+	std::atomic<bool>		LogIsUrgent		 = false;
+
+	std::atomic<unsigned int> LogDroppedCount	= 0;
+	std::atomic<unsigned int> LogCollapsedCount = 0;
+
+	LPTOP_LEVEL_EXCEPTION_FILTER PrevExceptionFilter  = nullptr;
+	std::terminate_handler		 PrevTerminateHandler = nullptr;
+
+	bool TryPushLogMessage(std::string&& text, LogLevel level)
+	{
+		// Bounded MPSC queue: each slot's sequence tells producers whether it was consumed.
+		unsigned int index = LogWriteIndex.load(std::memory_order_relaxed);
+		while (true)
+		{
+			auto& slot = LogRing[index & (LOG_RING_SIZE - 1)];
+			unsigned int seq = slot.Sequence.load(std::memory_order_acquire);
+			int diff = int(seq - index);
+
+			if (diff == 0)
+			{
+				if (LogWriteIndex.compare_exchange_weak(index, index + 1, std::memory_order_relaxed))
+				{
+					slot.Level = level;
+					slot.Text = std::move(text);
+					slot.Sequence.store(index + 1, std::memory_order_release);
+					return true;
+				}
+			}
+			else if (diff < 0)
+			{
+				// Ring is full.
+				return false;
+			}
+			else
+			{
+				index = LogWriteIndex.load(std::memory_order_relaxed);
+			}
+		}
+	}
+
+	void WriteLogMessage(const std::string& text, LogLevel level)
+	{
+		switch (level)
+		{
+		case LogLevel::Error:
+			LogSink->error(text);
+			break;
+
+		case LogLevel::Warning:
+			LogSink->warn(text);
+			break;
+
+		case LogLevel::Info:
+			LogSink->info(text);
+			break;
+		}
+	}
+
+	// Must be called with consumer mutex held.
+	void DrainLogRing()
+	{
+		bool hasWritten = false;
+		while (true)
+		{
+			auto& slot = LogRing[LogReadIndex & (LOG_RING_SIZE - 1)];
+			if (slot.Sequence.load(std::memory_order_acquire) != (LogReadIndex + 1))
+				break;
+
+			WriteLogMessage(slot.Text, slot.Level);
+			slot.Text.clear();
+			slot.Sequence.store(LogReadIndex + LOG_RING_SIZE, std::memory_order_release);
+			LogReadIndex++;
+			hasWritten = true;
+		}
+
+		if (hasWritten)
+			LogSink->flush();
+	}
+
+	void LogThreadLoop()
+	{
+		while (true)
+		{
+			{
+				auto lock = std::unique_lock(LogWakeMutex);
+				LogWakeCondition.wait_for(lock, LOG_FLUSH_INTERVAL, [] { return (LogIsUrgent || !LogIsRunning); });
+				LogIsUrgent = false;
+			}
+
+			{
+				auto lock = std::unique_lock(LogConsumerMutex);
+				DrainLogRing();
+			}
+
+			if (!LogIsRunning)
+				break;
+		}
+	}
+
+	// Collapses messages from same call site once it logged more than burst count within rate limit interval.
+	// Returns false if message must be skipped, otherwise returns number of messages collapsed since call site
+	// was last logged.
+	bool CheckLogRateLimit(const LogCallSite& callSite, unsigned int& suppressedCount)
+	{
+		thread_local auto rateLimits = std::unordered_map<size_t, LogRateLimit>{};
+
+		auto now = Clock::now();
+
+		auto it = rateLimits.find(callSite.Id);
+		if (it != rateLimits.end())
+		{
+			auto& rateLimit = it->second;
+			if ((now - rateLimit.StartTime) < LOG_RATE_LIMIT_INTERVAL)
+			{
+				if (rateLimit.Count < LOG_RATE_LIMIT_BURST)
+				{
+					rateLimit.Count++;
+					suppressedCount = 0;
+					return true;
+				}
+
+				rateLimit.SuppressedCount++;
+				LogCollapsedCount++;
+				return false;
+			}
+
+			suppressedCount = rateLimit.SuppressedCount;
+			rateLimit = LogRateLimit{ now, 1, 0 };
+			return true;
+		}
+
+		// Call sites with explicit IDs derived from varying contents would grow table indefinitely.
+		if (rateLimits.size() >= LOG_RATE_LIMIT_TABLE_SIZE)
+			rateLimits.clear();
+
+		rateLimits.emplace(callSite.Id, LogRateLimit{ now, 1, 0 });
+		suppressedCount = 0;
+		return true;
+	}
+
+	void FlushTENLogOnCrash()
+	{
+		if (LogRing == nullptr || LogSink == nullptr)
+			return;
+
+		// Log thread may be stalled or dead, so don't wait for it indefinitely.
+		auto lock = std::unique_lock(LogConsumerMutex, std::defer_lock);
+		if (!lock.try_lock_for(LOG_CRASH_DRAIN_TIMEOUT))
+			return;
+
+		DrainLogRing();
+		LogSink->flush();
+	}
+
+	LONG WINAPI HandleUnhandledException(EXCEPTION_POINTERS* exceptionInfo)
+	{
+		FlushTENLogOnCrash();
+		return ((PrevExceptionFilter != nullptr) ? PrevExceptionFilter(exceptionInfo) : EXCEPTION_CONTINUE_SEARCH);
+	}
+
+	void HandleTerminate()
+	{
+		FlushTENLogOnCrash();
+
+		if (PrevTerminateHandler != nullptr)
+			PrevTerminateHandler();
+
+		std::abort();
+	}
+}
+
 void InitTENLog(const std::string& logDirContainingDir)
 {
 	// "true" means create new log file each time game is run.
 	auto logPath = logDirContainingDir + "Logs/TENLog.txt";
 	auto fileSink = std::make_shared<spdlog::sinks::basic_file_sink_mt>(logPath, true);
 
-	std::shared_ptr<spdlog::logger> logger;
-
 	// Set file and console log targets.
 	auto consoleSink = std::make_shared<spdlog::sinks::stdout_color_sink_mt>();
-	logger = std::make_shared<spdlog::logger>(std::string{ "multi_sink" }, spdlog::sinks_init_list{ fileSink, consoleSink });
-	
-	spdlog::initialize_logger(logger);
-    logger->set_level(spdlog::level::info);
-	logger->flush_on(spdlog::level::info);
-	logger->set_pattern("[%Y-%b-%d %T] [%^%l%$] %v");
-}
+	LogSink = std::make_shared<spdlog::logger>(std::string{ "multi_sink" }, spdlog::sinks_init_list{ fileSink, consoleSink });
 
-void TENLog(std::string_view str, LogLevel level, LogConfig config, bool allowSpam)
-{
-	static std::string lastString = {};
+	spdlog::initialize_logger(LogSink);
+	LogSink->set_level(spdlog::level::info);
+	LogSink->set_pattern("[%Y-%b-%d %T] [%^%l%$] %v");
 
-	if (lastString == str && !allowSpam)
-		return;
+	LogRing = std::make_unique<LogMessage[]>(LOG_RING_SIZE);
+	for (int i = 0; i < LOG_RING_SIZE; i++)
+		LogRing[i].Sequence.store(i, std::memory_order_relaxed);
+
+	LogWriteIndex = 0;
+	LogReadIndex = 0;
+	LogIsRunning = true;
+	LogThread = std::thread(LogThreadLoop);
 
+	PrevExceptionFilter = SetUnhandledExceptionFilter(HandleUnhandledException);
+	PrevTerminateHandler = std::set_terminate(HandleTerminate);
+}
+
+void TENLogAt(const LogCallSite& callSite, std::string_view str, LogLevel level, LogConfig config, bool allowSpam)
+{
 	if constexpr (!DebugBuild)
 	{
 		if (LogConfig::Debug == config)
 			return;
 	}
 
-	auto logger = spdlog::get("multi_sink");
-	switch (level)
+	unsigned int suppressedCount = 0;
+	if (!allowSpam && !CheckLogRateLimit(callSite, suppressedCount))
+		return;
+
+	auto text = std::string(str);
+	if (suppressedCount > 0)
+		text += " (repeated " + std::to_string(suppressedCount) + " more times)";
+
+	// Before init or after shutdown, write directly if possible.
+	if (!LogIsRunning)
 	{
-	case LogLevel::Error:
-		logger->error(str);
-		break;
-	case LogLevel::Warning:
-		logger->warn(str);
-		break;
-	case LogLevel::Info:
-		logger->info(str);
-		break;
+		if (LogSink != nullptr)
+		{
+			WriteLogMessage(text, level);
+			LogSink->flush();
+		}
+
+		return;
 	}
 
-	logger->flush();
+	if (!TryPushLogMessage(std::move(text), level))
+	{
+		LogDroppedCount++;
+		return;
+	}
 
-	lastString = std::string(str);
+	// Errors are written as soon as possible in case they precede crash.
+	if (level == LogLevel::Error)
+	{
+		LogIsUrgent = true;
+		LogWakeCondition.notify_one();
+	}
 }
 
 void ShutdownTENLog()
 {
+	if (!LogIsRunning.exchange(false))
+		return;
+
+	LogWakeCondition.notify_one();
+
+	// Producers may still have pushed messages after log thread's last drain, so drain and flush once more before joining.
+	{
+		auto lock = std::unique_lock(LogConsumerMutex);
+		DrainLogRing();
+		LogSink->flush();
+	}
+
+	if (LogThread.joinable())
+		LogThread.join();
+
+	SetUnhandledExceptionFilter(PrevExceptionFilter);
+	std::set_terminate(PrevTerminateHandler);
+
+	if (LogDroppedCount > 0 || LogCollapsedCount > 0)
+	{
+		WriteLogMessage(
+			"Log messages dropped: " + std::to_string(LogDroppedCount) +
+			", collapsed: " + std::to_string(LogCollapsedCount) + ".",
+			LogLevel::Info);
+	}
+
+	LogSink->flush();
+	LogSink = nullptr;
 	spdlog::shutdown();
 }
+
+TENLogStats GetTENLogStats()
+{
+	return TENLogStats{ LogDroppedCount, LogCollapsedCount };
+}
@@ -5,6 +5,7 @@ constexpr bool DebugBuild = true;
 constexpr bool DebugBuild = false;
 #endif
 
+#include <functional>
 #include <stdexcept>
 #include <string_view>
 #include <iostream>
@@ -22,9 +23,27 @@ enum class LogConfig
 	All
 };
 
-void TENLog(std::string_view str, LogLevel level = LogLevel::Info, LogConfig config = LogConfig::All, bool allowSpam = false);
+struct TENLogStats
+{
+	unsigned int DroppedCount	= 0; // Messages lost because log buffer was full.
+	unsigned int CollapsedCount = 0; // Repeated messages suppressed by rate limit.
+};
+
+// Identifies origin of log message for rate limiting. Same call site logging varying text is still one source of spam.
+struct LogCallSite
+{
+	size_t Id = 0;
+
+	explicit LogCallSite(size_t id) : Id(id) {}
+	LogCallSite(const char* file, int line) : Id(std::hash<std::string_view>{}(file) ^ ((size_t)line * 0x9E3779B97F4A7C15)) {}
+};
+
+void TENLogAt(const LogCallSite& callSite, std::string_view str, LogLevel level = LogLevel::Info, LogConfig config = LogConfig::All, bool allowSpam = false);
 void ShutdownTENLog();
 void InitTENLog(const std::string& logDirContainingDir);
+TENLogStats GetTENLogStats();
+
+#define TENLog(...) TENLogAt(LogCallSite(__FILE__, __LINE__), __VA_ARGS__)
 
 class TENScriptException : public std::runtime_error
 {
@@ -0,0 +1,290 @@
+#include "framework.h"
+#include "Game/effects/ParticlePool.h"
+
+#include <chrono>
+#include <iomanip>
+#include <sstream>
+
+#include "Game/effects/effects.h"
+#include "Specific/Benchmark.h"
+
+using namespace TEN::Benchmark;
+using namespace TEN::Math;
+
+namespace TEN::Effects::ParticlePool
+{
+	ParticlePoolController g_ParticlePool = {};
+
+	int ParticlePoolController::GetCapacity() const
+	{
+		return (int)_particles.size();
+	}
+
+	int ParticlePoolController::GetAliveCount() const
+	{
+		return _aliveCount;
+	}
+
+	Particle& ParticlePoolController::GetParticle(int index)
+	{
+		return _particles[index];
+	}
+
+	void ParticlePoolController::Initialize(int capacity)
+	{
+		_particles.assign(capacity, Particle{});
+		for (auto& particle : _particles)
+			particle.dynamic = -1;
+
+		_recycleCount = 0;
+		_isRecycleLogged = false;
+		Rebuild();
+	}
+
+	// Packs particles switched on anywhere in storage to front after particles were written directly.
+	void ParticlePoolController::Rebuild()
+	{
+		_aliveCount = 0;
+		for (int i = 0; i < _particles.size(); i++)
+		{
+			if (!_particles[i].on)
+				continue;
+
+			if (i != _aliveCount)
+			{
+				_particles[_aliveCount] = _particles[i];
+				_particles[i].on = false;
+			}
+
+			_aliveCount++;
+		}
+	}
+
+	// Removes switched off particles from alive range by moving last alive particle into their place.
+	// Update order therefore isn't spawn order, but stays deterministic.
+	void ParticlePoolController::Compact()
+	{
+		if (g_Benchmark.Profiler.IsEnabled())
+			g_Benchmark.Profiler.AddCount(ProfileCounter::ParticleRecycles, _recycleCount);
+
+		_recycleCount = 0;
+
+		int i = 0;
+		while (i < _aliveCount)
+		{
+			if (_particles[i].on)
+			{
+				i++;
+				continue;
+			}
+
+			_aliveCount--;
+			if (i != _aliveCount)
+			{
+				_particles[i] = _particles[_aliveCount];
+				_particles[_aliveCount].on = false;
+			}
+		}
+	}
+
+	Particle* ParticlePoolController::Allocate()
+	{
+		if (_particles.empty())
+			return nullptr;
+
+		if (_aliveCount < _particles.size())
+			return &_particles[_aliveCount++];
+
+		// Pool is full. Reuse particle switched off since last compaction, otherwise hijack particle with least remaining life.
+		int result = NO_VALUE;
+		int lifeMin = INT_MAX;
+
+		for (int i = 0; i < _aliveCount; i++)
+		{
+			auto& particle = _particles[i];
+
+			if (!particle.on)
+			{
+				result = i;
+				break;
+			}
+
+			if (particle.life < lifeMin && particle.dynamic == -1 && !(particle.flags & SP_EXPLOSION))
+			{
+				result = i;
+				lifeMin = particle.life;
+			}
+		}
+
+		// All particles are explosions or carry dynamic lights; recycle first particle rather than fail.
+		if (result == NO_VALUE)
+			result = 0;
+
+		auto& particle = _particles[result];
+		if (particle.on)
+		{
+			_recycleCount++;
+			if (!_isRecycleLogged)
+			{
+				TENLog("Particle pool of " + std::to_string(_particles.size()) + " is exhausted. Live particles are recycled.", LogLevel::Warning);
+				_isRecycleLogged = true;
+			}
+
+			// Detach light of hijacked particle, so it doesn't stay attached to new one.
+			// Light slot of switched off particle may already belong to another particle.
+			if (particle.dynamic != -1)
+				ParticleDynamics[particle.dynamic].On = false;
+		}
+
+		particle.dynamic = -1;
+
+		return &particle;
+	}
+
+	void ParticlePoolController::UpdateLife(int count)
+	{
+		for (int i = 0; i < count; i++)
+		{
+			auto& particle = _particles[i];
+
+			particle.life--;
+			bool isExpired = (particle.life == 0);
+
+			// Rare; only particles carrying dynamic light take this branch.
+			if (isExpired && particle.dynamic != -1)
+				ParticleDynamics[particle.dynamic].On = false;
+
+			particle.on = particle.on && !isExpired;
+		}
+	}
+
+	// Fades color from start to destination color, then to black at end of life. Particles faded to black are switched off.
+	// Particles expired in UpdateLife() are still processed; their life is 0 here, so both divisors are non-zero in their branches.
+	void ParticlePoolController::UpdateColor(int count)
+	{
+		for (int i = 0; i < count; i++)
+		{
+			auto& particle = _particles[i];
+
+			int age = particle.sLife - particle.life;
+			if (age < particle.colFadeSpeed)
+			{
+				int alpha = (age << 16) / particle.colFadeSpeed;
+				particle.r = particle.sR + ((alpha * (particle.dR - particle.sR)) >> 16);
+				particle.g = particle.sG + ((alpha * (particle.dG - particle.sG)) >> 16);
+				particle.b = particle.sB + ((alpha * (particle.dB - particle.sB)) >> 16);
+			}
+			else if (particle.life >= particle.fadeToBlack)
+			{
+				particle.r = particle.dR;
+				particle.g = particle.dG;
+				particle.b = particle.dB;
+			}
+			else
+			{
+				int alpha = (((particle.life - particle.fadeToBlack) << 16) / particle.fadeToBlack) + 0x10000;
+				particle.r = (particle.dR * alpha) >> 16;
+				particle.g = (particle.dG * alpha) >> 16;
+				particle.b = (particle.dB * alpha) >> 16;
+
+				particle.on = particle.on && !(particle.r < 8 && particle.g < 8 && particle.b < 8);
+			}
+		}
+	}
+
+	// Applies gravity, friction and wind, then integrates position and interpolates size over lifetime.
+	// Conditional terms are written as selects, so loop body has no data-dependent branches.
+	void ParticlePoolController::UpdateMotion(int count, const Vector3& wind)
+	{
+		for (int i = 0; i < count; i++)
+		{
+			auto& particle = _particles[i];
+
+			int horizontalFriction = particle.friction & 0xF;
+			int verticalFriction = particle.friction >> 4;
+
+			particle.yVel += particle.gravity;
+			particle.yVel = (particle.maxYvel && particle.yVel > particle.maxYvel) ? particle.maxYvel : particle.yVel;
+
+			particle.xVel -= horizontalFriction ? (particle.xVel >> horizontalFriction) : 0;
+			particle.zVel -= horizontalFriction ? (particle.zVel >> horizontalFriction) : 0;
+			particle.yVel -= verticalFriction ? (particle.yVel >> verticalFriction) : 0;
+
+			particle.x += particle.xVel >> 5;
+			particle.y += particle.yVel >> 5;
+			particle.z += particle.zVel >> 5;
+
+			bool isWind = (particle.flags & SP_WIND) != 0;
+			particle.x += isWind ? wind.x : 0.0f;
+			particle.z += isWind ? wind.z : 0.0f;
+
+			int alpha = ((particle.sLife - particle.life) * 65536) / std::max(particle.sLife, 1);
+			particle.size = particle.sSize + ((alpha * (particle.dSize - particle.sSize)) / 65536);
+		}
+	}
+
+	// Measures particle pool spawn and batched update cost at increasing particle counts.
+	// Doesn't depend on level data, so it runs before any level is loaded.
+	std::string RunParticleBenchmark()
+	{
+		constexpr auto UPDATE_FRAME_COUNT = 100;
+		constexpr auto PARTICLE_COUNTS	  = std::array<int, 3>{ 1000, 10000, 100000 };
+
+		auto stream = std::ostringstream();
+		stream << std::fixed << std::setprecision(3);
+		stream << std::left << std::setw(12) << "Particles" << std::right <<
+			std::setw(14) << "spawn (ms)" << std::setw(14) << "update (ms)" << std::setw(18) << "update (ns/part)" << std::endl;
+
+		for (int count : PARTICLE_COUNTS)
+		{
+			auto pool = ParticlePoolController{};
+			pool.Initialize(count);
+
+			auto startTime = std::chrono::high_resolution_clock::now();
+			for (int i = 0; i < count; i++)
+			{
+				auto& particle = *pool.Allocate();
+				particle = Particle{};
+				particle.on = true;
+				particle.dynamic = -1;
+				particle.x = Random::GenerateInt(-BLOCK(8), BLOCK(8));
+				particle.y = Random::GenerateInt(-BLOCK(8), BLOCK(8));
+				particle.z = Random::GenerateInt(-BLOCK(8), BLOCK(8));
+				particle.xVel = Random::GenerateInt(-512, 512);
+				particle.yVel = Random::GenerateInt(-512, 512);
+				particle.zVel = Random::GenerateInt(-512, 512);
+				particle.gravity = Random::GenerateInt(-8, 8);
+				particle.friction = 0x33;
+				particle.sR = particle.sG = particle.sB = 255;
+				particle.dR = particle.dG = particle.dB = 64;
+				particle.colFadeSpeed = 8;
+				particle.fadeToBlack = 16;
+				particle.sSize = 8.0f;
+				particle.dSize = 32.0f;
+				particle.sLife = particle.life = (UPDATE_FRAME_COUNT * 2) + Random::GenerateInt(0, UPDATE_FRAME_COUNT);
+			}
+
+			auto spawnEndTime = std::chrono::high_resolution_clock::now();
+			for (int frame = 0; frame < UPDATE_FRAME_COUNT; frame++)
+			{
+				pool.Compact();
+
+				int aliveCount = pool.GetAliveCount();
+				pool.UpdateLife(aliveCount);
+				pool.UpdateColor(aliveCount);
+				pool.UpdateMotion(aliveCount, Vector3::Zero);
+			}
+
+			auto updateEndTime = std::chrono::high_resolution_clock::now();
+			double spawnTime = std::chrono::duration<double, std::milli>(spawnEndTime - startTime).count();
+			double updateTime = std::chrono::duration<double, std::milli>(updateEndTime - spawnEndTime).count() / UPDATE_FRAME_COUNT;
+
+			stream << std::left << std::setw(12) << count << std::right <<
+				std::setw(14) << spawnTime <<
+				std::setw(14) << updateTime <<
+				std::setw(18) << ((updateTime * 1000000.0) / count) << std::endl;
+		}
+
+		return stream.str();
+	}
+}
@@ -0,0 +1,85 @@
+#pragma once
+#include "Math/Math.h"
+#include "Renderer/RendererEnums.h"
+
+// Fields touched by batched kernels every frame are grouped at front, so kernel passes
+// over dense alive range stay within first cache line of each particle.
+struct Particle
+{
+	int x;
+	int y;
+	int z;
+	short xVel;
+	short yVel;
+	short zVel;
+	short gravity;
+	int sLife;
+	int life;
+	float sSize;
+	float dSize;
+	float size;
+	unsigned short flags; // SP_enum
+	unsigned char friction;
+	signed char maxYvel;
+	bool on;
+	unsigned char colFadeSpeed;
+	unsigned char fadeToBlack;
+	unsigned char sR;
+	unsigned char sG;
+	unsigned char sB;
+	unsigned char dR;
+	unsigned char dG;
+	unsigned char dB;
+	unsigned char r;
+	unsigned char g;
+	unsigned char b;
+	signed char dynamic;
+
+	short rotAng;
+	unsigned char scalar;
+	unsigned char spriteIndex;
+	signed char rotAdd;
+	BlendMode blendMode;
+	unsigned char extras;
+	int fxObj;
+	int roomNumber;
+	unsigned char nodeNumber; // ParticleNodeOffsetIDs enum.
+};
+
+namespace TEN::Effects::ParticlePool
+{
+	// Fixed-capacity particle storage. Live particles are kept densely packed in [0, alive count),
+	// so batched kernels walk contiguous memory without indirection or per-particle liveness checks.
+	// Particles may be switched off anywhere by clearing Particle::on; such particles stay in alive
+	// range until next Compact() swaps them out, so indices are only stable between compactions.
+	class ParticlePoolController
+	{
+	private:
+		// Members
+		std::vector<Particle> _particles		= {};
+		int					  _aliveCount		= 0;
+		int					  _recycleCount		= 0; // Live particles recycled since last compaction.
+		bool				  _isRecycleLogged	= false;
+
+	public:
+		// Getters
+		int		  GetCapacity() const;
+		int		  GetAliveCount() const;
+		Particle& GetParticle(int index);
+
+		// Utilities
+		void	  Initialize(int capacity);
+		void	  Rebuild();
+		void	  Compact();
+		Particle* Allocate();
+
+		// Batched kernels over first count alive particles. Expect compacted pool, i.e. all particles in range switched on.
+		void UpdateLife(int count);
+		void UpdateColor(int count);
+		void UpdateMotion(int count, const Vector3& wind);
+	};
+
+	extern ParticlePoolController g_ParticlePool;
+
+	std::string RunParticleBenchmark();
+}
@@ -0,0 +1,74 @@
+#include "framework.h"
+#include "Game/effects/SwarmGrid.h"
+
+namespace TEN::Effects::Swarm
+{
+	SwarmGrid::SwarmGrid(float cellSize)
+	{
+		_cellSize = cellSize;
+	}
+
+	int SwarmGrid::GetAgentCount() const
+	{
+		return (int)_agentIDs.size();
+	}
+
+	void SwarmGrid::Clear()
+	{
+		_agentIDs.clear();
+		_agentCells.clear();
+		_sortedAgentIDs.clear();
+		_sortedAgentCells.clear();
+	}
+
+	void SwarmGrid::AddAgent(int agentID, const Vector3& pos)
+	{
+		_agentIDs.push_back(agentID);
+		_agentCells.push_back(GetCell(pos));
+	}
+
+	void SwarmGrid::Build()
+	{
+		// Keep roughly 2 buckets per agent so most buckets hold single cell.
+		int bucketCount = BUCKET_COUNT_MIN;
+		while (bucketCount < (GetAgentCount() * 2))
+			bucketCount *= 2;
+
+		_bucketMask = bucketCount - 1;
+		_bucketStarts.assign(bucketCount + 1, 0);
+
+		// Count agents per bucket.
+		for (const auto& cell : _agentCells)
+			_bucketStarts[GetBucket(cell) + 1]++;
+
+		// Prefix sum gives start of each bucket.
+		for (int i = 0; i < bucketCount; i++)
+			_bucketStarts[i + 1] += _bucketStarts[i];
+
+		// Scatter agents into buckets.
+		auto nextIndices = std::vector<int>(_bucketStarts.begin(), _bucketStarts.end() - 1);
+		_sortedAgentIDs.resize(_agentIDs.size());
+		_sortedAgentCells.resize(_agentCells.size());
+
+		for (int i = 0; i < _agentIDs.size(); i++)
+		{
+			int index = nextIndices[GetBucket(_agentCells[i])]++;
+			_sortedAgentIDs[index] = _agentIDs[i];
+			_sortedAgentCells[index] = _agentCells[i];
+		}
+	}
+
+	Vector3i SwarmGrid::GetCell(const Vector3& pos) const
+	{
+		return Vector3i(
+			(int)floor(pos.x / _cellSize),
+			(int)floor(pos.y / _cellSize),
+			(int)floor(pos.z / _cellSize));
+	}
+
+	int SwarmGrid::GetBucket(const Vector3i& cell) const
+	{
+		unsigned int hash = ((unsigned int)cell.x * 73856093u) ^ ((unsigned int)cell.y * 19349663u) ^ ((unsigned int)cell.z * 83492791u);
+		return int(hash & (unsigned int)_bucketMask);
+	}
+}
@@ -0,0 +1,76 @@
+#pragma once
+#include "Math/Math.h"
+
+using namespace TEN::Math;
+
+namespace TEN::Effects::Swarm
+{
+	// Spatial hash of swarm agents, rebuilt every frame for neighbor queries.
+	// Agents are counting-sorted into hashed cells, so build and query costs are linear in agent count.
+	class SwarmGrid
+	{
+	private:
+		// Constants
+		static constexpr auto BUCKET_COUNT_MIN = 64;
+
+		// Members
+		float _cellSize	  = 0.0f;
+		int	  _bucketMask = 0;
+
+		// Agent data in insertion order.
+		std::vector<int>	  _agentIDs	  = {};
+		std::vector<Vector3i> _agentCells = {};
+
+		// Agent data sorted by bucket.
+		std::vector<int>	  _bucketStarts		= {}; // Bucket count + 1 entries.
+		std::vector<int>	  _sortedAgentIDs	= {};
+		std::vector<Vector3i> _sortedAgentCells = {};
+
+	public:
+		// Constructors
+		SwarmGrid(float cellSize);
+
+		// Getters
+		int GetAgentCount() const;
+
+		// Utilities
+		void Clear();
+		void AddAgent(int agentID, const Vector3& pos);
+		void Build();
+
+		// Calls func(agentID) once for each agent in cells overlapping sphere. Caller tests exact distance.
+		template <typename TFunc>
+		void ForEachNeighbor(const Vector3& pos, float radius, TFunc&& func) const
+		{
+			if (_sortedAgentIDs.empty())
+				return;
+
+			auto minCell = GetCell(pos - Vector3(radius));
+			auto maxCell = GetCell(pos + Vector3(radius));
+
+			for (int x = minCell.x; x <= maxCell.x; x++)
+			{
+				for (int y = minCell.y; y <= maxCell.y; y++)
+				{
+					for (int z = minCell.z; z <= maxCell.z; z++)
+					{
+						auto cell = Vector3i(x, y, z);
+						int bucket = GetBucket(cell);
+
+						// Different cells may share bucket, so skip agents from other cells to avoid duplicates.
+						for (int i = _bucketStarts[bucket]; i < _bucketStarts[bucket + 1]; i++)
+						{
+							if (_sortedAgentCells[i] == cell)
+								func(_sortedAgentIDs[i]);
+						}
+					}
+				}
+			}
+		}
+
+	private:
+		// Helpers
+		Vector3i GetCell(const Vector3& pos) const;
+		int		 GetBucket(const Vector3i& cell) const;
+	};
+}
@@ -31,6 +31,7 @@ using namespace TEN::Effects::Drip;
 using namespace TEN::Effects::Environment;
 using namespace TEN::Effects::Explosion;
 using namespace TEN::Effects::Items;
+using namespace TEN::Effects::ParticlePool;
 using namespace TEN::Effects::Ripple;
 using namespace TEN::Effects::Spark;
 using namespace TEN::Math;
@@ -38,8 +39,6 @@ using namespace TEN::Math::Random;
 
 using TEN::Renderer::g_Renderer;
 
-// New particle class
-Particle Particles[MAX_PARTICLES];
 ParticleDynamic ParticleDynamics[MAX_PARTICLE_DYNAMICS];
 
 FX_INFO EffectList[NUM_EFFECTS];
@@ -75,10 +74,10 @@ NODEOFFSET_INFO NodeOffsets[ParticleNodeOffsetIDs::NodeMax] =
 
 void DetatchSpark(int number, SpriteEnumFlag type)
 {
-	auto* sptr = &Particles[0];
-
-	for (int lp = 0; lp < MAX_PARTICLES; lp++, sptr++)
+	for (int i = 0; i < g_ParticlePool.GetAliveCount(); i++)
 	{
+		auto* sptr = &g_ParticlePool.GetParticle(i);
+
 		if (sptr->on && (sptr->flags & type) && sptr->fxObj == number)
 		{
 			switch (type)
@@ -119,39 +118,7 @@ void DetatchSpark(int number, SpriteEnumFlag type)
 
 Particle* GetFreeParticle()
 {
-	int result = -1;
-
-	// Get first free available spark
-
-	for (int i = 0; i < MAX_PARTICLES; i++)
-	{
-		auto* particle = &Particles[i];
-
-		if (!particle->on)
-		{
-			result = i;
-			break;
-		}
-	}
-
-	// No free sparks left, hijack existing one with less possible life
-
-	int life = INT_MAX;
-	if (result == -1)
-	{
-		for (int i = 0; i < MAX_PARTICLES; i++)
-		{
-			auto* particle = &Particles[i];
-
-			if (particle->life < life && particle->dynamic == -1 && !(particle->flags & SP_EXPLOSION))
-			{
-				result = i;
-				life = particle->life;
-			}
-		}
-	}
-
-	auto* spark = &Particles[result];
+	auto* spark = g_ParticlePool.Allocate();
 
 	spark->extras = 0;
 	spark->dynamic = -1;
@@ -189,50 +156,20 @@ void UpdateSparks()
 		LaraItem->Pose.Position.z + bounds.Z1,
 		LaraItem->Pose.Position.z + bounds.Z2);
 
-	for (int i = 0; i < MAX_PARTICLES; i++)
+	// Pack particles switched off since last update out of alive range, so kernels only see live ones.
+	// Particles spawned during update are first updated on next frame.
+	g_ParticlePool.Compact();
+	int count = g_ParticlePool.GetAliveCount();
+
+	g_ParticlePool.UpdateLife(count);
+	g_ParticlePool.UpdateColor(count);
+
+	for (int i = 0; i < count; i++)
 	{
-		auto* spark = &Particles[i];
+		auto* spark = &g_ParticlePool.GetParticle(i);
 
 		if (spark->on)
 		{
-			spark->life--;
-
-			if (!spark->life)
-			{
-				if (spark->dynamic != -1)
-					ParticleDynamics[spark->dynamic].On = false;
-
-				spark->on = false;
-				continue;
-			}
-			
-			int life = spark->sLife - spark->life;
-			if (life < spark->colFadeSpeed)
-			{
-				int dl = (life << 16) / spark->colFadeSpeed;
-				spark->r = spark->sR + (dl * (spark->dR - spark->sR) >> 16);
-				spark->g = spark->sG + (dl * (spark->dG - spark->sG) >> 16);
-				spark->b = spark->sB + (dl * (spark->dB - spark->sB) >> 16);
-			}
-			else if (spark->life >= spark->fadeToBlack)
-			{
-				spark->r = spark->dR;
-				spark->g = spark->dG;
-				spark->b = spark->dB;
-			}
-			else
-			{
-				spark->r = (spark->dR * (((spark->life - spark->fadeToBlack) << 16) / spark->fadeToBlack + 0x10000)) >> 16;
-				spark->g = (spark->dG * (((spark->life - spark->fadeToBlack) << 16) / spark->fadeToBlack + 0x10000)) >> 16;
-				spark->b = (spark->dB * (((spark->life - spark->fadeToBlack) << 16) / spark->fadeToBlack + 0x10000)) >> 16;
-
-				if (spark->r < 8 && spark->g < 8 && spark->b < 8)
-				{
-					spark->on = 0;
-					continue;
-				}
-			}
-
 			if (spark->life == spark->colFadeSpeed)
 			{
 				if (spark->flags & SP_UNDERWEXP)
@@ -297,36 +234,17 @@ void UpdateSparks()
 
 				spark->extras = 0;
 			}
+		}
+	}
 
-			spark->yVel += spark->gravity;
-			if (spark->maxYvel)
-			{
-				if (spark->yVel > spark->maxYvel)
-					spark->yVel = spark->maxYvel;
-			}
-
-			if (spark->friction & 0xF)
-			{
-				spark->xVel -= spark->xVel >> (spark->friction & 0xF);
-				spark->zVel -= spark->zVel >> (spark->friction & 0xF);
-			}
-
-			if (spark->friction & 0xF0)
-				spark->yVel -= spark->yVel >> (spark->friction >> 4);
-
-			spark->x += spark->xVel >> 5;
-			spark->y += spark->yVel >> 5;
-			spark->z += spark->zVel >> 5;
+	g_ParticlePool.UpdateMotion(count, Weather.Wind());
 
-			if (spark->flags & SP_WIND)
-			{
-				spark->x += Weather.Wind().x;
-				spark->z += Weather.Wind().z;
-			}
+	for (int i = 0; i < count; i++)
+	{
+		auto* spark = &g_ParticlePool.GetParticle(i);
 
-			int dl = ((spark->sLife - spark->life) * 65536) / spark->sLife;
-			spark->size = (spark->sSize + ((dl * (spark->dSize - spark->sSize)) / 65536));
-		
+		if (spark->on)
+		{
 			if (spark->flags & SP_EXPLOSION)
 				SetSpriteSequence(*spark, ID_EXPLOSION_SPRITES);
 
@@ -357,9 +275,9 @@ void UpdateSparks()
 		}
 	}
 
-	for (int i = 0; i < MAX_PARTICLES; i++)
+	for (int i = 0; i < count; i++)
 	{
-		auto* spark = &Particles[i];
+		auto* spark = &g_ParticlePool.GetParticle(i);
 
 		if (spark->on && spark->dynamic != -1)
 		{
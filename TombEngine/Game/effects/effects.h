@@ -1,4 +1,5 @@
 #pragma once
+#include "Game/effects/ParticlePool.h"
 #include "Math/Math.h"
 #include "Renderer/RendererEnums.h"
 
@@ -121,47 +122,6 @@ struct RIPPLE_STRUCT
 	unsigned char init;
 };
 
-struct Particle
-{
-	int x;
-	int y;
-	int z;
-	short xVel;
-	short yVel;
-	short zVel;
-	short gravity;
-	short rotAng;
-	unsigned short flags; // SP_enum
-	float sSize;
-	float dSize;
-	float size;
-	unsigned char friction;
-	unsigned char scalar;
-	unsigned char spriteIndex;
-	signed char rotAdd;
-	signed char maxYvel;
-	bool on;
-	unsigned char sR;
-	unsigned char sG;
-	unsigned char sB;
-	unsigned char dR;
-	unsigned char dG;
-	unsigned char dB;
-	unsigned char r;
-	unsigned char g;
-	unsigned char b;
-	unsigned char colFadeSpeed;
-	unsigned char fadeToBlack;
-	int sLife;
-	int life;
-	BlendMode blendMode;
-	unsigned char extras;
-	signed char dynamic;
-	int fxObj;
-	int roomNumber;
-	unsigned char nodeNumber; // ParticleNodeOffsetIDs enum.
-};
-
 struct SPLASH_STRUCT
 {
 	float x;
@@ -196,8 +156,6 @@ struct ParticleDynamic
 
 extern GameBoundingBox DeadlyBounds;
 
-// New particle class
-extern Particle Particles[MAX_PARTICLES];
 extern ParticleDynamic ParticleDynamics[MAX_PARTICLE_DYNAMICS];
 
 extern SPLASH_SETUP SplashSetup;
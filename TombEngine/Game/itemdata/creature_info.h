@@ -48,6 +48,7 @@ struct LOTInfo
 	bool Initialized = false;
 
 	std::vector<BoxNode> Node = {};
+	std::vector<int>	 Path = {}; // Boxes from creature to target found by A* search.
 	int Head = 0;
 	int Tail = 0;
 
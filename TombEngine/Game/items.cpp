@@ -1,6 +1,7 @@
 #include "framework.h"
 #include "Game/items.h"
 
+#include "Game/collision/BroadPhase.h"
 #include "Game/collision/floordata.h"
 #include "Game/collision/collide_room.h"
 #include "Game/control/control.h"
@@ -25,6 +26,7 @@
 #include "Specific/level.h"
 #include "Specific/trutils.h"
 
+using namespace TEN::Collision::BroadPhase;
 using namespace TEN::Collision::Floordata;
 using namespace TEN::Control::Volumes;
 using namespace TEN::Effects::Items;
@@ -195,17 +197,14 @@ static void GameScriptHandleKilled(short itemNumber, bool destroyed)
 	auto* item = &g_Level.Items[itemNumber];
 
 	g_GameScriptEntities->TryRemoveColliding(itemNumber, true);
-	if (!item->Callbacks.OnKilled.empty())
+	if (!item->Callbacks.OnKilled.Name.empty())
 		g_GameScript->ExecuteFunction(item->Callbacks.OnKilled, itemNumber);
 
 	if (destroyed)
 	{
 		g_GameScriptEntities->NotifyKilled(item);
 		item->Name.clear();
-		item->Callbacks.OnKilled.clear();
-		item->Callbacks.OnHit.clear();
-		item->Callbacks.OnObjectCollided.clear();
-		item->Callbacks.OnRoomCollided.clear();
+		item->Callbacks = EntityCallbackData{};
 	}
 }
 
@@ -258,6 +257,8 @@ void KillItem(short const itemNumber)
 					}
 				}
 			}
+
+			g_BroadPhase.RemoveItem(itemNumber);
 		}
 
 		if (item == Lara.TargetEntity)
@@ -355,6 +356,8 @@ void ItemNewRoom(short itemNumber, short roomNumber)
 		item->RoomNumber = roomNumber;
 		item->NextItem = g_Level.Rooms[roomNumber].itemNumber;
 		g_Level.Rooms[roomNumber].itemNumber = itemNumber;
+
+		g_BroadPhase.UpdateItem(itemNumber);
 	}
 }
 
@@ -495,6 +498,8 @@ void RemoveDrawnItem(short itemNumber)
 			}
 		}
 	}
+
+	g_BroadPhase.RemoveItem(itemNumber);
 }
 
 void RemoveActiveItem(short itemNumber, bool killed) 
@@ -580,6 +585,7 @@ void InitializeItem(short itemNumber)
 	auto* room = &g_Level.Rooms[item->RoomNumber];
 	item->NextItem = room->itemNumber;
 	room->itemNumber = itemNumber;
+	g_BroadPhase.UpdateItem(itemNumber);
 
 	FloorInfo* floor = GetSector(room, item->Pose.Position.x - room->x, item->Pose.Position.z - room->z);
 	item->Floor = floor->GetSurfaceHeight(item->Pose.Position.x, item->Pose.Position.z, true);
@@ -761,6 +767,10 @@ void UpdateAllItems()
 			if (Objects[item->ObjectNumber].control)
 				Objects[item->ObjectNumber].control(itemNumber);
 
+			if (item->IsBridge())
+				UpdateBridgeItemPose(*item);
+
+			g_BroadPhase.UpdateItem(itemNumber);
 			TestVolumes(itemNumber);
 			ProcessEffects(item);
 
@@ -813,6 +823,8 @@ bool UpdateItemRoom(short itemNumber)
 		return true;
 	}
 
+	// Called after item moved, possibly by another item's control routine. Re-bucket within same room.
+	g_BroadPhase.UpdateItem(itemNumber);
 	return false;
 }
 
@@ -862,7 +874,7 @@ void DoItemHit(ItemInfo* target, int damage, bool isExplosive, bool allowBurn)
 	if (isExplosive && allowBurn && Random::TestProbability(1 / 2.0f))
 		ItemBurn(target);
 
-	if (!target->Callbacks.OnHit.empty())
+	if (!target->Callbacks.OnHit.Name.empty())
 	{
 		short index = g_GameScriptEntities->GetIndexByName(target->Name);
 		g_GameScript->ExecuteFunction(target->Callbacks.OnHit, index);
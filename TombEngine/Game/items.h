@@ -2,6 +2,7 @@
 #include "Game/animation.h"
 #include "Game/itemdata/itemdata.h"
 #include "Math/Math.h"
+#include "Scripting/Include/ScriptCallback.h"
 #include "Specific/BitField.h"
 #include "Objects/game_object_ids.h"
 #include "Specific/newtypes.h"
@@ -78,10 +79,10 @@ struct EntityAnimationData
 
 struct EntityCallbackData
 {
-	std::string OnKilled		 = {};
-	std::string OnHit			 = {};
-	std::string OnObjectCollided = {};
-	std::string OnRoomCollided	 = {};
+	ScriptCallback OnKilled			= {};
+	ScriptCallback OnHit			= {};
+	ScriptCallback OnObjectCollided = {};
+	ScriptCallback OnRoomCollided	= {};
 };
 
 struct EntityEffectData
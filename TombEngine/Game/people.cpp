@@ -3,6 +3,7 @@
 
 #include "Game/animation.h"
 #include "Game/control/los.h"
+#include "Game/collision/Raycast.h"
 #include "Game/collision/sphere.h"
 #include "Game/effects/effects.h"
 #include "Game/effects/debris.h"
@@ -12,6 +13,8 @@
 #include "Game/misc.h"
 #include "Sound/sound.h"
 
+using namespace TEN::Collision::Raycast;
+
 bool ShotLara(ItemInfo* item, AI_INFO* AI, const CreatureBiteInfo& gun, short extraRotation, int damage)
 {
 	auto* creature = GetCreatureInfo(item);
@@ -133,13 +136,19 @@ bool Targetable(ItemInfo* item, AI_INFO* ai)
 		enemy->Pose.Position.z,
 		enemy->RoomNumber); // TODO: Check why this line didn't exist in the first place. -- TokyoSU 2022.08.05
 
+	// Rooms of clear LOS cover whole ray, so object pass reuses them.
+	auto losTarget = target;
+	auto rayHit = RoomRayHit{};
+	if (!LOS(&origin, &losTarget, &rayHit))
+		return false;
+
 	MESH_INFO* mesh = nullptr;
 	Vector3i vector = {};
-	int losItemIndex = ObjectOnLOS2(&origin, &target, &vector, &mesh);
+	int losItemIndex = ObjectOnLOS2(&origin, &target, &vector, &mesh, GAME_OBJECT_ID::ID_NO_OBJECT, &rayHit);
 	if (losItemIndex == item->Index)
 		losItemIndex = NO_LOS_ITEM; // Don't find itself
 
-	return (LOS(&origin, &target) && losItemIndex == NO_LOS_ITEM && mesh == nullptr);
+	return (losItemIndex == NO_LOS_ITEM && mesh == nullptr);
 }
 
 bool TargetVisible(ItemInfo* item, AI_INFO* ai, float maxAngleInDegrees)
@@ -1,9 +1,14 @@
 #include "framework.h"
 #include "Game/room.h"
 
+#include "Game/collision/BroadPhase.h"
 #include "Game/collision/collide_room.h"
+#include "Game/collision/CollisionCache.h"
+#include "Game/collision/Raycast.h"
+#include "Game/collision/RoomIndex.h"
 #include "Game/control/control.h"
 #include "Game/control/lot.h"
+#include "Game/control/Pathfinding.h"
 #include "Game/control/volume.h"
 #include "Game/items.h"
 #include "Renderer/Renderer.h"
@@ -12,7 +17,12 @@
 #include "Specific/trutils.h"
 
 using namespace TEN::Math;
+using namespace TEN::Collision::BroadPhase;
+using namespace TEN::Collision::CollisionCache;
+using namespace TEN::Collision::Raycast;
 using namespace TEN::Collision::Floordata;
+using namespace TEN::Collision::RoomIndex;
+using namespace TEN::Control::Pathfinding;
 using namespace TEN::Renderer;
 using namespace TEN::Utils;
 
@@ -20,8 +30,6 @@ bool FlipStatus = false;
 bool FlipStats[MAX_FLIPMAP];
 int  FlipMap[MAX_FLIPMAP];
 
-std::vector<short> OutsideRoomTable[OUTSIDE_SIZE][OUTSIDE_SIZE];
-
 bool ROOM_INFO::Active() const
 {
 	if (flipNumber == NO_VALUE)
@@ -99,6 +107,9 @@ void DoFlipMap(int group)
 			room.fxNumber = flippedRoom.fxNumber;
 
 			AddRoomFlipItems(room);
+			g_BroadPhase.RebuildRoom(roomNumber);
+			g_Raycast.RebuildRoom(roomNumber);
+			g_Raycast.RebuildRoom(room.flippedRoom);
 
 			g_Renderer.FlipRooms(roomNumber, room.flippedRoom);
 
@@ -112,6 +123,12 @@ void DoFlipMap(int group)
 		}
 	}
 
+	// Sector pointers now refer to swapped room data.
+	g_CollisionCache.Invalidate();
+
+	// Path cache key holds only last toggled flip status, so paths through other flipped rooms may be stale.
+	g_Pathfinding.InvalidateCache();
+
 	FlipStatus =
 	FlipStats[group] = !FlipStats[group];
 
@@ -145,15 +162,8 @@ int IsRoomOutside(int x, int y, int z)
 	if (x < 0 || z < 0)
 		return NO_VALUE;
 
-	int xTable = x / BLOCK(1);
-	int zTable = z / BLOCK(1);
-
-	if (OutsideRoomTable[xTable][zTable].empty())
-		return NO_VALUE;
-
-	for (int i = 0; i < OutsideRoomTable[xTable][zTable].size(); i++)
+	for (int roomNumber : g_RoomIndex.GetRooms(x, z))
 	{
-		int roomNumber = OutsideRoomTable[xTable][zTable][i];
 		const auto& room = g_Level.Rooms[roomNumber];
 
 		if ((x > (room.x + BLOCK(1)) && x < (room.x + (room.xSize - 1) * BLOCK(1))) &&
@@ -210,6 +220,31 @@ GameBoundingBox& GetBoundsAccurate(const MESH_INFO& mesh, bool getVisibilityBox)
 	return bounds;
 }
 
+// Returns index of room whose mesh list holds static. Flipmaps swap room data, so
+// MESH_INFO::roomNumber names room static was loaded into, not room currently holding it.
+int GetStaticRoomNumber(const MESH_INFO& staticObj)
+{
+	auto isInRoom = [&staticObj](int roomNumber)
+	{
+		if (roomNumber < 0 || roomNumber >= g_Level.Rooms.size())
+			return false;
+
+		const auto& mesh = g_Level.Rooms[roomNumber].mesh;
+		return (!mesh.empty() && &staticObj >= mesh.data() && &staticObj < (mesh.data() + mesh.size()));
+	};
+
+	if (isInRoom(staticObj.roomNumber))
+		return staticObj.roomNumber;
+
+	for (int roomNumber = 0; roomNumber < g_Level.Rooms.size(); roomNumber++)
+	{
+		if (isInRoom(roomNumber))
+			return roomNumber;
+	}
+
+	return NO_VALUE;
+}
+
 bool IsPointInRoom(const Vector3i& pos, int roomNumber)
 {
 	const auto& room = g_Level.Rooms[roomNumber];
@@ -240,11 +275,9 @@ int FindRoomNumber(const Vector3i& pos, int startRoomNumber)
 		}
 	}
 
-	for (int roomNumber = 0; roomNumber < g_Level.Rooms.size(); roomNumber++)
-	{
-		if (IsPointInRoom(pos, roomNumber) && g_Level.Rooms[roomNumber].Active())
-			return roomNumber;
-	}
+	int roomNumber = g_RoomIndex.GetRoomNumber(pos);
+	if (roomNumber != NO_VALUE)
+		return roomNumber;
 
 	return (startRoomNumber != NO_VALUE) ? startRoomNumber : 0;
 }
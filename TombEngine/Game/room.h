@@ -13,7 +13,6 @@ struct TriggerVolume;
 constexpr auto MAX_FLIPMAP	= 256;
 constexpr auto NUM_ROOMS	= 1024;
 constexpr auto OUTSIDE_Z	= 64;
-constexpr auto OUTSIDE_SIZE = 1024;
 
 extern bool FlipStatus;
 extern bool FlipStats[MAX_FLIPMAP];
@@ -134,4 +133,5 @@ int IsRoomOutside(int x, int y, int z);
 void InitializeNeighborRoomList();
 
 GameBoundingBox& GetBoundsAccurate(const MESH_INFO& mesh, bool getVisibilityBox);
+int GetStaticRoomNumber(const MESH_INFO& staticObj);
 FloorInfo* GetSector(ROOM_INFO* room, int x, int z);
@@ -1,14 +1,21 @@
 #include "framework.h"
 #include "Game/savegame.h"
 
+#include <chrono>
 #include <filesystem>
+#include <iomanip>
+#include <sstream>
+#include <zlib.h>
 
+#include "Game/collision/BroadPhase.h"
+#include "Game/collision/Raycast.h"
 #include "Game/collision/collide_room.h"
 #include "Game/collision/floordata.h"
 #include "Game/control/box.h"
 #include "Game/control/event.h"
 #include "Game/control/flipeffect.h"
 #include "Game/control/lot.h"
+#include "Game/control/Pathfinding.h"
 #include "Game/control/volume.h"
 #include "Game/effects/item_fx.h"
 #include "Game/effects/effects.h"
@@ -34,18 +41,24 @@
 #include "Scripting/Include/Objects/ScriptInterfaceObjectsHandler.h"
 #include "Sound/sound.h"
 #include "Specific/clock.h"
+#include "Specific/IO/AsyncFileWriter.h"
 #include "Specific/level.h"
 #include "Specific/savegame/flatbuffers/ten_savegame_generated.h"
 
 using namespace flatbuffers;
+using namespace TEN::Collision::BroadPhase;
+using namespace TEN::Collision::Raycast;
 using namespace TEN::Collision::Floordata;
+using namespace TEN::Control::Pathfinding;
 using namespace TEN::Control::Volumes;
 using namespace TEN::Effects::Items;
+using namespace TEN::Effects::ParticlePool;
 using namespace TEN::Entities::Creatures::TR3;
 using namespace TEN::Entities::Generic;
 using namespace TEN::Entities::Switches;
 using namespace TEN::Entities::TR4;
 using namespace TEN::Gui;
+using namespace TEN::Math;
 using namespace TEN::Renderer;
 
 namespace Save = TEN::Save;
@@ -54,24 +67,32 @@ constexpr auto SAVEGAME_MAX_SLOT  = 99;
 constexpr auto SAVEGAME_PATH	  = "Save//";
 constexpr auto SAVEGAME_FILE_MASK = "savegame.";
 
+// Written instead of hub count by savegames which store compressed hub snapshots. Older savegames store non-negative hub count.
+constexpr auto SAVEGAME_COMPRESSED_HUB_TAG = -1;
+
 GameStats SaveGame::Statistics;
 SaveGameHeader SaveGame::Infos[SAVEGAME_MAX];
-std::map<int, std::vector<byte>> SaveGame::Hub;
+std::map<int, HubSnapshot> SaveGame::Hub;
 
-int SaveGame::LastSaveGame;
+int SaveGame::LastSaveGame = NO_VALUE;
 std::string SaveGame::FullSaveDirectory;
 
+static auto SaveGameWriter = AsyncFileWriter{};
+
 void SaveGame::LoadHeaders()
 {
+	// Headers must reflect savegames which are still being written.
+	SaveGameWriter.Flush();
+
 	for (int i = 0; i < SAVEGAME_MAX; i++)
 		Infos[i].Present = false;
 
-	if (!std::filesystem::is_directory(FullSaveDirectory))
-		return;
-
 	// Reset overall savegame count.
 	LastSaveGame = 0;
 
+	if (!std::filesystem::is_directory(FullSaveDirectory))
+		return;
+
 	// Try loading savegame.
 	for (int i = 0; i < SAVEGAME_MAX; i++)
 	{
@@ -184,7 +205,11 @@ bool SaveGame::IsSaveGameSlotValid(int slot)
 
 bool SaveGame::DoesSaveGameExist(int slot, bool silent)
 {
-	if (!std::filesystem::is_regular_file(GetSavegameFilename(slot)))
+	auto fileName = GetSavegameFilename(slot);
+	if (SaveGameWriter.IsPending(fileName))
+		return true;
+
+	if (!std::filesystem::is_regular_file(fileName))
 	{
 		if (!silent)
 			TENLog("Attempted to access missing savegame slot " + std::to_string(slot), LogLevel::Warning);
@@ -213,6 +238,34 @@ void SaveGame::Init(const std::string& gameDirectory)
 	FullSaveDirectory = gameDirectory + SAVEGAME_PATH;
 }
 
+void SaveGame::Deinit()
+{
+	SaveGameWriter.Deinitialize();
+}
+
+void SaveGame::Update()
+{
+	for (const auto& result : SaveGameWriter.TakeResults())
+	{
+		if (result.IsSuccess)
+		{
+			TENLog("Savegame #" + std::to_string(result.Tag) + " written (" + std::to_string(result.Size / 1024) + " KB, " +
+				std::to_string((int)result.Time) + " ms).", LogLevel::Info);
+		}
+		else
+		{
+			TENLog("Failed to write savegame #" + std::to_string(result.Tag) + " to " + result.Path + ". Previous savegame was kept.", LogLevel::Error);
+		}
+
+		g_GameScript->OnSaveComplete(result.Tag, result.IsSuccess);
+	}
+}
+
+bool SaveGame::IsSaveInProgress()
+{
+	return SaveGameWriter.IsBusy();
+}
+
 const std::vector<byte> SaveGame::Build()
 {
 	ItemInfo itemToSerialize{};
@@ -561,10 +614,10 @@ const std::vector<byte> SaveGame::Build()
 	for (auto& itemToSerialize : g_Level.Items) 
 	{
 		auto luaNameOffset = fbb.CreateString(itemToSerialize.Name);
-		auto luaOnKilledNameOffset = fbb.CreateString(itemToSerialize.Callbacks.OnKilled);
-		auto luaOnHitNameOffset = fbb.CreateString(itemToSerialize.Callbacks.OnHit);
-		auto luaOnCollidedObjectNameOffset = fbb.CreateString(itemToSerialize.Callbacks.OnObjectCollided);
-		auto luaOnCollidedRoomNameOffset = fbb.CreateString(itemToSerialize.Callbacks.OnRoomCollided);
+		auto luaOnKilledNameOffset = fbb.CreateString(itemToSerialize.Callbacks.OnKilled.Name);
+		auto luaOnHitNameOffset = fbb.CreateString(itemToSerialize.Callbacks.OnHit.Name);
+		auto luaOnCollidedObjectNameOffset = fbb.CreateString(itemToSerialize.Callbacks.OnObjectCollided.Name);
+		auto luaOnCollidedRoomNameOffset = fbb.CreateString(itemToSerialize.Callbacks.OnRoomCollided.Name);
 
 		std::vector<int> itemFlags;
 		for (int i = 0; i < 7; i++)
@@ -1078,9 +1131,9 @@ const std::vector<byte> SaveGame::Build()
 
 	// Particles
 	std::vector<flatbuffers::Offset<Save::ParticleInfo>> particles;
-	for (int i = 0; i < MAX_PARTICLES; i++)
+	for (int i = 0; i < g_ParticlePool.GetAliveCount(); i++)
 	{
-		auto* particle = &Particles[i];
+		auto* particle = &g_ParticlePool.GetParticle(i);
 
 		if (!particle->on)
 			continue;
@@ -1472,6 +1525,151 @@ const std::vector<byte> SaveGame::Build()
 	return result;
 }
 
+HubSnapshot SaveGame::CompressHubSnapshot(const std::vector<byte>& buffer)
+{
+	auto snapshot = HubSnapshot{};
+	snapshot.UncompressedSize = (int)buffer.size();
+
+	// Fastest level is used, since snapshots are compressed when leaving level and decompressed when reentering it.
+	auto compressedSize = compressBound((uLong)buffer.size());
+	auto compressedData = std::vector<byte>(compressedSize);
+	if (compress2(compressedData.data(), &compressedSize, buffer.data(), (uLong)buffer.size(), Z_BEST_SPEED) != Z_OK)
+	{
+		TENLog("Unable to compress hub data. Snapshot is kept uncompressed.", LogLevel::Warning);
+
+		snapshot.Data = std::make_shared<const std::vector<byte>>(buffer);
+		snapshot.IsCompressed = false;
+		return snapshot;
+	}
+
+	compressedData.resize(compressedSize);
+	compressedData.shrink_to_fit();
+
+	snapshot.Data = std::make_shared<const std::vector<byte>>(std::move(compressedData));
+	return snapshot;
+}
+
+// Measures zlib size and time at several levels on synthetic hub snapshot with savegame-like item records,
+// to back choice of fastest level for hub snapshots. zlib is only compressor available to engine.
+std::string RunHubCompressionBenchmark()
+{
+	constexpr auto ITEM_COUNT	   = 1024;
+	constexpr auto ROOM_COUNT	   = 256;
+	constexpr auto VAR_COUNT	   = 128;
+	constexpr auto ITERATION_COUNT = 20;
+	constexpr auto LEVELS		   = std::array<std::pair<int, const char*>, 3>
+	{
+		std::pair(Z_BEST_SPEED, "1 (best speed, used)"),
+		std::pair(Z_DEFAULT_COMPRESSION, "6 (default)"),
+		std::pair(Z_BEST_COMPRESSION, "9 (best compression)")
+	};
+
+	// Items share few object types and sit on sector grid, as in real levels; most fields keep default values.
+	auto fbb = FlatBufferBuilder{};
+	auto items = std::vector<flatbuffers::Offset<Save::Item>>{};
+	for (int i = 0; i < ITEM_COUNT; i++)
+	{
+		auto itemFlags = fbb.CreateVector(std::vector<int>{ Random::GenerateInt(0, 3), 0, 0, 0, 0, 0, 0, 0 });
+		auto pose = Save::Pose(
+			BLOCK(Random::GenerateInt(0, 100)) + CLICK(2), -CLICK(Random::GenerateInt(0, 32)), BLOCK(Random::GenerateInt(0, 100)) + CLICK(2),
+			0, ANGLE(90.0f) * Random::GenerateInt(0, 3), 0);
+		auto color = Save::Vector4(1.0f, 1.0f, 1.0f, 1.0f);
+
+		auto item = Save::ItemBuilder{ fbb };
+		item.add_object_id(Random::GenerateInt(0, 32));
+		item.add_anim_number(Random::GenerateInt(0, 8));
+		item.add_frame_number(Random::GenerateInt(0, 60));
+		item.add_active_state(Random::GenerateInt(0, 4));
+		item.add_target_state(Random::GenerateInt(0, 4));
+		item.add_room_number(Random::GenerateInt(0, ROOM_COUNT - 1));
+		item.add_hit_points(Random::TestProbability(0.2f) ? Random::GenerateInt(1, 40) : 0);
+		item.add_mesh_bits(-1);
+		item.add_flags(Random::TestProbability(0.5f) ? 0x3E00 : 0);
+		item.add_item_flags(itemFlags);
+		item.add_pose(&pose);
+		item.add_color(&color);
+		item.add_next_item(NO_VALUE);
+		item.add_next_item_active(NO_VALUE);
+		item.add_active(Random::TestProbability(0.3f));
+		items.push_back(item.Finish());
+	}
+
+	auto roomFlags = std::vector<int>(ROOM_COUNT);
+	for (auto& flags : roomFlags)
+		flags = Random::TestProbability(0.1f) ? 1 : 0;
+
+	auto varNames = std::vector<std::string>(VAR_COUNT);
+	for (int i = 0; i < VAR_COUNT; i++)
+		varNames[i] = "LevelVars.Engine.Variable" + std::to_string(i) + "=" + std::to_string(Random::GenerateInt(0, 1000));
+
+	auto itemsOffset = fbb.CreateVector(items);
+	auto roomFlagsOffset = fbb.CreateVector(roomFlags);
+	auto varsOffset = fbb.CreateVectorOfStrings(varNames);
+	fbb.Finish(fbb.CreateVector(std::vector<flatbuffers::Offset<void>>{ itemsOffset.Union(), roomFlagsOffset.Union(), varsOffset.Union() }));
+
+	auto buffer = std::vector<byte>(fbb.GetBufferPointer(), fbb.GetBufferPointer() + fbb.GetSize());
+
+	auto stream = std::ostringstream();
+	stream << std::fixed << std::setprecision(3);
+	stream << "Synthetic hub snapshot: " << (buffer.size() / 1024.0) << " KB, " << ITEM_COUNT << " items, iterations: " << ITERATION_COUNT << std::endl;
+	stream << std::left << std::setw(24) << "zlib level" << std::right <<
+		std::setw(12) << "size (KB)" << std::setw(10) << "ratio" << std::setw(18) << "compress (ms)" << std::setw(18) << "decompress (ms)" << std::endl;
+
+	for (const auto& [level, name] : LEVELS)
+	{
+		auto compressedData = std::vector<byte>(compressBound((uLong)buffer.size()));
+		auto compressedSize = (uLong)compressedData.size();
+
+		auto startTime = std::chrono::high_resolution_clock::now();
+		for (int i = 0; i < ITERATION_COUNT; i++)
+		{
+			compressedSize = (uLong)compressedData.size();
+			compress2(compressedData.data(), &compressedSize, buffer.data(), (uLong)buffer.size(), level);
+		}
+
+		auto compressEndTime = std::chrono::high_resolution_clock::now();
+
+		auto decompressedData = std::vector<byte>(buffer.size());
+		for (int i = 0; i < ITERATION_COUNT; i++)
+			Decompress(decompressedData.data(), compressedData.data(), compressedSize, (unsigned long)decompressedData.size());
+
+		auto decompressEndTime = std::chrono::high_resolution_clock::now();
+
+		double compressTime = std::chrono::duration<double, std::milli>(compressEndTime - startTime).count() / ITERATION_COUNT;
+		double decompressTime = std::chrono::duration<double, std::milli>(decompressEndTime - compressEndTime).count() / ITERATION_COUNT;
+
+		stream << std::left << std::setw(24) << name << std::right <<
+			std::setw(12) << (compressedSize / 1024.0) <<
+			std::setw(10) << ((double)buffer.size() / std::max<uLong>(compressedSize, 1)) <<
+			std::setw(18) << compressTime <<
+			std::setw(18) << decompressTime;
+
+		if (decompressedData != buffer)
+			stream << " (MISMATCH)";
+
+		stream << std::endl;
+	}
+
+	return stream.str();
+}
+
+void SaveGame::LogHubSize()
+{
+	if (Hub.empty())
+		return;
+
+	size_t size = 0;
+	size_t uncompressedSize = 0;
+	for (const auto& [levelIndex, snapshot] : Hub)
+	{
+		size += snapshot.Data->size();
+		uncompressedSize += snapshot.UncompressedSize;
+	}
+
+	TENLog("Hub levels: " + std::to_string(Hub.size()) + ", size: " + std::to_string(size / 1024) + " KB in memory and savegame, " +
+		std::to_string(uncompressedSize / 1024) + " KB uncompressed.", LogLevel::Info);
+}
+
 void SaveGame::SaveHub(int index)
 {
 	// Don't save title level to a hub.
@@ -1480,7 +1678,8 @@ void SaveGame::SaveHub(int index)
 
 	// Build hub data.
 	TENLog("Saving hub data for level #" + std::to_string(index) + (IsOnHub(index) ? " (overwrite)" : " (new)"), LogLevel::Info);
-	Hub[index] = Build();
+	Hub[index] = CompressHubSnapshot(Build());
+	LogHubSize();
 }
 
 void SaveGame::LoadHub(int index)
@@ -1489,9 +1688,24 @@ void SaveGame::LoadHub(int index)
 	if (index == 0 || !IsOnHub(index))
 		return;
 
-	// Load hub data.
+	// Load hub data. Only snapshot of reentered level is decompressed.
 	TENLog("Loading hub data for level #" + std::to_string(index), LogLevel::Info);
-	Parse(Hub[index], true);
+
+	const auto& snapshot = Hub[index];
+	if (!snapshot.IsCompressed)
+	{
+		Parse(*snapshot.Data, true);
+		return;
+	}
+
+	auto buffer = std::vector<byte>(snapshot.UncompressedSize);
+	if (!Decompress(buffer.data(), (byte*)snapshot.Data->data(), (unsigned long)snapshot.Data->size(), (unsigned long)buffer.size()))
+	{
+		TENLog("Unable to decompress hub data for level #" + std::to_string(index), LogLevel::Error);
+		return;
+	}
+
+	Parse(buffer, true);
 }
 
 bool SaveGame::IsOnHub(int index)
@@ -1516,8 +1730,10 @@ bool SaveGame::Save(int slot)
 	g_GameScript->OnSave();
 	HandleAllGlobalEvents(EventType::Save, (Activator)LaraItem->Index);
 
-	// Savegame infos need to be reloaded so that last savegame counter properly increases.
-	LoadHeaders();
+	// Savegame infos need to be loaded once so that last savegame counter properly increases.
+	// Afterwards counter is kept in memory, since previous savegame may still be in flight.
+	if (LastSaveGame == NO_VALUE)
+		LoadHeaders();
 
 	auto fileName = GetSavegameFilename(slot);
 	TENLog("Saving to savegame: " + fileName, LogLevel::Info);
@@ -1525,29 +1741,45 @@ bool SaveGame::Save(int slot)
 	if (!std::filesystem::is_directory(FullSaveDirectory))
 		std::filesystem::create_directory(FullSaveDirectory);
 
-	std::ofstream fileOut{};
-	fileOut.open(fileName, std::ios_base::binary | std::ios_base::out);
-
-	// Write current level save data.
+	// Snapshot game state on game thread. File image is assembled and written on writer thread.
+	// NOTE: Build() reads live level, item and script state, so it can't run concurrently with game logic.
 	auto currentLevelState = SaveGame::Build();
-	int size = (int)currentLevelState.size();
-	fileOut.write(reinterpret_cast<const char*>(&size), sizeof(size));
-	fileOut.write(reinterpret_cast<const char*>(currentLevelState.data()), size);
-
-	// Write hub data.
-	int hubCount = (int)Hub.size();
-	fileOut.write(reinterpret_cast<const char*>(&hubCount), sizeof(hubCount));
+	auto hub = Hub; // Only copies references to snapshots.
+	LogHubSize();
 
-	for (auto& level : Hub)
+	SaveGameWriter.Submit(fileName, slot, [currentLevelState = std::move(currentLevelState), hub = std::move(hub)]()
 	{
-		fileOut.write(reinterpret_cast<const char*>(&level.first), sizeof(level.first));
+		auto data = std::vector<char>{};
+		auto write = [&data](const void* src, size_t size)
+		{
+			data.insert(data.end(), (const char*)src, (const char*)src + size);
+		};
 
-		size = (int)level.second.size();
-		fileOut.write(reinterpret_cast<const char*>(&size), sizeof(size));
-		fileOut.write(reinterpret_cast<const char*>(level.second.data()), size);
-	}
+		// Write current level save data.
+		int size = (int)currentLevelState.size();
+		write(&size, sizeof(size));
+		write(currentLevelState.data(), size);
+
+		// Write hub data. Compressed snapshots are shared with hub, so unchanged levels are not re-encoded.
+		int hubTag = SAVEGAME_COMPRESSED_HUB_TAG;
+		write(&hubTag, sizeof(hubTag));
+
+		int hubCount = (int)hub.size();
+		write(&hubCount, sizeof(hubCount));
+
+		for (const auto& [levelIndex, snapshot] : hub)
+		{
+			write(&levelIndex, sizeof(levelIndex));
+			write(&snapshot.UncompressedSize, sizeof(snapshot.UncompressedSize));
+			write(&snapshot.IsCompressed, sizeof(snapshot.IsCompressed));
 
-	fileOut.close();
+			size = (int)snapshot.Data->size();
+			write(&size, sizeof(size));
+			write(snapshot.Data->data(), size);
+		}
+
+		return data;
+	});
 
 	return true;
 }
@@ -1560,6 +1792,9 @@ bool SaveGame::Load(int slot)
 	if (!DoesSaveGameExist(slot))
 		return false;
 
+	// Pending write to same slot must land first.
+	SaveGameWriter.Flush();
+
 	auto fileName = GetSavegameFilename(slot);
 	TENLog("Loading from savegame: " + fileName, LogLevel::Info);
 
@@ -1580,6 +1815,11 @@ bool SaveGame::Load(int slot)
 	int hubCount;
 	file.read(reinterpret_cast<char*>(&hubCount), sizeof(hubCount));
 
+	// Hub snapshots stay compressed until level is reentered. Older savegames store them uncompressed.
+	bool isHubCompressed = (hubCount == SAVEGAME_COMPRESSED_HUB_TAG);
+	if (isHubCompressed)
+		file.read(reinterpret_cast<char*>(&hubCount), sizeof(hubCount));
+
 	TENLog("Hub count: " + std::to_string(hubCount), LogLevel::Info);
 
 	for (int i = 0; i < hubCount; i++)
@@ -1587,11 +1827,27 @@ bool SaveGame::Load(int slot)
 		int index;
 		file.read(reinterpret_cast<char*>(&index), sizeof(index));
 
-		file.read(reinterpret_cast<char*>(&size), sizeof(size));
-		std::vector<byte> hubBuffer(size);
-		file.read(reinterpret_cast<char*>(hubBuffer.data()), size);
+		if (isHubCompressed)
+		{
+			auto snapshot = HubSnapshot{};
+			file.read(reinterpret_cast<char*>(&snapshot.UncompressedSize), sizeof(snapshot.UncompressedSize));
+			file.read(reinterpret_cast<char*>(&snapshot.IsCompressed), sizeof(snapshot.IsCompressed));
+
+			file.read(reinterpret_cast<char*>(&size), sizeof(size));
+			auto data = std::vector<byte>(size);
+			file.read(reinterpret_cast<char*>(data.data()), size);
 
-		Hub[index] = hubBuffer;
+			snapshot.Data = std::make_shared<const std::vector<byte>>(std::move(data));
+			Hub[index] = std::move(snapshot);
+		}
+		else
+		{
+			file.read(reinterpret_cast<char*>(&size), sizeof(size));
+			std::vector<byte> hubBuffer(size);
+			file.read(reinterpret_cast<char*>(hubBuffer.data()), size);
+
+			Hub[index] = CompressHubSnapshot(hubBuffer);
+		}
 	}
 
 	file.close();
@@ -2039,10 +2295,10 @@ static void ParseEffects(const Save::SaveGame* s)
 	}
 
 	// Load particles.
-	for (int i = 0; i < s->particles()->size(); i++)
+	for (int i = 0; i < s->particles()->size() && i < g_ParticlePool.GetCapacity(); i++)
 	{
 		auto* particleInfo = s->particles()->Get(i);
-		auto* particle = &Particles[i];
+		auto* particle = &g_ParticlePool.GetParticle(i);
 
 		particle->x = particleInfo->x();
 		particle->y = particleInfo->y();
@@ -2083,6 +2339,8 @@ static void ParseEffects(const Save::SaveGame* s)
 		particle->nodeNumber = particleInfo->node_number();
 	}
 
+	g_ParticlePool.Rebuild();
+
 	for (int i = 0; i < s->bats()->size(); i++)
 	{
 		auto* batInfo = s->bats()->Get(i);
@@ -2290,10 +2548,10 @@ static void ParseLevel(const Save::SaveGame* s, bool hubMode)
 		if (!item->Name.empty())
 			g_GameScriptEntities->AddName(item->Name, (short)i);
 
-		item->Callbacks.OnKilled = savedItem->lua_on_killed_name()->str();
-		item->Callbacks.OnHit = savedItem->lua_on_hit_name()->str();
-		item->Callbacks.OnObjectCollided = savedItem->lua_on_collided_with_object_name()->str();
-		item->Callbacks.OnRoomCollided = savedItem->lua_on_collided_with_room_name()->str();
+		item->Callbacks.OnKilled = ScriptCallback{ savedItem->lua_on_killed_name()->str() };
+		item->Callbacks.OnHit = ScriptCallback{ savedItem->lua_on_hit_name()->str() };
+		item->Callbacks.OnObjectCollided = ScriptCallback{ savedItem->lua_on_collided_with_object_name()->str() };
+		item->Callbacks.OnRoomCollided = ScriptCallback{ savedItem->lua_on_collided_with_room_name()->str() };
 
 		g_GameScriptEntities->TryAddColliding(i);
 
@@ -2551,6 +2809,9 @@ void SaveGame::Parse(const std::vector<byte>& buffer, bool hubMode)
 	const Save::SaveGame* s = Save::GetSaveGame(buffer.data());
 
 	ParseLevel(s, hubMode);
+	g_BroadPhase.Initialize();
+	g_Raycast.Initialize();
+	g_Pathfinding.InvalidateCache();
 	ParseLua(s);
 	ParseStatistics(s, hubMode);
 
@@ -2633,5 +2894,7 @@ void SaveGame::Delete(int slot)
 	if (!DoesSaveGameExist(slot))
 		return;
 
+	// Otherwise pending write would recreate deleted savegame.
+	SaveGameWriter.Flush();
 	std::filesystem::remove(GetSavegameFilename(slot));
 }
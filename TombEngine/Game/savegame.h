@@ -26,6 +26,14 @@ struct GameStats
 	Stats Level;
 };
 
+// Hub snapshot of a level, kept compressed in memory. Data is immutable and shared with pending savegame writes.
+struct HubSnapshot
+{
+	std::shared_ptr<const std::vector<byte>> Data			  = nullptr;
+	int										 UncompressedSize = 0;
+	bool									 IsCompressed	  = true; // Snapshot is kept uncompressed if compression failed.
+};
+
 struct SaveGameHeader
 {
 	std::string LevelName;
@@ -44,12 +52,14 @@ class SaveGame
 private:
 	static std::string FullSaveDirectory;
 	static int LastSaveGame;
-	static std::map<int, std::vector<byte>> Hub;
+	static std::map<int, HubSnapshot> Hub;
 
 	static std::string SaveGame::GetSavegameFilename(int slot);
 	static bool IsSaveGameSlotValid(int slot);
 
 	static const std::vector<byte> Build();
+	static HubSnapshot CompressHubSnapshot(const std::vector<byte>& buffer);
+	static void LogHubSize();
 	static void Parse(const std::vector<byte>& buffer, bool hubMode);
 
 public:
@@ -57,6 +67,8 @@ public:
 	static SaveGameHeader Infos[SAVEGAME_MAX];
 
 	static void Init(const std::string& dir);
+	static void Deinit();
+	static void Update();
 	static bool Load(int slot);
 	static bool LoadHeader(int slot, SaveGameHeader* header);
 	static void LoadHeaders();
@@ -64,9 +76,12 @@ public:
 	static void Delete(int slot);
 
 	static bool DoesSaveGameExist(int slot, bool silent = false);
+	static bool IsSaveInProgress();
 
 	static void SaveHub(int index);
 	static void LoadHub(int index);
 	static bool IsOnHub(int index);
 	static void ResetHub();
 };
+
+std::string RunHubCompressionBenchmark();
@@ -6,6 +6,7 @@
 #include "Math/Objects/EulerAngles.h"
 #include "Math/Objects/GameBoundingBox.h"
 #include "Math/Objects/GameVector.h"
+#include "Math/Objects/PackedQuaternion.h"
 #include "Math/Objects/Pose.h"
 #include "Math/Objects/Vector2i.h"
 #include "Math/Objects/Vector3i.h"
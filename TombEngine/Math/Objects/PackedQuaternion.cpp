@@ -0,0 +1,82 @@
+#include "framework.h"
+#include "Math/Objects/PackedQuaternion.h"
+
+#include "Math/Constants.h"
+
+namespace TEN::Math
+{
+	// Non-largest components of unit quaternion lie within [-1 / sqrt(2), 1 / sqrt(2)].
+	constexpr auto COMPONENT_RANGE = 1.0f / SQRT_2;
+
+	PackedQuaternion::PackedQuaternion(const Quaternion& quat)
+	{
+		auto normQuat = quat;
+		normQuat.Normalize();
+
+		float components[4] = { normQuat.x, normQuat.y, normQuat.z, normQuat.w };
+
+		// Find largest component.
+		int largestIndex = 0;
+		for (int i = 1; i < 4; i++)
+		{
+			if (std::abs(components[i]) > std::abs(components[largestIndex]))
+				largestIndex = i;
+		}
+
+		// Flip sign so largest component is positive and can be reconstructed. Negated quaternion represents same rotation.
+		float sign = (components[largestIndex] < 0.0f) ? -1.0f : 1.0f;
+
+		unsigned long long bits = (unsigned long long)largestIndex << (COMPONENT_BIT_COUNT * 3);
+		int shift = COMPONENT_BIT_COUNT * 2;
+		for (int i = 0; i < 4; i++)
+		{
+			if (i == largestIndex)
+				continue;
+
+			float value = std::clamp((components[i] * sign) / COMPONENT_RANGE, -1.0f, 1.0f);
+			auto quantizedValue = (unsigned long long)round((value + 1.0f) * COMPONENT_STEP);
+
+			bits |= quantizedValue << shift;
+			shift -= COMPONENT_BIT_COUNT;
+		}
+
+		_data[0] = (unsigned short)(bits & 0xFFFF);
+		_data[1] = (unsigned short)((bits >> 16) & 0xFFFF);
+		_data[2] = (unsigned short)((bits >> 32) & 0xFFFF);
+	}
+
+	Quaternion PackedQuaternion::ToQuaternion() const
+	{
+		constexpr auto COMPONENT_MASK = (1 << COMPONENT_BIT_COUNT) - 1;
+
+		auto bits = (unsigned long long)_data[0] | ((unsigned long long)_data[1] << 16) | ((unsigned long long)_data[2] << 32);
+		int largestIndex = int(bits >> (COMPONENT_BIT_COUNT * 3)) & 0x3;
+
+		float components[4] = {};
+		float sumSquared = 0.0f;
+		int shift = COMPONENT_BIT_COUNT * 2;
+		for (int i = 0; i < 4; i++)
+		{
+			if (i == largestIndex)
+				continue;
+
+			int quantizedValue = int(bits >> shift) & COMPONENT_MASK;
+			components[i] = ((quantizedValue / (float)COMPONENT_STEP) - 1.0f) * COMPONENT_RANGE;
+			sumSquared += SQUARE(components[i]);
+			shift -= COMPONENT_BIT_COUNT;
+		}
+
+		components[largestIndex] = sqrt(std::max(0.0f, 1.0f - sumSquared));
+		return Quaternion(components[0], components[1], components[2], components[3]);
+	}
+
+	bool PackedQuaternion::operator ==(const PackedQuaternion& packedQuat) const
+	{
+		return (_data == packedQuat._data);
+	}
+
+	bool PackedQuaternion::operator !=(const PackedQuaternion& packedQuat) const
+	{
+		return !(*this == packedQuat);
+	}
+}
@@ -0,0 +1,29 @@
+#pragma once
+
+namespace TEN::Math
+{
+	// Unit quaternion quantized to 48 bits using "smallest three" encoding:
+	// 2 bits store index of largest component, 15 bits store each remaining component.
+	class PackedQuaternion
+	{
+	private:
+		// Constants
+		static constexpr auto COMPONENT_BIT_COUNT = 15;
+		static constexpr auto COMPONENT_STEP	  = 16383; // Half of 15-bit range, so 0 is exactly representable.
+
+		// Members
+		std::array<unsigned short, 3> _data = {};
+
+	public:
+		// Constructors
+		PackedQuaternion() {};
+		PackedQuaternion(const Quaternion& quat);
+
+		// Converters
+		Quaternion ToQuaternion() const;
+
+		// Operators
+		bool operator ==(const PackedQuaternion& packedQuat) const;
+		bool operator !=(const PackedQuaternion& packedQuat) const;
+	};
+}
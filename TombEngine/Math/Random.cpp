@@ -10,6 +10,11 @@ namespace TEN::Math::Random
 {
 	static std::mt19937 Engine;
 
+	void SetSeed(unsigned int seed)
+	{
+		Engine.seed(seed);
+	}
+
 	int GenerateInt(int low, int high)
 	{
 		return (Engine() / (Engine.max() / (high - low + 1) + 1) + low);
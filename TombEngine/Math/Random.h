@@ -4,6 +4,9 @@ class EulerAngles;
 
 namespace TEN::Math::Random
 {
+	// Engine control
+	void SetSeed(unsigned int seed);
+
 	// Value generation
 	int	  GenerateInt(int low = 0, int high = SHRT_MAX);
 	float GenerateFloat(float low = 0.0f, float high = 1.0f);
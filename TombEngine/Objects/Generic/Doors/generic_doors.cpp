@@ -5,6 +5,7 @@
 #include "Game/control/box.h"
 #include "Game/items.h"
 #include "Game/control/lot.h"
+#include "Game/control/Pathfinding.h"
 #include "Game/Gui.h"
 #include "Specific/Input/Input.h"
 #include "Game/pickup/pickup.h"
@@ -21,8 +22,11 @@
 #include "Game/itemdata/door_data.h"
 #include "Game/collision/collide_room.h"
 #include "Game/collision/collide_item.h"
+#include "Game/collision/CollisionCache.h"
 #include "Game/itemdata/itemdata.h"
 
+using namespace TEN::Collision::CollisionCache;
+using namespace TEN::Control::Pathfinding;
 using namespace TEN::Gui;
 using namespace TEN::Input;
 
@@ -396,11 +400,14 @@ namespace TEN::Entities::Doors
 		if (floor != NULL)
 		{
 			*doorPos->floor = doorPos->data;
+			g_CollisionCache.Invalidate();
 
 			short boxIndex = doorPos->block;
 			if (boxIndex != NO_VALUE)
 			{
 				g_Level.Boxes[boxIndex].flags &= ~BLOCKED;
+				g_Pathfinding.InvalidateCache();
+
 				for (auto& currentCreature : ActiveCreatures)
 					currentCreature->LOT.TargetBox = NO_VALUE;
 			}
@@ -430,11 +437,13 @@ namespace TEN::Entities::Doors
 			floor->FloorSurface.Triangles[1].Plane =
 			floor->CeilingSurface.Triangles[0].Plane =
 			floor->CeilingSurface.Triangles[1].Plane = WALL_PLANE;
+			g_CollisionCache.Invalidate();
 
 			short boxIndex = doorPos->block;
 			if (boxIndex != NO_VALUE)
 			{
 				g_Level.Boxes[boxIndex].flags |= BLOCKED;
+				g_Pathfinding.InvalidateCache();
 
 				for (auto& currentCreature : ActiveCreatures)
 					currentCreature->LOT.TargetBox = NO_VALUE;
@@ -1,4 +1,5 @@
 #pragma once
+#include "Math/Objects/Pose.h"
 
 class Vector3i;
 struct ItemInfo;
@@ -14,6 +15,11 @@ namespace TEN::Entities::Generic
 		std::function<std::optional<int>(const ItemInfo& item, const Vector3i& pos)> GetCeilingHeight = nullptr;
 		std::function<int(const ItemInfo& item)> GetFloorBorder	  = nullptr;
 		std::function<int(const ItemInfo& item)> GetCeilingBorder = nullptr;
+
+		// Pose and vertical bounds at last collision cache check.
+		Pose PrevPose		  = Pose::Zero;
+		int	 PrevBoundsTop	  = 0;
+		int	 PrevBoundsBottom = 0;
 	};
 
 	const BridgeObject& GetBridgeObject(const ItemInfo& item);
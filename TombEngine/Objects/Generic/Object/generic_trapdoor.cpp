@@ -9,6 +9,7 @@
 #include "Game/items.h"
 #include "Game/collision/collide_item.h"
 #include "Game/collision/collide_room.h"
+#include "Game/collision/CollisionCache.h"
 #include "Game/collision/floordata.h"
 #include "Game/items.h"
 #include "Game/Lara/lara.h"
@@ -19,6 +20,7 @@
 #include "Specific/Input/Input.h"
 #include "Specific/level.h"
 
+using namespace TEN::Collision::CollisionCache;
 using namespace TEN::Collision::Floordata;
 using namespace TEN::Input;
 using namespace TEN::Math;
@@ -242,11 +244,13 @@ namespace TEN::Entities::Generic
 	{
 		auto* trapDoorItem = &g_Level.Items[itemNumber];
 		trapDoorItem->ItemFlags[2] = 1;
+		g_CollisionCache.Invalidate();
 	}
 
 	void OpenTrapDoor(short itemNumber)
 	{
 		auto* trapDoorItem = &g_Level.Items[itemNumber];
 		trapDoorItem->ItemFlags[2] = 0;
+		g_CollisionCache.Invalidate();
 	}
 }
@@ -4,8 +4,10 @@
 #include "Game/collision/collide_item.h"
 #include "Game/collision/collide_room.h"
 #include "Game/control/box.h"
+#include "Game/control/control.h"
 #include "Game/control/flipeffect.h"
 #include "Game/effects/effects.h"
+#include "Game/effects/SwarmGrid.h"
 #include "Game/effects/tomb4fx.h"
 #include "Game/items.h"
 #include "Game/Lara/lara.h"
@@ -18,6 +20,7 @@
 #include "Specific/clock.h"
 #include "Specific/level.h"
 
+using namespace TEN::Effects::Swarm;
 using namespace TEN::Entities::TR3;
 using namespace TEN::Math;
 using namespace TEN::Renderer;
@@ -43,9 +46,18 @@ namespace TEN::Entities::Creatures::TR3
 	constexpr auto FISH_TARGET_DISTANCE_MAX		 = SQUARE(BLOCK(0.01f));
 	constexpr auto FISH_BASE_SEPARATION_DISTANCE = 210.0f;
 	constexpr auto FISH_UPDATE_INTERVAL_TIME	 = 0.2f;
+	constexpr auto FISH_FLEE_VELOCITY			 = 20.0f;
+	constexpr auto FISH_VELOCITY_DIVISOR_MIN	 = 16.0f; // Divisor used when chasing enemy. Leader is followed with 26.
+	constexpr auto FISH_TARGET_VELOCITY_MAX		 = FISH_COHESION_FACTOR + 5.0f + FISH_CATCH_UP_FACTOR;
+	constexpr auto FISH_TRANSLATION_MAX			 = (FISH_TARGET_VELOCITY_MAX + FISH_SPACING_FACTOR) / FISH_VELOCITY_DIVISOR_MIN;
+	constexpr auto FISH_GRID_CELL_SIZE			 = BLOCK(0.5f);
+	constexpr auto FISH_NEIGHBOR_QUERY_MARGIN	 = FISH_TRANSLATION_MAX + FISH_FLEE_VELOCITY; // Per-frame swim step and flee step of neighbor since grid was built.
 
 	std::vector<FishData> FishSwarm = {};
 
+	static auto FishGrid		 = SwarmGrid(FISH_GRID_CELL_SIZE);
+	static auto FishWaterHeights = std::vector<int>{};
+
 	void InitializeFishSwarm(short itemNumber)
 	{
 		constexpr auto DEFAULT_FISH_COUNT = 24;
@@ -140,19 +152,20 @@ namespace TEN::Entities::Creatures::TR3
 
 		// Check if corpse is near.
 		// TODO: In future also check for other enemies like sharks or crocodile.
-		if (!item.ItemFlags[4] && TestGlobalTimeInterval(FISH_UPDATE_INTERVAL_TIME))
+		// Only active items are scanned, since corpse must be active to be targeted.
+		if (!item.ItemFlags[4] && item.TriggerFlags < 0 && TestGlobalTimeInterval(FISH_UPDATE_INTERVAL_TIME))
 		{
 			float closestDist = INFINITY;
-			for (auto& targetItem : g_Level.Items)
+			for (int targetItemNumber = NextItemActive; targetItemNumber != NO_VALUE; targetItemNumber = g_Level.Items[targetItemNumber].NextActive)
 			{
-				if (!Objects.CheckID(targetItem.ObjectNumber) || targetItem.Index == itemNumber || targetItem.RoomNumber == NO_VALUE)
+				auto& targetItem = g_Level.Items[targetItemNumber];
+				if (targetItem.ObjectNumber != ID_CORPSE || targetItem.Index == itemNumber || targetItem.RoomNumber == NO_VALUE)
 					continue;
 
-				if (SameZone(&creature, &targetItem) && item.TriggerFlags < 0)
+				if (SameZone(&creature, &targetItem))
 				{
 					float dist = Vector3i::Distance(item.Pose.Position, targetItem.Pose.Position);
 					if (dist < closestDist &&
-						targetItem.ObjectNumber == ID_CORPSE &&
 						targetItem.Active && TriggerActive(&targetItem) &&
 						targetItem.ItemFlags[1] == (int)CorpseFlag::Grounded &&
 						TestEnvironment(ENV_FLAG_WATER, targetItem.RoomNumber))
@@ -237,10 +250,19 @@ namespace TEN::Entities::Creatures::TR3
 		return pos;
 	}
 
+	// Fish of a school mostly share one or two rooms, so water height is probed once per room within update.
+	static int GetFishWaterHeight(const Vector3& pos, int roomNumber)
+	{
+		int& waterHeight = FishWaterHeights[roomNumber];
+		if (waterHeight == NO_HEIGHT)
+			waterHeight = GetWaterHeight(pos.x, pos.y, pos.z, roomNumber);
+
+		return waterHeight;
+	}
+
 	void UpdateFishSwarm()
 	{
 		constexpr auto WATER_SURFACE_OFFSET = CLICK(0.5f);
-		constexpr auto FLEE_VEL				= 20.0f;
 
 		static const auto SPHERE = BoundingSphere(Vector3::Zero, BLOCK(1 / 8.0f));
 
@@ -248,15 +270,26 @@ namespace TEN::Entities::Creatures::TR3
 			return;
 
 		const auto& playerItem = *LaraItem;
-		const auto& player = GetLaraInfo(playerItem);
 
 		const FishData* closestFishPtr = nullptr;
 		float minDistToTarget = INFINITY;
-		int minDist = INT_MAX;
+
+		// Bucket fish by start-of-update position, so separation only visits nearby fish.
+		FishGrid.Clear();
+		for (int i = 0; i < FishSwarm.size(); i++)
+		{
+			if (FishSwarm[i].Life > 0.0f)
+				FishGrid.AddAgent(i, FishSwarm[i].Position);
+		}
+
+		FishGrid.Build();
+
+		FishWaterHeights.assign(g_Level.Rooms.size(), NO_HEIGHT);
 
 		int fishID = 0;
-		for (auto& fish : FishSwarm)
+		for (int i = 0; i < FishSwarm.size(); i++)
 		{
+			auto& fish = FishSwarm[i];
 			if (fish.Life <= 0.0f)
 				continue;
 
@@ -276,7 +309,7 @@ namespace TEN::Entities::Creatures::TR3
 				}
 			}
 
-			int enemyVel = (fish.TargetItemPtr != fish.LeaderItemPtr) ? 16.0f : 26.0f;
+			int enemyVel = (fish.TargetItemPtr != fish.LeaderItemPtr) ? FISH_VELOCITY_DIVISOR_MIN : 26.0f;
 
 			fish.PositionTarget = Random::GeneratePointInSphere(SPHERE);
 
@@ -307,10 +340,19 @@ namespace TEN::Entities::Creatures::TR3
 			auto orientTo = Geometry::GetOrientToPoint(fish.Position, desiredPos.ToVector3());
 			fish.Orientation.Lerp(orientTo, 0.1f);
 
-			for (const auto& otherFish : FishSwarm)
+			bool isFollowingLeader = (fish.TargetItemPtr == fish.LeaderItemPtr || fish.TargetItemPtr->ObjectNumber == ID_AI_FOLLOW);
+			if (!isFollowingLeader)
+				separationDist = 80.0f;
+
+			// Fish beyond query radius can't be within separation distance, so only nearby fish are visited.
+			// Separation distance only shrinks within loop, so radius taken here bounds it.
+			float queryRadius = separationDist + FISH_NEIGHBOR_QUERY_MARGIN;
+			FishGrid.ForEachNeighbor(fish.Position, queryRadius, [&](int otherFishID)
 			{
-				if (&fish == &otherFish)
-					continue;
+				if (otherFishID == i)
+					return;
+
+				const auto& otherFish = FishSwarm[otherFishID];
 
 				float distToOtherFish = Vector3i::Distance(fish.Position, otherFish.Position);
 				float distToPlayer = Vector3i::Distance(fish.Position, playerItem.Pose.Position);
@@ -319,16 +361,12 @@ namespace TEN::Entities::Creatures::TR3
 				leaderItem.ItemFlags[7] = distToPlayer;
 
 				// Update the index of the nearest fish to the target
-				if (distToTarget < minDistToTarget &&
-					(fish.TargetItemPtr == fish.LeaderItemPtr || fish.TargetItemPtr->ObjectNumber == ID_AI_FOLLOW))
+				if (distToTarget < minDistToTarget && isFollowingLeader)
 				{
 					minDistToTarget = distToTarget;
 					closestFishPtr = &otherFish;
 				}
 
-				if (fish.TargetItemPtr != fish.LeaderItemPtr && fish.TargetItemPtr->ObjectNumber != ID_AI_FOLLOW)
-					separationDist = 80.0f;
-
 				if (distToOtherFish < separationDist)
 				{
 					auto separationDir = fish.Position - otherFish.Position;
@@ -338,13 +376,13 @@ namespace TEN::Entities::Creatures::TR3
 				}
 				else
 				{
-				    fish.Velocity += FISH_CATCH_UP_FACTOR;
+					fish.Velocity += FISH_CATCH_UP_FACTOR;
 				}
 
 				// Orient to fish nearest to target. Prevents other fish from swimming forward but oriented elsewhere.
 				if (closestFishPtr != nullptr &&
 					fish.Orientation.x != closestFishPtr->Orientation.x && separationDist > 30.0f &&
-					(fish.TargetItemPtr == fish.LeaderItemPtr || fish.TargetItemPtr->ObjectNumber == ID_AI_FOLLOW))
+					isFollowingLeader)
 				{
 					separationDist--;
 					auto orientTo = Geometry::GetOrientToPoint(fish.Position, closestFishPtr->Position);
@@ -357,14 +395,14 @@ namespace TEN::Entities::Creatures::TR3
 					auto separationDir = fish.Position - playerItem.Pose.Position.ToVector3();
 					separationDir.Normalize();
 
-					fish.Position += separationDir * FLEE_VEL;
+					fish.Position += separationDir * FISH_FLEE_VELOCITY;
 
 					auto orientTo = Geometry::GetOrientToPoint(fish.Position, separationDir);
 					fish.Orientation.Lerp(orientTo, 0.05f);
 
-					fish.Velocity -= std::min(FLEE_VEL, fish.TargetItemPtr->Animation.Velocity.z - 1.0f);
+					fish.Velocity -= std::min(FISH_FLEE_VELOCITY, fish.TargetItemPtr->Animation.Velocity.z - 1.0f);
 				}
-			}
+			});
 
 			auto pointColl = GetCollision(fish.Position, fish.RoomNumber);
 			const auto& room = g_Level.Rooms[fish.RoomNumber];
@@ -378,7 +416,7 @@ namespace TEN::Entities::Creatures::TR3
 			}
 
 			// Clamp position to slightly below water surface.
-			int waterHeight = GetWaterHeight(fish.Position.x, fish.Position.y, fish.Position.z, fish.RoomNumber);
+			int waterHeight = GetFishWaterHeight(fish.Position, fish.RoomNumber);
 			if (fish.Position.y < (waterHeight + WATER_SURFACE_OFFSET))
 				fish.Position.y = waterHeight + WATER_SURFACE_OFFSET;
 			
@@ -3,6 +3,7 @@
 
 #include "Game/animation.h"
 #include "Game/camera.h"
+#include "Game/collision/Raycast.h"
 #include "Game/control/los.h"
 #include "Game/effects/debris.h"
 #include "Game/effects/effects.h"
@@ -13,6 +14,8 @@
 #include "Sound/sound.h"
 #include "Specific/level.h"
 
+using namespace TEN::Collision::Raycast;
+
 namespace TEN::Entities::Creatures::TR5
 {
 	int GunShipCounter = 0;
@@ -69,7 +72,8 @@ namespace TEN::Entities::Creatures::TR5
 			target.x = 3 * pos.x - 2 * origin.x;
 			target.y = 3 * pos.y - 2 * origin.y;
 			target.z = 3 * pos.z - 2 * origin.z;
-			bool los2 = LOS(&origin, &target);
+			auto rayHit = RoomRayHit{};
+			bool los2 = LOS(&origin, &target, &rayHit);
 
 			if (los)
 				GunShipCounter = 1;
@@ -89,7 +93,7 @@ namespace TEN::Entities::Creatures::TR5
 
 			Vector3i hitPos;
 			MESH_INFO* hitMesh = nullptr;
-			int objOnLos = ObjectOnLOS2(&origin, &target, &hitPos, &hitMesh, GAME_OBJECT_ID::ID_LARA);
+			int objOnLos = ObjectOnLOS2(&origin, &target, &hitPos, &hitMesh, GAME_OBJECT_ID::ID_LARA, &rayHit);
 
 			if (objOnLos == NO_LOS_ITEM || objOnLos < 0)
 			{
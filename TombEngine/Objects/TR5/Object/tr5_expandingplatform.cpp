@@ -7,6 +7,7 @@
 #include "Game/collision/floordata.h"
 #include "Game/control/box.h"
 #include "Game/control/control.h"
+#include "Game/control/Pathfinding.h"
 #include "Game/items.h"
 #include "Game/Lara/lara.h"
 #include "Game/Setup.h"
@@ -16,6 +17,7 @@
 #include "Specific/level.h"
 
 using namespace TEN::Collision::Floordata;
+using namespace TEN::Control::Pathfinding;
 using namespace TEN::Math;
 
 namespace TEN::Entities::Generic
@@ -132,6 +134,7 @@ namespace TEN::Entities::Generic
 		short roomNumber = item.RoomNumber;
 		FloorInfo* floor = GetFloor(item.Pose.Position.x, item.Pose.Position.y, item.Pose.Position.z, &roomNumber);
 		g_Level.Boxes[floor->Box].flags &= ~BLOCKED;
+		g_Pathfinding.InvalidateCache();
 
 		// Set mutators to default.
 		UpdateExpandingPlatformMutators(itemNumber);
@@ -7,6 +7,7 @@
 #include "Game/collision/floordata.h"
 #include "Game/control/box.h"
 #include "Game/control/control.h"
+#include "Game/control/Pathfinding.h"
 #include "Game/items.h"
 #include "Game/Setup.h"
 #include "Math/Math.h"
@@ -16,6 +17,7 @@
 #include "Specific/level.h"
 
 using namespace TEN::Collision::Floordata;
+using namespace TEN::Control::Pathfinding;
 using namespace TEN::Math;
 
 namespace TEN::Entities::Generic
@@ -75,7 +77,10 @@ namespace TEN::Entities::Generic
 		auto* floor = GetFloor(item->Pose.Position.x, item->Pose.Position.y, item->Pose.Position.z, &roomNumber);
 
 		if (floor->Box != NO_VALUE)
+		{
 			g_Level.Boxes[floor->Box].flags &= ~BLOCKED;
+			g_Pathfinding.InvalidateCache();
+		}
 
 		// Set mutators to EulerAngles identity by default.
 		for (auto& mutator : item->Model.Mutators)
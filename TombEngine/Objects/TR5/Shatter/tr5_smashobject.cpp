@@ -2,10 +2,13 @@
 #include "Objects/TR5/Shatter/tr5_smashobject.h"
 #include "Specific/level.h"
 #include "Game/control/box.h"
+#include "Game/control/Pathfinding.h"
 #include "Sound/sound.h"
 #include "Game/effects/tomb4fx.h"
 #include "Game/items.h"
 
+using namespace TEN::Control::Pathfinding;
+
 void InitializeSmashObject(short itemNumber)
 {
 	auto* item = &g_Level.Items[itemNumber];
@@ -24,7 +27,10 @@ void InitializeSmashObject(short itemNumber)
 
 	auto* box = &g_Level.Boxes[floor->Box];
 	if (box->flags & 0x8000)
+	{
 		box->flags |= BLOCKED;
+		g_Pathfinding.InvalidateCache();
+	}
 }
 
 void SmashObject(short itemNumber)
@@ -36,7 +42,10 @@ void SmashObject(short itemNumber)
 
 	auto* box = &g_Level.Boxes[room->floor[sector].Box];
 	if (box->flags & 0x8000)
+	{
 		box->flags &= ~BOX_BLOCKED;
+		g_Pathfinding.InvalidateCache();
+	}
 
 	SoundEffect(SFX_TR5_SMASH_GLASS, &item->Pose);
 
@@ -2,6 +2,7 @@
 #include "Objects/TR5/Trap/LaserBeam.h"
 
 #include "Game/collision/collide_room.h"
+#include "Game/collision/Raycast.h"
 #include "Game/collision/floordata.h"
 #include "Game/control/los.h"
 #include "Game/effects/effects.h"
@@ -14,6 +15,7 @@
 #include "Renderer/Renderer.h"
 #include "Specific/level.h"
 
+using namespace TEN::Collision::Raycast;
 using namespace TEN::Effects::Items;
 using namespace TEN::Effects::Spark;
 using namespace TEN::Math;
@@ -196,10 +198,11 @@ namespace TEN::Traps::TR5
 		if (pointColl.RoomNumber != target.RoomNumber)
 			target.RoomNumber = pointColl.RoomNumber;
 
-		bool los2 = LOS(&origin, &target);
+		auto rayHit = RoomRayHit{};
+		bool los2 = LOS(&origin, &target, &rayHit);
 
 		auto hitPos = Vector3i::Zero;
-		if (ObjectOnLOS2(&origin, &target, &hitPos, nullptr, ID_LARA) == LaraItem->Index && !los2)
+		if (ObjectOnLOS2(&origin, &target, &hitPos, nullptr, ID_LARA, &rayHit) == LaraItem->Index && !los2)
 		{
 			if (beam.IsLethal &&
 				playerItem->HitPoints > 0 && playerItem->Effect.Type != EffectType::Smoke)
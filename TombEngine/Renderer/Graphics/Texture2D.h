@@ -105,7 +105,7 @@ namespace TEN::Renderer::Graphics
 			Height = desc.Height;
 		}
 
-		Texture2D(ID3D11Device* device, byte* data, int length)
+		Texture2D(ID3D11Device* device, const byte* data, int length)
 		{
 			ComPtr<ID3D11Resource> resource;
 			ID3D11DeviceContext* context = nullptr;
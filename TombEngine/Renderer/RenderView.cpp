@@ -3,8 +3,10 @@
 
 namespace TEN::Renderer
 {
-	RenderView::RenderView(CAMERA_INFO* cam, float roll, float fov, float nearPlane, float farPlane, int w, int h) : Camera(cam, roll, fov, nearPlane, farPlane, w, h) 
+	RenderView::RenderView(CAMERA_INFO* cam, float roll, float fov, float nearPlane, float farPlane, int w, int h, LinearArena* arena) : Camera(cam, roll, fov, nearPlane, farPlane, w, h) 
 	{
+		BindArena(arena);
+
 		Viewport = {};
 		Viewport.TopLeftX = 0;
 		Viewport.TopLeftY = 0;
@@ -14,8 +16,9 @@ namespace TEN::Renderer
 		Viewport.MaxDepth = 1;
 	}
 
-	RenderView::RenderView(const Vector3& pos, const Vector3& dir, const Vector3& up, int w, int h, int room, float nearPlane, float farPlane, float fov) : Camera(pos, dir, up, room, w, h, fov, nearPlane, farPlane) 
+	RenderView::RenderView(const Vector3& pos, const Vector3& dir, const Vector3& up, int w, int h, int room, float nearPlane, float farPlane, float fov, LinearArena* arena) : Camera(pos, dir, up, room, w, h, fov, nearPlane, farPlane) 
 	{
+		BindArena(arena);
 
 		Viewport = {};
 		Viewport.TopLeftX = 0;
@@ -43,6 +46,30 @@ namespace TEN::Renderer
 		bufferToFill.TanHalfFOV = tanf(DEG_TO_RAD(Camera.FOV / 2.0f));
 	}
 
+	void RenderView::SortStatics()
+	{
+		// Group statics by object number once, instead of keeping map of per-object vectors.
+		std::sort(
+			SortedStaticsToDraw.begin(), SortedStaticsToDraw.end(),
+			[](const RendererStatic* staticPtr0, const RendererStatic* staticPtr1)
+			{
+				if (staticPtr0->ObjectNumber != staticPtr1->ObjectNumber)
+					return (staticPtr0->ObjectNumber < staticPtr1->ObjectNumber);
+
+				return (staticPtr0 < staticPtr1);
+			});
+
+		StaticBucketsToDraw.clear();
+		for (int i = 0; i < SortedStaticsToDraw.size(); i++)
+		{
+			int objectNumber = SortedStaticsToDraw[i]->ObjectNumber;
+			if (StaticBucketsToDraw.empty() || StaticBucketsToDraw.back().ObjectNumber != objectNumber)
+				StaticBucketsToDraw.push_back(RenderViewStaticBucket{ objectNumber, i, 0 });
+
+			StaticBucketsToDraw.back().Count++;
+		}
+	}
+
 	void RenderView::Clear() 
 	{
 		RoomsToDraw.clear();
@@ -50,9 +77,28 @@ namespace TEN::Renderer
 		SpritesToDraw.clear();
 		DisplaySpritesToDraw.clear();
 		SortedStaticsToDraw.clear();
+		StaticBucketsToDraw.clear();
 		FogBulbsToDraw.clear();
 	}
 
+	void RenderView::Release()
+	{
+		// Drop storage while keeping containers bound to same arena.
+		BindArena(RoomsToDraw.get_allocator().Arena);
+	}
+
+	void RenderView::BindArena(LinearArena* arena)
+	{
+		RoomsToDraw = ArenaVector<RendererRoom*>(LinearArenaAllocator<RendererRoom*>(arena));
+		LightsToDraw = ArenaVector<RendererLight*>(LinearArenaAllocator<RendererLight*>(arena));
+		FogBulbsToDraw = ArenaVector<RendererFogBulb>(LinearArenaAllocator<RendererFogBulb>(arena));
+		SpritesToDraw = ArenaVector<RendererSpriteToDraw>(LinearArenaAllocator<RendererSpriteToDraw>(arena));
+		DisplaySpritesToDraw = ArenaVector<RendererDisplaySpriteToDraw>(LinearArenaAllocator<RendererDisplaySpriteToDraw>(arena));
+		SortedStaticsToDraw = ArenaVector<RendererStatic*>(LinearArenaAllocator<RendererStatic*>(arena));
+		StaticBucketsToDraw = ArenaVector<RenderViewStaticBucket>(LinearArenaAllocator<RenderViewStaticBucket>(arena));
+		TransparentObjectsToDraw = ArenaVector<RendererSortableObject>(LinearArenaAllocator<RendererSortableObject>(arena));
+	}
+
 	RenderViewCamera::RenderViewCamera(CAMERA_INFO* cam, float roll, float fov, float n, float f, int w, int h)
 	{
 		RoomNumber = cam->pos.RoomNumber;
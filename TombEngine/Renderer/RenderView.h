@@ -3,6 +3,7 @@
 #include "Renderer/ConstantBuffers/CameraMatrixBuffer.h"
 #include "Renderer/Frustum.h"
 #include "Renderer/RendererEnums.h"
+#include "Specific/memory/LinearArena.h"
 #include "Specific/memory/LinearArrayBuffer.h"
 #include "Renderer/Structures/RendererSprite2D.h"
 #include "Renderer/Structures/RendererSprite.h"
@@ -19,6 +20,7 @@ namespace TEN::Renderer
 {
 	using namespace TEN::Renderer::ConstantBuffers;
 	using namespace TEN::Renderer::Structures;
+	using namespace TEN::Memory;
 
 	struct RenderViewCamera
 	{
@@ -39,23 +41,39 @@ namespace TEN::Renderer
 		RenderViewCamera(const Vector3& pos, const Vector3& dir, const Vector3& up, int room, int width, int height, float fov, float n, float f);
 	};
 
+	// Run of statics sharing object number in sorted statics list.
+	struct RenderViewStaticBucket
+	{
+		int ObjectNumber = 0;
+		int StartIndex	 = 0;
+		int Count		 = 0;
+	};
+
+	// Containers are backed by per-frame arena if one is given, and by heap otherwise.
+	// Arena-backed view must be released or destroyed before its arena is reset.
 	struct RenderView
 	{
 		RenderViewCamera Camera;
 		D3D11_VIEWPORT	 Viewport;
 
-		std::vector<RendererRoom*>					RoomsToDraw			 = {};
-		std::vector<RendererLight*>					LightsToDraw		 = {};
-		std::vector<RendererFogBulb>				FogBulbsToDraw		 = {};
-		std::vector<RendererSpriteToDraw>			SpritesToDraw		 = {};
-		std::vector<RendererDisplaySpriteToDraw>	DisplaySpritesToDraw = {};
-		std::map<int, std::vector<RendererStatic*>> SortedStaticsToDraw	 = {};
-		std::vector<RendererSortableObject>			TransparentObjectsToDraw = {};
+		ArenaVector<RendererRoom*>				 RoomsToDraw			  = {};
+		ArenaVector<RendererLight*>				 LightsToDraw			  = {};
+		ArenaVector<RendererFogBulb>			 FogBulbsToDraw			  = {};
+		ArenaVector<RendererSpriteToDraw>		 SpritesToDraw			  = {};
+		ArenaVector<RendererDisplaySpriteToDraw> DisplaySpritesToDraw	  = {};
+		ArenaVector<RendererStatic*>			 SortedStaticsToDraw	  = {}; // Grouped by object number after SortStatics().
+		ArenaVector<RenderViewStaticBucket>		 StaticBucketsToDraw	  = {};
+		ArenaVector<RendererSortableObject>		 TransparentObjectsToDraw = {};
 
-		RenderView(CAMERA_INFO* cam, float roll, float fov, float nearPlane, float farPlane, int w, int h);
-		RenderView(const Vector3& pos, const Vector3& dir, const Vector3& up, int w, int h, int room, float nearPlane, float farPlane, float fov);
+		RenderView(CAMERA_INFO* cam, float roll, float fov, float nearPlane, float farPlane, int w, int h, LinearArena* arena = nullptr);
+		RenderView(const Vector3& pos, const Vector3& dir, const Vector3& up, int w, int h, int room, float nearPlane, float farPlane, float fov, LinearArena* arena = nullptr);
 		
 		void FillConstantBuffer(CCameraMatrixBuffer& bufferToFill);
+		void SortStatics();
 		void Clear();
+		void Release();
+
+	private:
+		void BindArena(LinearArena* arena);
 	};
 }
@@ -76,19 +76,35 @@ namespace TEN::Renderer
 		int nf = Sync();
 		if (nf < 2)
 		{
-			int i = 2 - nf;
+			// Sleep until next logic frame is due instead of busy waiting for it.
+			WaitForTicks(2 - nf);
+			Sync();
 			nf = 2;
-			do
-			{
-				while (!Sync());
-				i--;
-			}
-			while (i);
 		}
 
 		return nf;
 	}
 
+	void Renderer::SaveOldState()
+	{
+		for (int i = 0; i < g_Level.NumItems; i++)
+		{
+			const auto& item = g_Level.Items[i];
+			auto& rItem = _items[i];
+
+			rItem.PrevPosition = item.Pose.Position.ToVector3();
+			rItem.PrevOrientation = item.Pose.Orientation.ToQuaternion();
+		}
+
+		_prevCameraPosition = Camera.pos.ToVector3();
+		_prevCameraTarget = Camera.target.ToVector3();
+	}
+
+	void Renderer::SetInterpolationFactor(float factor)
+	{
+		_interpolationFactor = std::clamp(factor, 0.0f, 1.0f);
+	}
+
 	void Renderer::UpdateProgress(float value)
 	{
 		RenderLoadingScreen(value);
@@ -210,7 +226,7 @@ namespace TEN::Renderer
 		_context->PSSetSamplers((UINT)registerType, 1, &samplerState);
 	} 
 
-	void Renderer::BindRoomLights(std::vector<RendererLight*>& lights)
+	void Renderer::BindRoomLights(const ArenaVector<RendererLight*>& lights)
 	{
 		for (int i = 0; i < lights.size(); i++)
 			memcpy(&_stRoom.RoomLights[i], lights[i], sizeof(ShaderLight));
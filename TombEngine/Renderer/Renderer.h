@@ -20,6 +20,7 @@
 #include "Renderer/RendererEnums.h"
 #include "Renderer/Structures/RendererLight.h"
 #include "Renderer/RenderView.h"
+#include "Renderer/RendererSorting.h"
 #include "Renderer/ConstantBuffers/StaticBuffer.h"
 #include "Renderer/ConstantBuffers/LightBuffer.h"
 #include "Renderer/ConstantBuffers/HUDBarBuffer.h"
@@ -159,7 +160,16 @@ namespace TEN::Renderer
 		ComPtr<ID3D11PixelShader> _psRoomAmbient;
 
 		// Constant buffers
-		RenderView _gameCamera;
+		LinearArena _frameArena = {}; // Backs render view containers; reset once per frame.
+		RenderView	_gameCamera;
+		float	   _gameCameraRoll	   = 0.0f;
+		float	   _gameCameraFov	   = 0.0f;
+		float	   _gameCameraFarView  = 0.0f;
+		Vector3	   _prevCameraPosition = Vector3::Zero;
+		Vector3	   _prevCameraTarget   = Vector3::Zero;
+
+		// Render interpolation between previous and current logic frame (1 = current frame only).
+		float _interpolationFactor = 1.0f;
 		ConstantBuffer<CCameraMatrixBuffer> _cbCameraMatrices;
 		CItemBuffer _stItem;
 		ConstantBuffer<CItemBuffer> _cbItem;
@@ -233,8 +243,11 @@ namespace TEN::Renderer
 		std::vector<short> _visitedRoomsStack;
 
 		// Lights
-		std::vector<RendererLight> _dynamicLights;
-		RendererLight* _shadowLight;
+		std::vector<RendererLight>	   _dynamicLights;
+		Lighting::LightGrid			   _dynamicLightGrid;	 // Rebuilt for each view.
+		std::vector<BoundingSphere>	   _lightGridSpheres;	 // Light grid build scratch.
+		std::vector<RendererLightNode> _collectedLightNodes; // Light collection scratch.
+		RendererLight*				   _shadowLight;
 
 		// Lines
 		std::vector<RendererLine2D>		_lines2DToDraw	   = {};
@@ -261,6 +274,10 @@ namespace TEN::Renderer
 		RendererItem _items[ITEM_COUNT_MAX];
 		RendererEffect _effects[ITEM_COUNT_MAX];
 
+		// Item poses evaluated in one batch per view.
+		std::vector<Pose::PoseJob> _poseJobs;
+		std::vector<int> _poseJobItemNumbers;
+
 		// Debug variables
 		int _numDrawCalls = 0;
 
@@ -288,6 +305,9 @@ namespace TEN::Renderer
 		int _numCheckPortalCalls = 0;
 		int _numGetVisibleRoomsCalls = 0;
 
+		int	   _numFrameArenaAllocations = 0;
+		size_t _frameArenaUsedSize		 = 0;
+
 		int _currentY;
 
 		RendererDebugPage _debugPage = RendererDebugPage::None;
@@ -373,11 +393,16 @@ namespace TEN::Renderer
 		VertexBuffer<Vertex> _sortedPolygonsVertexBuffer;
 		IndexBuffer _sortedPolygonsIndexBuffer;
 
+		std::vector<Sorting::SortedFaceKey>	  _sortedFaceKeys	 = {};
+		std::vector<int>					  _sortedFaceOrder	 = {};
+		std::vector<uint64_t>				  _sortedFaceScratch = {};
+		std::vector<Sorting::SortedFaceBatch> _sortedFaceBatches = {};
+
 		// Private functions
 		void ApplySMAA(RenderTarget2D* renderTarget, RenderView& view);
 		void ApplyFXAA(RenderTarget2D* renderTarget, RenderView& view);
 		void BindTexture(TextureRegister registerType, TextureBase* texture, SamplerStateRegister samplerType);
-		void BindRoomLights(std::vector<RendererLight*>& lights);
+		void BindRoomLights(const ArenaVector<RendererLight*>& lights);
 		void BindStaticLights(std::vector<RendererLight*>& lights);
 		void BindInstancedStaticLights(std::vector<RendererLight*>& lights, int instanceID);
 		void BindMoveableLights(std::vector<RendererLight*>& lights, int roomNumber, int prevRoomNumber, float fade);
@@ -387,16 +412,22 @@ namespace TEN::Renderer
 		void BuildHierarchy(RendererObject* obj);
 		void BuildHierarchyRecursive(RendererObject* obj, RendererBone* node, RendererBone* parentNode);
 		void UpdateAnimation(RendererItem* item, RendererObject& obj, const AnimFrameInterpData& frameData, int mask, bool useObjectWorldRotation = false);
+		bool PrepareItemPose(int itemNumber, bool force, Pose::PoseJob& job);
+		void ApplyItemMutators(RendererItem& item, const RendererObject& obj);
 		bool CheckPortal(short parentRoomNumber, RendererDoor* door, Vector4 viewPort, Vector4* clipPort, RenderView& renderView);
 		void GetVisibleRooms(short from, short to, Vector4 viewPort, bool water, int count, bool onlyRooms, RenderView& renderView);
 		void CollectRooms(RenderView& renderView, bool onlyRooms);
 		void CollectItems(short roomNumber, RenderView& renderView);
+		Matrix GetWorldMatrix(int itemNumber);
+		Matrix GetInterpolatedWorldMatrix(int itemNumber);
 		void CollectStatics(short roomNumber, RenderView& renderView);
 		void CollectLights(Vector3 position, float radius, int roomNumber, int prevRoomNumber, bool prioritizeShadowLight, bool useCachedRoomLights, std::vector<RendererLightNode>* roomsLights, std::vector<RendererLight*>* outputLights);
 		void CollectLightsForItem(RendererItem* item);
 		void CollectLightsForEffect(short roomNumber, RendererEffect* effect);
 		void CollectLightsForRoom(short roomNumber, RenderView& renderView);
 		void CollectLightsForCamera();
+		void BuildRoomLightGrids();
+		void BuildDynamicLightGrid();
 		void CalculateLightFades(RendererItem* item);
 		void CollectEffects(short roomNumber);
 		void ClearSceneItems();
@@ -498,6 +529,7 @@ namespace TEN::Renderer
 		void ResetAnimations();
 		void ResetScissor();
 		void ResetDebugVariables();
+		void ResetFrameArena();
 		float CalculateFrameRate();
 		void CopyRenderTarget(RenderTarget2D* source, RenderTarget2D* dest, RenderView& view);
 
@@ -580,7 +612,7 @@ namespace TEN::Renderer
 
 		RendererMesh* GetRendererMeshFromTrMesh(RendererObject* obj, MESH* meshPtr, short boneIndex, int isJoints, int isHairs, int* lastVertex, int* lastIndex);
 		void DrawBar(float percent, const RendererHudBar& bar, GAME_OBJECT_ID textureSlot, int frame, bool poison);
-		void Create();
+		void Create(bool useSoftwareDevice = false);
 		void Initialize(int w, int h, bool windowed, HWND handle);
 		void Render();
 		void RenderTitle();
@@ -598,6 +630,8 @@ namespace TEN::Renderer
 		void SwitchDebugPage(bool goBack);
 		void DrawDisplayPickup(const DisplayPickup& pickup);
 		int  Synchronize();
+		void SaveOldState();
+		void SetInterpolationFactor(float factor);
 		void AddString(int x, int y, const std::string& string, D3DCOLOR color, int flags);
 		void AddString(const std::string& string, const Vector2& pos, const Color& color, float scale, int flags);
 		void AddDebugString(const std::string& string, const Vector2& pos, const Color& color, float scale, int flags, RendererDebugPage page);
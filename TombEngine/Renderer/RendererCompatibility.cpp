@@ -15,6 +15,7 @@
 #include "Specific/level.h"
 
 using namespace TEN::Renderer::Graphics;
+using namespace TEN::Renderer::Pose;
 
 namespace TEN::Renderer
 {
@@ -467,6 +468,8 @@ namespace TEN::Renderer
 			}
 		);
 
+		BuildRoomLightGrids();
+
 		TENLog("Preparing object data...", LogLevel::Info);
 			 
 		bool isSkinPresent = false;
@@ -617,6 +620,7 @@ namespace TEN::Renderer
 
 					moveable.Skeleton = moveable.LinearizedBones[0];
 					BuildHierarchy(&moveable);
+					moveable.FlatSkeleton = BuildPoseSkeleton(*moveable.Skeleton);
 
 					// Fix player skin joints and hair units.
 					if (MoveablesIds[i] == ID_LARA_SKIN_JOINTS)
@@ -27,6 +27,7 @@
 #include "Objects/TR5/Emitter/tr5_rats_emitter.h"
 #include "Renderer/RenderView.h"
 #include "Renderer/Renderer.h"
+#include "Renderer/RendererSorting.h"
 #include "Specific/configuration.h"
 #include "Specific/level.h"
 #include "Specific/winmain.h"
@@ -37,6 +38,7 @@ using namespace TEN::Effects::Hair;
 using namespace TEN::Entities::Creatures::TR3;
 using namespace TEN::Entities::Generic;
 using namespace TEN::Hud;
+using namespace TEN::Renderer::Sorting;
 using namespace TEN::Renderer::Structures;
 
 extern GUNSHELL_STRUCT Gunshells[MAX_GUNSHELL];
@@ -2184,6 +2186,7 @@ namespace TEN::Renderer
 
 	void Renderer::DumpGameScene()
 	{
+		ResetFrameArena();
 		RenderScene(&_dumpScreenRenderTarget, false, _gameCamera);
 	}
 
@@ -2322,7 +2325,7 @@ namespace TEN::Renderer
 
 	void Renderer::DrawStatics(RenderView& view, RendererPass rendererPass)
 	{
-		if (_staticTextures.size() == 0 || view.SortedStaticsToDraw.size() == 0)
+		if (_staticTextures.size() == 0 || view.StaticBucketsToDraw.size() == 0)
 		{
 			return;
 		}
@@ -2349,9 +2352,9 @@ namespace TEN::Renderer
 
 			BindRenderTargetAsTexture(TextureRegister::SSAO, &_SSAOBlurredRenderTarget, SamplerStateRegister::PointWrap);
 
-			for (auto it = view.SortedStaticsToDraw.begin(); it != view.SortedStaticsToDraw.end(); it++)
+			for (const auto& staticBucket : view.StaticBucketsToDraw)
 			{
-				std::vector<RendererStatic*> statics = it->second;
+				auto* statics = &view.SortedStaticsToDraw[staticBucket.StartIndex];
 
 				RendererStatic* refStatic = statics[0];
 				RendererObject& refStaticObj = *_staticObjects[refStatic->ObjectNumber];
@@ -2360,7 +2363,7 @@ namespace TEN::Renderer
 
 				RendererMesh* refMesh = refStaticObj.ObjectMeshes[0];
 
-				int staticsCount = (int)statics.size();
+				int staticsCount = staticBucket.Count;
 
 				for (int s = 0; s < staticsCount; s++)
 				{
@@ -2428,9 +2431,9 @@ namespace TEN::Renderer
 			
 			BindRenderTargetAsTexture(TextureRegister::SSAO, &_SSAOBlurredRenderTarget, SamplerStateRegister::PointWrap);
 
-			for (auto it = view.SortedStaticsToDraw.begin(); it != view.SortedStaticsToDraw.end(); it++)
+			for (const auto& staticBucket : view.StaticBucketsToDraw)
 			{
-				std::vector<RendererStatic*> statics = it->second;
+				auto* statics = &view.SortedStaticsToDraw[staticBucket.StartIndex];
 
 				RendererStatic* refStatic = statics[0];
 				RendererObject& refStaticObj = *_staticObjects[refStatic->ObjectNumber];
@@ -2439,7 +2442,7 @@ namespace TEN::Renderer
 
 				RendererMesh* refMesh = refStaticObj.ObjectMeshes[0];
 
-				int staticsCount = (int)statics.size();
+				int staticsCount = staticBucket.Count;
 				int bucketSize = INSTANCED_STATIC_MESH_BUCKET_SIZE;
 				int baseStaticIndex = 0;
 
@@ -2506,9 +2509,9 @@ namespace TEN::Renderer
 		{
 			// Collect sorted blend modes faces ordered by room, if transparent pass
 
-			for (auto it = view.SortedStaticsToDraw.begin(); it != view.SortedStaticsToDraw.end(); it++)
+			for (const auto& staticBucket : view.StaticBucketsToDraw)
 			{
-				std::vector<RendererStatic*> statics = it->second;
+				auto* statics = &view.SortedStaticsToDraw[staticBucket.StartIndex];
 
 				RendererStatic* refStatic = statics[0];
 				RendererObject& refStaticObj = *_staticObjects[refStatic->ObjectNumber];
@@ -2517,7 +2520,7 @@ namespace TEN::Renderer
 
 				RendererMesh* refMesh = refStaticObj.ObjectMeshes[0];
 
-				for (int i = 0; i < statics.size(); i++)
+				for (int i = 0; i < staticBucket.Count; i++)
 				{
 					for (int j = 0; j < refMesh->Buckets.size(); j++)
 					{
@@ -2852,10 +2855,43 @@ namespace TEN::Renderer
 		_context->ClearDepthStencilView(depthTarget, D3D11_CLEAR_DEPTH | D3D11_CLEAR_STENCIL, 1.0f, 0);
 	}
 
+	// Recycles previous frame's render view storage. Must run once at start of every frame which renders scene,
+	// otherwise game camera view reassigned by LookAt() keeps growing arena. Game camera view outlives frame,
+	// so it is released first.
+	void Renderer::ResetFrameArena()
+	{
+		_numFrameArenaAllocations = _frameArena.GetHeapAllocationCount();
+		_frameArenaUsedSize = _frameArena.GetUsedSize();
+		_gameCamera.Release();
+		_frameArena.Reset();
+	}
+
 	void Renderer::Render()
 	{
 		//RenderToCubemap(reflectionCubemap, Vector3(LaraItem->pos.xPos, LaraItem->pos.yPos - 1024, LaraItem->pos.zPos), LaraItem->roomNumber);
-		RenderScene(&_backBuffer, true, _gameCamera);
+
+		ResetFrameArena();
+
+		// Don't interpolate camera cuts.
+		bool doInterpolateCamera = (_interpolationFactor < 1.0f &&
+			Vector3::DistanceSquared(_prevCameraPosition, Camera.pos.ToVector3()) <= SQUARE(INTERPOLATION_MAX_DISTANCE));
+
+		if (doInterpolateCamera)
+		{
+			auto camera = Camera;
+			auto pos = Vector3::Lerp(_prevCameraPosition, Camera.pos.ToVector3(), _interpolationFactor);
+			auto target = Vector3::Lerp(_prevCameraTarget, Camera.target.ToVector3(), _interpolationFactor);
+			camera.pos = GameVector((int)pos.x, (int)pos.y, (int)pos.z, Camera.pos.RoomNumber);
+			camera.target = GameVector((int)target.x, (int)target.y, (int)target.z, Camera.target.RoomNumber);
+
+			auto view = RenderView(&camera, _gameCameraRoll, _gameCameraFov, 32, _gameCameraFarView, g_Configuration.ScreenWidth, g_Configuration.ScreenHeight, &_frameArena);
+			RenderScene(&_backBuffer, true, view);
+		}
+		else
+		{
+			RenderScene(&_backBuffer, true, _gameCamera);
+		}
+
 		_context->ClearState();
 		_swapChain->Present(1, 0);
 	}
@@ -3009,159 +3045,43 @@ namespace TEN::Renderer
 
 	void Renderer::DrawSortedFaces(RenderView& view)
 	{
-		std::sort(
-			view.TransparentObjectsToDraw.begin(),
-			view.TransparentObjectsToDraw.end(),
-			[](RendererSortableObject& a, RendererSortableObject& b)
-			{
-				return (a.Distance > b.Distance);
-			}
-		);
+		auto& objects = view.TransparentObjectsToDraw;
 
-		for (int i = 0; i < view.TransparentObjectsToDraw.size(); i++)
-		{
-			RendererSortableObject* object = &view.TransparentObjectsToDraw[i];
-			RendererObjectType lastObjectType = (i > 0 ? view.TransparentObjectsToDraw[i - 1].ObjectType : RendererObjectType::Unknown);
+		_sortedFaceKeys.clear();
+		for (const auto& object : objects)
+			_sortedFaceKeys.push_back(GetSortedFaceKey(object));
 
-			_sortedPolygonsVertices.clear();
-			_sortedPolygonsIndices.clear();
+		g_SortedFaceRecording.Record(_sortedFaceKeys);
 
-			if (object->ObjectType == RendererObjectType::Room)
-			{
-				while (i < view.TransparentObjectsToDraw.size() &&
-					view.TransparentObjectsToDraw[i].ObjectType == object->ObjectType &&
-					view.TransparentObjectsToDraw[i].Room->RoomNumber == object->Room->RoomNumber &&
-					view.TransparentObjectsToDraw[i].Bucket->Texture == object->Bucket->Texture &&
-					view.TransparentObjectsToDraw[i].Bucket->BlendMode == object->Bucket->BlendMode &&
-					_sortedPolygonsIndices.size() + (view.TransparentObjectsToDraw[i].Polygon->Shape == 0 ? 6 : 3) < MAX_TRANSPARENT_VERTICES)
-				{
-					RendererSortableObject* currentObject = &view.TransparentObjectsToDraw[i];
-					_sortedPolygonsIndices.bulk_push_back(
-						_roomsIndices.data(),
-						currentObject->Polygon->BaseIndex,
-						currentObject->Polygon->Shape == 0 ? 6 : 3);
-					i++;
-				}
-
-				DrawRoomSorted(object, lastObjectType, view);
+		SortFaces(_sortedFaceKeys.data(), (int)_sortedFaceKeys.size(), _sortedFaceOrder, _sortedFaceScratch);
+		GetFaceBatches(_sortedFaceKeys.data(), _sortedFaceOrder, MAX_TRANSPARENT_VERTICES, _sortedFaceBatches);
 
-				if (i == view.TransparentObjectsToDraw.size())
-				{
-					return;
-				}
-
-				i--;
-			}
-			else if (object->ObjectType == RendererObjectType::Moveable)
-			{
-				while (i < view.TransparentObjectsToDraw.size() &&
-					view.TransparentObjectsToDraw[i].ObjectType == object->ObjectType &&
-					view.TransparentObjectsToDraw[i].Item->ItemNumber == object->Item->ItemNumber &&
-					view.TransparentObjectsToDraw[i].Bucket->Texture == object->Bucket->Texture &&
-					view.TransparentObjectsToDraw[i].Bucket->BlendMode == object->Bucket->BlendMode &&
-					_sortedPolygonsIndices.size() + (view.TransparentObjectsToDraw[i].Polygon->Shape == 0 ? 6 : 3) < MAX_TRANSPARENT_VERTICES)
-				{
-					RendererSortableObject* currentObject = &view.TransparentObjectsToDraw[i];
-					_sortedPolygonsIndices.bulk_push_back(
-						_moveablesIndices.data(),
-						currentObject->Polygon->BaseIndex,
-						currentObject->Polygon->Shape == 0 ? 6 : 3);
-					i++;
-				}
-
-				DrawItemSorted(object, lastObjectType, view);
-
-				if (i == view.TransparentObjectsToDraw.size())
-				{
-					return;
-				}
-
-				i--;
-			}
-			else if (object->ObjectType == RendererObjectType::Static)
-			{
-				while (i < view.TransparentObjectsToDraw.size() &&
-					view.TransparentObjectsToDraw[i].ObjectType == object->ObjectType &&
-					view.TransparentObjectsToDraw[i].Static->RoomNumber == object->Static->RoomNumber &&
-					view.TransparentObjectsToDraw[i].Static->IndexInRoom == object->Static->IndexInRoom &&
-					view.TransparentObjectsToDraw[i].Bucket->Texture == object->Bucket->Texture &&
-					view.TransparentObjectsToDraw[i].Bucket->BlendMode == object->Bucket->BlendMode &&
-					_sortedPolygonsIndices.size() + (view.TransparentObjectsToDraw[i].Polygon->Shape == 0 ? 6 : 3) < MAX_TRANSPARENT_VERTICES)
-				{
-					RendererSortableObject* currentObject = &view.TransparentObjectsToDraw[i];
-					_sortedPolygonsIndices.bulk_push_back(
-						_staticsIndices.data(),
-						currentObject->Polygon->BaseIndex,
-						currentObject->Polygon->Shape == 0 ? 6 : 3);
-					i++;
-				}
-
-				DrawStaticSorted(object, lastObjectType, view);
+		for (const auto& batch : _sortedFaceBatches)
+		{
+			auto* object = &objects[_sortedFaceOrder[batch.StartIndex]];
+			auto lastObjectType = (batch.StartIndex > 0) ? objects[_sortedFaceOrder[batch.StartIndex - 1]].ObjectType : RendererObjectType::Unknown;
 
-				if (i == view.TransparentObjectsToDraw.size())
-				{
-					return;
-				}
+			_sortedPolygonsVertices.clear();
+			_sortedPolygonsIndices.clear();
 
-				i--;
-			}
-			else if (object->ObjectType == RendererObjectType::MoveableAsStatic)
+			if (object->ObjectType == RendererObjectType::Sprite)
 			{
-				while (i < view.TransparentObjectsToDraw.size() &&
-					view.TransparentObjectsToDraw[i].ObjectType == object->ObjectType &&
-					view.TransparentObjectsToDraw[i].Room->RoomNumber == object->Room->RoomNumber &&
-					view.TransparentObjectsToDraw[i].Bucket->Texture == object->Bucket->Texture &&
-					view.TransparentObjectsToDraw[i].Bucket->BlendMode == object->Bucket->BlendMode &&
-					_sortedPolygonsIndices.size() + (view.TransparentObjectsToDraw[i].Polygon->Shape == 0 ? 6 : 3) < MAX_TRANSPARENT_VERTICES)
-				{
-					RendererSortableObject* currentObject = &view.TransparentObjectsToDraw[i];
-					_sortedPolygonsIndices.bulk_push_back(
-						_staticsIndices.data(),
-						currentObject->Polygon->BaseIndex,
-						currentObject->Polygon->Shape == 0 ? 6 : 3);
-					i++;
-				}
-
-				DrawMoveableAsStaticSorted(object, lastObjectType, view);
-
-				if (i == view.TransparentObjectsToDraw.size())
-				{
-					return;
-				}
-
-				i--;
-			}
-			else if (object->ObjectType == RendererObjectType::Sprite)
-			{			
-				while (i < view.TransparentObjectsToDraw.size() &&
-					view.TransparentObjectsToDraw[i].ObjectType == object->ObjectType &&
-					view.TransparentObjectsToDraw[i].Sprite->Type == object->Sprite->Type &&
-					view.TransparentObjectsToDraw[i].Sprite->SoftParticle == object->Sprite->SoftParticle &&
-					view.TransparentObjectsToDraw[i].Sprite->Sprite->Texture == object->Sprite->Sprite->Texture &&
-					view.TransparentObjectsToDraw[i].Sprite->BlendMode == object->Sprite->BlendMode &&
-					_sortedPolygonsIndices.size() + 6 < MAX_TRANSPARENT_VERTICES)
+				for (int i = batch.StartIndex; i < (batch.StartIndex + batch.Count); i++)
 				{
-					RendererSortableObject* currentObject = &view.TransparentObjectsToDraw[i];
-					RendererSpriteToDraw* spr = currentObject->Sprite;
+					const auto& currentObject = objects[_sortedFaceOrder[i]];
+					const auto& spr = *currentObject.Sprite;
 
 					Vector3 p0t;
 					Vector3 p1t;
 					Vector3 p2t;
 					Vector3 p3t;
 
-					Vector2 uv0;
-					Vector2 uv1;
-					Vector2 uv2;
-					Vector2 uv3;
-
-					if (spr->Type == SpriteType::ThreeD)
+					if (spr.Type == SpriteType::ThreeD)
 					{
-						p0t = spr->vtx1;
-						p1t = spr->vtx2;
-						p2t = spr->vtx3;
-						p3t = spr->vtx4;
-
-
+						p0t = spr.vtx1;
+						p1t = spr.vtx2;
+						p2t = spr.vtx3;
+						p3t = spr.vtx4;
 					}
 					else
 					{
@@ -3171,30 +3091,25 @@ namespace TEN::Renderer
 						p3t = Vector3(-0.5, -0.5, 0);
 					}
 
-					uv0 = spr->Sprite->UV[0];
-					uv1 = spr->Sprite->UV[1];
-					uv2 = spr->Sprite->UV[2];
-					uv3 = spr->Sprite->UV[3];
-
 					Vertex v0;
-					v0.Position = Vector3::Transform(p0t, currentObject->World);
-					v0.UV = uv0;
-					v0.Color = spr->c1;
+					v0.Position = Vector3::Transform(p0t, currentObject.World);
+					v0.UV = spr.Sprite->UV[0];
+					v0.Color = spr.c1;
 
 					Vertex v1;
-					v1.Position = Vector3::Transform(p1t, currentObject->World);
-					v1.UV = uv1;
-					v1.Color = spr->c2;
+					v1.Position = Vector3::Transform(p1t, currentObject.World);
+					v1.UV = spr.Sprite->UV[1];
+					v1.Color = spr.c2;
 
 					Vertex v2;
-					v2.Position = Vector3::Transform(p2t, currentObject->World);
-					v2.UV = uv2;
-					v2.Color = spr->c3;
+					v2.Position = Vector3::Transform(p2t, currentObject.World);
+					v2.UV = spr.Sprite->UV[2];
+					v2.Color = spr.c3;
 
 					Vertex v3;
-					v3.Position = Vector3::Transform(p3t, currentObject->World);
-					v3.UV = uv3;
-					v3.Color = spr->c4;
+					v3.Position = Vector3::Transform(p3t, currentObject.World);
+					v3.UV = spr.Sprite->UV[3];
+					v3.Color = spr.c4;
 
 					_sortedPolygonsVertices.push_back(v0);
 					_sortedPolygonsVertices.push_back(v1);
@@ -3202,18 +3117,56 @@ namespace TEN::Renderer
 					_sortedPolygonsVertices.push_back(v2);
 					_sortedPolygonsVertices.push_back(v3);
 					_sortedPolygonsVertices.push_back(v1);
-
-					i++;
 				}
 
 				DrawSpriteSorted(object, lastObjectType, view);
+				continue;
+			}
 
-				if (i == view.TransparentObjectsToDraw.size())
-				{
-					return;
-				}
+			int* indices = nullptr;
+			switch (object->ObjectType)
+			{
+			case RendererObjectType::Room:
+				indices = _roomsIndices.data();
+				break;
 
-				i--;
+			case RendererObjectType::Moveable:
+				indices = _moveablesIndices.data();
+				break;
+
+			case RendererObjectType::Static:
+			case RendererObjectType::MoveableAsStatic:
+				indices = _staticsIndices.data();
+				break;
+
+			default:
+				continue;
+			}
+
+			// Batch shares draw state, so its polygons are emitted in one go.
+			for (int i = batch.StartIndex; i < (batch.StartIndex + batch.Count); i++)
+			{
+				const auto& polygon = *objects[_sortedFaceOrder[i]].Polygon;
+				_sortedPolygonsIndices.bulk_push_back(indices, polygon.BaseIndex, (polygon.Shape == 0) ? 6 : 3);
+			}
+
+			switch (object->ObjectType)
+			{
+			case RendererObjectType::Room:
+				DrawRoomSorted(object, lastObjectType, view);
+				break;
+
+			case RendererObjectType::Moveable:
+				DrawItemSorted(object, lastObjectType, view);
+				break;
+
+			case RendererObjectType::Static:
+				DrawStaticSorted(object, lastObjectType, view);
+				break;
+
+			case RendererObjectType::MoveableAsStatic:
+				DrawMoveableAsStaticSorted(object, lastObjectType, view);
+				break;
 			}
 		}
 	}
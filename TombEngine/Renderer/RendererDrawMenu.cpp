@@ -2,7 +2,10 @@
 #include "Renderer/Renderer.h"
 
 #include "Game/animation.h"
+#include "Game/collision/BroadPhase.h"
+#include "Game/collision/CollisionCache.h"
 #include "Game/control/control.h"
+#include "Game/control/Pathfinding.h"
 #include "Game/control/volume.h"
 #include "Game/Gui.h"
 #include "Game/Hud/Hud.h"
@@ -10,12 +13,16 @@
 #include "Game/savegame.h"
 #include "Game/Setup.h"
 #include "Math/Math.h"
+#include "Scripting/Internal/GarbageCollector.h"
 #include "Scripting/Internal/TEN/Flow//Level/FlowLevel.h"
 #include "Specific/configuration.h"
 #include "Specific/level.h"
 #include "Specific/trutils.h"
 #include "Specific/winmain.h"
 
+using namespace TEN::Collision::BroadPhase;
+using namespace TEN::Collision::CollisionCache;
+using namespace TEN::Control::Pathfinding;
 using namespace TEN::Gui;
 using namespace TEN::Hud;
 using namespace TEN::Input;
@@ -1107,6 +1114,7 @@ namespace TEN::Renderer
 
 	void Renderer::RenderTitle()
 	{
+		ResetFrameArena();
 		RenderScene(&_dumpScreenRenderTarget, false, _gameCamera);
 
 		_context->ClearDepthStencilView(_backBuffer.DepthStencilView.Get(), D3D11_CLEAR_STENCIL | D3D11_CLEAR_DEPTH, 1.0f, 0);
@@ -1144,7 +1152,12 @@ namespace TEN::Renderer
 				PrintDebugMessage("Update time: %d", _timeUpdate);
 				PrintDebugMessage("Frame time: %d", _timeFrame);
 				PrintDebugMessage("ControlPhase() time: %d", ControlPhaseTime);
+				PrintDebugMessage("Lua heap: %d KB", TEN::Scripting::g_GarbageCollector.GetStats().HeapSize);
+				PrintDebugMessage("Lua GC time: %.3f ms (%d steps%s)", TEN::Scripting::g_GarbageCollector.GetStats().Time, TEN::Scripting::g_GarbageCollector.GetStats().StepCount,
+					TEN::Scripting::g_GarbageCollector.GetStats().IsAutomatic ? ", automatic" : "");
+				PrintDebugMessage("Log messages dropped: %d, collapsed: %d", GetTENLogStats().DroppedCount, GetTENLogStats().CollapsedCount);
 				PrintDebugMessage("Room collector time: %d", _timeRoomsCollector);
+				PrintDebugMessage("Frame arena: %d KB, %d allocations", (int)(_frameArenaUsedSize / 1024), _numFrameArenaAllocations);
 				PrintDebugMessage("TOTAL Draw calls: %d", _numDrawCalls);
 				PrintDebugMessage("    Rooms: %d", _numRoomsDrawCalls);
 				PrintDebugMessage("    Movables: %d", _numMoveablesDrawCalls);
@@ -1286,11 +1299,19 @@ namespace TEN::Renderer
 				PrintDebugMessage("Front ceil: %d", LaraCollision.Front.Ceiling);
 				PrintDebugMessage("Front left ceil: %d", LaraCollision.FrontLeft.Ceiling);
 				PrintDebugMessage("Front right ceil: %d", LaraCollision.FrontRight.Ceiling);
+				PrintDebugMessage("Broad-phase queries: %d", g_BroadPhase.GetStats().QueryCount);
+				PrintDebugMessage("Broad-phase candidates: %d (scan: %d)", g_BroadPhase.GetStats().CandidateCount, g_BroadPhase.GetStats().ScanCount);
+				PrintDebugMessage("Probe cache hits: %d / %d (%.1f%%)", g_CollisionCache.GetStats().HitCount, g_CollisionCache.GetStats().QueryCount,
+					(g_CollisionCache.GetStats().QueryCount > 0) ? ((g_CollisionCache.GetStats().HitCount * 100.0f) / g_CollisionCache.GetStats().QueryCount) : 0.0f);
 				break;
 				
 			case RendererDebugPage::PathfindingStats:
 				PrintDebugMessage("PATHFINDING STATS");
 				PrintDebugMessage("BoxNumber: %d", LaraItem->BoxNumber);
+				PrintDebugMessage("Search mode: %s", (g_Pathfinding.GetMode() == PathfindingMode::AStar) ? "A*" : "Legacy");
+				PrintDebugMessage("Searches: %d", g_Pathfinding.GetStats().SearchCount);
+				PrintDebugMessage("Cache hits: %d", g_Pathfinding.GetStats().CacheHitCount);
+				PrintDebugMessage("Expanded boxes: %d", g_Pathfinding.GetStats().ExpansionCount);
 				break;
 				
 			case RendererDebugPage::WireframeMode:
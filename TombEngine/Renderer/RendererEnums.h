@@ -28,6 +28,7 @@ constexpr auto MAX_DYNAMIC_SHADOWS = 1;
 constexpr auto MAX_DYNAMIC_LIGHTS = 1024;
 constexpr auto ITEM_LIGHT_COLLECTION_RADIUS = BLOCK(1);
 constexpr auto CAMERA_LIGHT_COLLECTION_RADIUS = BLOCK(4);
+constexpr auto INTERPOLATION_MAX_DISTANCE = BLOCK(1); // Larger moves per logic frame are teleports.
 
 constexpr auto MAX_TRANSPARENT_FACES = 16384;
 constexpr auto MAX_TRANSPARENT_VERTICES = (MAX_TRANSPARENT_FACES * 6);
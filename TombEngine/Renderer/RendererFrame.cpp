@@ -26,6 +26,8 @@ namespace TEN::Renderer
 
 		_visitedRoomsStack.clear();
 
+		BuildDynamicLightGrid();
+
 		for (int i = 0; i < g_Level.Rooms.size(); i++)
 		{ 
 			auto& room = _rooms[i];
@@ -58,8 +60,10 @@ namespace TEN::Renderer
 			roomPtr->ClipBounds.Top = (1.0f - roomPtr->ViewPort.w) * _screenHeight * 0.5f;
 		} 
 
+		renderView.SortStatics();
+
 		// Collect fog bulbs.
-		std::vector<RendererFogBulb> tempFogBulbs;
+		auto tempFogBulbs = ArenaVector<RendererFogBulb>(renderView.FogBulbsToDraw.get_allocator());
 		tempFogBulbs.reserve(MAX_FOG_BULBS_DRAW);
 
 		for (auto& room : _rooms)     
@@ -379,11 +383,12 @@ namespace TEN::Renderer
 			newItem->ItemNumber = itemNum;
 			newItem->ObjectNumber = item->ObjectNumber;
 			newItem->Color = item->Model.Color;
-			newItem->Position = item->Pose.Position.ToVector3();
-			newItem->Translation = Matrix::CreateTranslation(item->Pose.Position.x, item->Pose.Position.y, item->Pose.Position.z);
-			newItem->Rotation = item->Pose.Orientation.ToRotationMatrix();
 			newItem->Scale = Matrix::CreateScale(1.0f);
-			newItem->World = newItem->Rotation * newItem->Translation;
+			newItem->LogicWorld = GetWorldMatrix(itemNum);
+			newItem->World = GetInterpolatedWorldMatrix(itemNum);
+			newItem->Position = newItem->World.Translation();
+			newItem->Translation = Matrix::CreateTranslation(newItem->Position);
+			newItem->Rotation = newItem->World * Matrix::CreateTranslation(-newItem->Position);
 
 			CalculateLightFades(newItem);
 			CollectLightsForItem(newItem);
@@ -392,6 +397,30 @@ namespace TEN::Renderer
 		}
 	}
 
+	Matrix Renderer::GetWorldMatrix(int itemNumber)
+	{
+		const auto& item = g_Level.Items[itemNumber];
+		return (item.Pose.Orientation.ToRotationMatrix() * Matrix::CreateTranslation(item.Pose.Position.ToVector3()));
+	}
+
+	Matrix Renderer::GetInterpolatedWorldMatrix(int itemNumber)
+	{
+		const auto& item = g_Level.Items[itemNumber];
+		const auto& rItem = _items[itemNumber];
+
+		auto pos = item.Pose.Position.ToVector3();
+
+		if (_interpolationFactor >= 1.0f ||
+			Vector3::DistanceSquared(rItem.PrevPosition, pos) > SQUARE(INTERPOLATION_MAX_DISTANCE))
+		{
+			return GetWorldMatrix(itemNumber);
+		}
+
+		auto orient = Quaternion::Slerp(rItem.PrevOrientation, item.Pose.Orientation.ToQuaternion(), _interpolationFactor);
+		pos = Vector3::Lerp(rItem.PrevPosition, pos, _interpolationFactor);
+		return (Matrix::CreateFromQuaternion(orient) * Matrix::CreateTranslation(pos));
+	}
+
 	void Renderer::CollectStatics(short roomNumber, RenderView& renderView)
 	{
 		if (_rooms.size() < roomNumber)
@@ -468,16 +497,57 @@ namespace TEN::Renderer
 
 			// At this point, we are sure that we must draw the static mesh
 			room.StaticsToDraw.push_back(mesh);
+			renderView.SortedStaticsToDraw.push_back(mesh);
+		}
+	}
+
+	// Sphere around light containing every position from which light collection can accept it.
+	static BoundingSphere GetLightReachSphere(const RendererLight& light)
+	{
+		constexpr auto DISTANCE_MAX = BLOCK(20);
+
+		float radius = std::min(light.Out + CAMERA_LIGHT_COLLECTION_RADIUS, (float)DISTANCE_MAX);
+		return BoundingSphere(light.Position, radius);
+	}
+
+	void Renderer::BuildRoomLightGrids()
+	{
+		constexpr auto CELL_COUNT_MAX = 1024;
+		constexpr auto CELL_SIZE_MIN  = BLOCK(1);
+
+		for (auto& room : _rooms)
+		{
+			room.NeighborLights.clear();
+			_lightGridSpheres.clear();
 
-			if (renderView.SortedStaticsToDraw.find(mesh->ObjectNumber) == renderView.SortedStaticsToDraw.end())
+			for (int neighborRoomNumber : room.Neighbors)
 			{
-				std::vector<RendererStatic*> vec;
-				renderView.SortedStaticsToDraw.insert(std::pair<int, std::vector<RendererStatic*>>(mesh->ObjectNumber, std::vector<RendererStatic*>()));
+				for (auto& light : _rooms[neighborRoomNumber].Lights)
+				{
+					if (light.Type != LightType::Point && light.Type != LightType::Shadow && light.Type != LightType::Spot)
+						continue;
+
+					room.NeighborLights.push_back(&light);
+					_lightGridSpheres.push_back(GetLightReachSphere(light));
+				}
 			}
-			renderView.SortedStaticsToDraw[mesh->ObjectNumber].push_back(mesh);
+
+			room.NeighborLightGrid.Build(_lightGridSpheres, CELL_COUNT_MAX, CELL_SIZE_MIN);
 		}
 	}
 
+	void Renderer::BuildDynamicLightGrid()
+	{
+		constexpr auto CELL_COUNT_MAX = 4096;
+		constexpr auto CELL_SIZE_MIN  = BLOCK(1);
+
+		_lightGridSpheres.clear();
+		for (const auto& light : _dynamicLights)
+			_lightGridSpheres.push_back(GetLightReachSphere(light));
+
+		_dynamicLightGrid.Build(_lightGridSpheres, CELL_COUNT_MAX, CELL_SIZE_MIN);
+	}
+
 	void Renderer::CollectLights(Vector3 position, float radius, int roomNumber, int prevRoomNumber, bool prioritizeShadowLight, bool useCachedRoomLights, std::vector<RendererLightNode>* roomsLights, std::vector<RendererLight*>* outputLights)
 	{
 		if (_rooms.size() < roomNumber)
@@ -486,17 +556,22 @@ namespace TEN::Renderer
 		}
 
 		// Now collect lights from dynamic list and from rooms
-		std::vector<RendererLightNode> tempLights;
-		tempLights.reserve(MAX_LIGHTS_DRAW);
+		auto& tempLights = _collectedLightNodes;
+		tempLights.clear();
 		
 		RendererRoom& room = _rooms[roomNumber];
 
 		RendererLight* brightestLight = nullptr;
 		float brightest = 0.0f;
 
-		// Dynamic lights have the priority
-		for (auto& light : _dynamicLights)
+		// Dynamic lights have the priority. Only lights binned to position's grid cell can reach it.
+		const int* lightIndices = nullptr;
+		int lightCount = _dynamicLightGrid.GetLights(position, lightIndices);
+
+		for (int i = 0; i < lightCount; i++)
 		{
+			auto& light = _dynamicLights[lightIndices[i]];
+
 			float distanceSquared =
 				SQUARE(position.x - light.Position.x) +
 				SQUARE(position.y - light.Position.y) +
@@ -524,112 +599,98 @@ namespace TEN::Renderer
 	
 		if (!useCachedRoomLights)
 		{
-			// Check current room and also neighbour rooms
+			// Suns are added without distance checks
 			for (int roomToCheck : room.Neighbors)
 			{
-				RendererRoom& currentRoom = _rooms[roomToCheck];
-				int numLights = (int)currentRoom.Lights.size();
+				// Suns from non-adjacent rooms are not added!
+				if (roomToCheck != roomNumber && (prevRoomNumber != roomToCheck || prevRoomNumber == NO_VALUE))
+				{
+					continue;
+				}
 
-				for (int j = 0; j < numLights; j++)
+				for (auto& light : _rooms[roomToCheck].Lights)
 				{
-					RendererLight* light = &currentRoom.Lights[j];
+					if (light.Type != LightType::Sun)
+					{
+						continue;
+					}
 
-					float intensity = 0;
-					float distance = 0;
+					RendererLightNode node = { &light, light.Intensity * Luma(light.Color), 0.0f, 0 };
 
-					// Check only lights different from sun
-					if (light->Type == LightType::Sun)
+					if (roomsLights != nullptr)
 					{
-						// Suns from non-adjacent rooms are not added!
-						if (roomToCheck != roomNumber && (prevRoomNumber != roomToCheck || prevRoomNumber == NO_VALUE))
-						{
-							continue;
-						}
-
-						// Sun is added without distance checks
-						intensity = light->Intensity * Luma(light->Color);						
+						roomsLights->push_back(node);
 					}
-					else if (light->Type == LightType::Point || light->Type == LightType::Shadow)
-					{
-						float distanceSquared =
-							SQUARE(position.x - light->Position.x) +
-							SQUARE(position.y - light->Position.y) +
-							SQUARE(position.z - light->Position.z);
 
-						// Collect only lights nearer than 20 sectors
-						if (distanceSquared >= SQUARE(BLOCK(20)))
-						{
-							continue;
-						}
+					tempLights.push_back(node);
+				}
+			}
 
-						// Check the out radius
-						if (distanceSquared > SQUARE(light->Out + radius))
-						{
-							continue;
-						}
+			// Other lights of current room and neighbour rooms, binned to position's grid cell
+			lightCount = room.NeighborLightGrid.GetLights(position, lightIndices);
 
-						distance = sqrt(distanceSquared);
-						float attenuation = 1.0f - distance / light->Out;
-						intensity = attenuation * light->Intensity * Luma(light->Color);
+			for (int i = 0; i < lightCount; i++)
+			{
+				RendererLight* light = room.NeighborLights[lightIndices[i]];
 
-						// If collecting shadows, try to collect shadow casting light
-						if (light->CastShadows && prioritizeShadowLight && light->Type == LightType::Point)
-						{
-							if (intensity >= brightest)
-							{
-								brightest = intensity;
-								brightestLight = light;
-							}
-						}
-					}
-					else if (light->Type == LightType::Spot)
-					{
-						float distanceSquared =
-							SQUARE(position.x - light->Position.x) +
-							SQUARE(position.y - light->Position.y) +
-							SQUARE(position.z - light->Position.z);
+				float distanceSquared =
+					SQUARE(position.x - light->Position.x) +
+					SQUARE(position.y - light->Position.y) +
+					SQUARE(position.z - light->Position.z);
 
-						// Collect only lights nearer than 20 sectors
-						if (distanceSquared >= SQUARE(BLOCK(20)))
-						{
-							continue;
-						}
+				// Collect only lights nearer than 20 sectors
+				if (distanceSquared >= SQUARE(BLOCK(20)))
+				{
+					continue;
+				}
 
-						// Check the range
-						if (distanceSquared > SQUARE(light->Out + radius))
-						{
-							continue;
-						}
+				// Check the out radius
+				if (distanceSquared > SQUARE(light->Out + radius))
+				{
+					continue;
+				}
+
+				float distance = sqrt(distanceSquared);
+				float attenuation = 1.0f - distance / light->Out;
+				float intensity = 0.0f;
 
-						distance = sqrt(distanceSquared);
-						float attenuation = 1.0f - distance / light->Out;
-						intensity = attenuation * light->Intensity * light->Luma;
+				if (light->Type == LightType::Spot)
+				{
+					intensity = attenuation * light->Intensity * light->Luma;
 
-						// If shadow pointer provided, try to collect shadow casting light
-						if (light->CastShadows && prioritizeShadowLight)
+					// If shadow pointer provided, try to collect shadow casting light
+					if (light->CastShadows && prioritizeShadowLight)
+					{
+						if (intensity >= brightest)
 						{
-							if (intensity >= brightest)
-							{
-								brightest = intensity;
-								brightestLight = light;
-							}
+							brightest = intensity;
+							brightestLight = light;
 						}
 					}
-					else
-					{
-						// Invalid light type
-						continue;
-					}
-
-					RendererLightNode node = { light, intensity, distance, 0 };
+				}
+				else
+				{
+					intensity = attenuation * light->Intensity * Luma(light->Color);
 
-					if (roomsLights != nullptr)
+					// If collecting shadows, try to collect shadow casting light
+					if (light->CastShadows && prioritizeShadowLight && light->Type == LightType::Point)
 					{
-						roomsLights->push_back(node);
+						if (intensity >= brightest)
+						{
+							brightest = intensity;
+							brightestLight = light;
+						}
 					}
+				}
 
-					tempLights.push_back(node);
+				RendererLightNode node = { light, intensity, distance, 0 };
+
+				if (roomsLights != nullptr)
+				{
+					roomsLights->push_back(node);
 				}
+
+				tempLights.push_back(node);
 			}
 		}
 		else
@@ -30,129 +30,111 @@
 #include "Math/Math.h"
 #include "Renderer/RenderView.h"
 #include "Renderer/Renderer.h"
+#include "Renderer/RendererPose.h"
 #include "Specific/configuration.h"
 #include "Specific/level.h"
 #include "Specific/trutils.h"
 
 using namespace TEN::Math;
+using namespace TEN::Renderer::Pose;
 
 extern GameConfiguration g_Configuration;
 extern ScriptInterfaceFlowHandler *g_GameFlow;
 
 namespace TEN::Renderer
 {
-	void Renderer::UpdateAnimation(RendererItem* rItem, RendererObject& rObject, const AnimFrameInterpData& frameData, int mask, bool useObjectWorldRotation)
+	static PoseJob CreatePoseJob(const PoseSkeleton& skeleton, const AnimFrameInterpData& frameData, const Quaternion* extraRotations, Matrix* transforms)
 	{
-		static auto boneIndices = std::vector<int>{};
-		boneIndices.clear();
-		
-		RendererBone* bones[MAX_BONES] = {};
-		int nextBone = 0;
-
-		auto* transforms = ((rItem == nullptr) ? rObject.AnimationTransforms.data() : &rItem->AnimationTransforms[0]);
+		auto job = PoseJob{};
+		job.Skeleton = &skeleton;
+		job.Alpha = frameData.Alpha;
+		job.ExtraRotations = extraRotations;
+		job.Transforms = transforms;
 
-		// Push.
-		bones[nextBone++] = rObject.Skeleton;
-
-		while (nextBone != 0)
+		if (frameData.FramePtr0 != nullptr)
 		{
-			// Pop last bone in stack.
-			auto* bonePtr = bones[--nextBone];
-
-			// Check nullptr, otherwise inventory crashes.
-			if (bonePtr == nullptr)
-				return;
-
-			if (frameData.FramePtr0->BoneOrientations.size() <= bonePtr->Index ||
-				(frameData.Alpha != 0.0f && frameData.FramePtr0->BoneOrientations.size() <= bonePtr->Index))
-			{
-				TENLog(
-					"Attempted to animate object with ID " + GetObjectName((GAME_OBJECT_ID)rItem->ObjectNumber) +
-					" using incorrect animation data. Bad animations set for slot?",
-					LogLevel::Error);
-
-				return;
-			}
-
-			bool calculateMatrix = (mask >> bonePtr->Index) & 1;
-			if (calculateMatrix)
-			{
-				auto offset0 = frameData.FramePtr0->Offset;
-				auto rotMatrix = Matrix::CreateFromQuaternion(frameData.FramePtr0->BoneOrientations[bonePtr->Index]);
-				
-				if (frameData.Alpha != 0.0f)
-				{
-					auto offset1 = frameData.FramePtr1->Offset;
-					offset0 = Vector3::Lerp(offset0, offset1, frameData.Alpha);
-
-					auto rotMatrix2 = Matrix::CreateFromQuaternion(frameData.FramePtr1->BoneOrientations[bonePtr->Index]);
-
-					auto quat1 = Quaternion::CreateFromRotationMatrix(rotMatrix);
-					auto quat2 = Quaternion::CreateFromRotationMatrix(rotMatrix2);
-					auto quat3 = Quaternion::Slerp(quat1, quat2, frameData.Alpha);
-
-					rotMatrix = Matrix::CreateFromQuaternion(quat3);
-				}
+			job.Orientations0 = GetFrameBoneOrientations(*frameData.FramePtr0);
+			job.OrientationCount0 = frameData.FramePtr0->BoneCount;
+			job.Offset0 = frameData.FramePtr0->Offset;
+		}
 
-				auto tMatrix = (bonePtr == rObject.Skeleton) ? Matrix::CreateTranslation(offset0) : Matrix::Identity;
+		if (frameData.FramePtr1 != nullptr)
+		{
+			job.Orientations1 = GetFrameBoneOrientations(*frameData.FramePtr1);
+			job.OrientationCount1 = frameData.FramePtr1->BoneCount;
+			job.Offset1 = frameData.FramePtr1->Offset;
+		}
 
-				auto extraRotMatrix = Matrix::CreateFromQuaternion(bonePtr->ExtraRotation);
+		return job;
+	}
 
-				if (useObjectWorldRotation)
-				{
-					auto scale = Vector3::Zero;
-					auto inverseQuat = Quaternion::Identity;
-					auto translation = Vector3::Zero;
-					transforms[bonePtr->Parent->Index].Invert().Decompose(scale, inverseQuat, translation);
-
-					rotMatrix = rotMatrix * extraRotMatrix * Matrix::CreateFromQuaternion(inverseQuat);
-				}
-				else
-				{
-					rotMatrix = extraRotMatrix * rotMatrix;
-				}
+	void Renderer::UpdateAnimation(RendererItem* rItem, RendererObject& rObject, const AnimFrameInterpData& frameData, int mask, bool useObjectWorldRotation)
+	{
+		// Check empty skeleton, otherwise inventory crashes.
+		if (rObject.FlatSkeleton.IsEmpty())
+			return;
 
-				if (bonePtr != rObject.Skeleton)
-					transforms[bonePtr->Index] = rotMatrix * bonePtr->Transform;
-				else
-					transforms[bonePtr->Index] = rotMatrix * tMatrix;
+		// Player and inventory objects store extra rotations in shared bones.
+		Quaternion extraRotations[MAX_BONES];
+		for (const auto* bone : rObject.LinearizedBones)
+		{
+			if (bone->Index < MAX_BONES)
+				extraRotations[bone->Index] = bone->ExtraRotation;
+		}
 
-				if (bonePtr != rObject.Skeleton)
-					transforms[bonePtr->Index] = transforms[bonePtr->Index] * transforms[bonePtr->Parent->Index];
-			}
+		auto* transforms = ((rItem == nullptr) ? rObject.AnimationTransforms.data() : &rItem->AnimationTransforms[0]);
+		auto job = CreatePoseJob(rObject.FlatSkeleton, frameData, extraRotations, transforms);
+		job.Mask = mask;
+		job.UseObjectWorldRotation = useObjectWorldRotation;
 
-			boneIndices.push_back(bonePtr->Index);
+		if (!TestPoseJob(job))
+		{
+			TENLog(
+				"Attempted to animate object with ID " + GetObjectName((GAME_OBJECT_ID)rObject.Id) +
+				" using incorrect animation data. Bad animations set for slot?",
+				LogLevel::Error);
 
-			// Push.
-			for (auto*& child : bonePtr->Children)
-				bones[nextBone++] = child;
+			return;
 		}
 
+		EvaluatePose(job);
+
 		// Apply mutators on top.
-		if (rItem != nullptr) 
-		{
-			const auto& nativeItem = g_Level.Items[rItem->ItemNumber];
+		if (rItem != nullptr)
+			ApplyItemMutators(*rItem, rObject);
+	}
 
-			if (nativeItem.Model.Mutators.size() == boneIndices.size())
-			{
-				for (const int& i : boneIndices)
-				{
-					const auto& mutator = nativeItem.Model.Mutators[i];
+	void Renderer::ApplyItemMutators(RendererItem& rItem, const RendererObject& rObject)
+	{
+		const auto& nativeItem = g_Level.Items[rItem.ItemNumber];
+		if (nativeItem.Model.Mutators.size() != rObject.FlatSkeleton.BoneIDs.size())
+			return;
 
-					if (mutator.IsEmpty())
-						continue;
+		for (int boneID : rObject.FlatSkeleton.BoneIDs)
+		{
+			const auto& mutator = nativeItem.Model.Mutators[boneID];
+			if (mutator.IsEmpty())
+				continue;
 
-					auto rotMatrix = mutator.Rotation.ToRotationMatrix();
-					auto scaleMatrix = Matrix::CreateScale(mutator.Scale);
-					auto tMatrix = Matrix::CreateTranslation(mutator.Offset);
+			auto rotMatrix = mutator.Rotation.ToRotationMatrix();
+			auto scaleMatrix = Matrix::CreateScale(mutator.Scale);
+			auto tMatrix = Matrix::CreateTranslation(mutator.Offset);
 
-					transforms[i] = rotMatrix * scaleMatrix * tMatrix * transforms[i];
-				}
-			}
+			rItem.AnimationTransforms[boneID] = rotMatrix * scaleMatrix * tMatrix * rItem.AnimationTransforms[boneID];
 		}
 	}
 
 	void Renderer::UpdateItemAnimations(int itemNumber, bool force)
+	{
+		auto job = PoseJob{};
+		if (!PrepareItemPose(itemNumber, force, job))
+			return;
+
+		EvaluatePose(job);
+		ApplyItemMutators(_items[itemNumber], *_moveableObjects[g_Level.Items[itemNumber].ObjectNumber]);
+	}
+
+	bool Renderer::PrepareItemPose(int itemNumber, bool force, PoseJob& job)
 	{
 		auto* itemToDraw = &_items[itemNumber];
 		auto* nativeItem = &g_Level.Items[itemNumber];
@@ -162,11 +144,11 @@ namespace TEN::Renderer
 
 		// Lara has her own routine
 		if (nativeItem->ObjectNumber == ID_LARA)
-			return;
+			return false;
 
 		// Has been already done?
 		if (!force && itemToDraw->DoneAnimations)
-			return;
+			return false;
 
 		itemToDraw->DoneAnimations = true;
 
@@ -176,69 +158,70 @@ namespace TEN::Renderer
 		// Copy meshswaps
 		itemToDraw->MeshIndex = nativeItem->Model.MeshIndex;
 
-		if (obj->animIndex == -1)
-			return;
+		if (obj->animIndex == -1 || moveableObj.FlatSkeleton.IsEmpty())
+			return false;
 
 		// Apply extra rotations
 		int lastJoint = 0;
 		for (int j = 0; j < moveableObj.LinearizedBones.size(); j++)
 		{
 			auto* currentBone = moveableObj.LinearizedBones[j];
+			auto& extraRot = itemToDraw->BoneExtraRotations[j];
 
-			auto prevRotation = currentBone->ExtraRotation;
-			currentBone->ExtraRotation = Quaternion::Identity;
+			auto prevRotation = extraRot;
+			extraRot = Quaternion::Identity;
 				
 			nativeItem->Data.apply(
-				[&j, &currentBone](QuadBikeInfo& quadBike)
+				[&j, &extraRot](QuadBikeInfo& quadBike)
 				{
 					if (j == 3 || j == 4)
 					{
-						currentBone->ExtraRotation = EulerAngles(quadBike.RearRot, 0, 0).ToQuaternion();
+						extraRot = EulerAngles(quadBike.RearRot, 0, 0).ToQuaternion();
 					}
 					else if (j == 6 || j == 7)
 					{
-						currentBone->ExtraRotation = EulerAngles(quadBike.FrontRot, quadBike.TurnRate * 2, 0).ToQuaternion();
+						extraRot = EulerAngles(quadBike.FrontRot, quadBike.TurnRate * 2, 0).ToQuaternion();
 					}
 				},
-				[&j, &currentBone](JeepInfo& jeep)
+				[&j, &extraRot](JeepInfo& jeep)
 				{
 					switch(j)
 					{
 					case 9:
-						currentBone->ExtraRotation = EulerAngles(jeep.FrontRightWheelRotation, jeep.TurnRate * 4, 0).ToQuaternion();
+						extraRot = EulerAngles(jeep.FrontRightWheelRotation, jeep.TurnRate * 4, 0).ToQuaternion();
 						break;
 
 					case 10:
-						currentBone->ExtraRotation = EulerAngles(jeep.FrontLeftWheelRotation, jeep.TurnRate * 4, 0).ToQuaternion();
+						extraRot = EulerAngles(jeep.FrontLeftWheelRotation, jeep.TurnRate * 4, 0).ToQuaternion();
 						break;
 
 					case 12:
-						currentBone->ExtraRotation = EulerAngles(jeep.BackRightWheelRotation, 0, 0).ToQuaternion();
+						extraRot = EulerAngles(jeep.BackRightWheelRotation, 0, 0).ToQuaternion();
 						break;
 
 					case 13:
-						currentBone->ExtraRotation = EulerAngles(jeep.BackLeftWheelRotation, 0, 0).ToQuaternion();
+						extraRot = EulerAngles(jeep.BackLeftWheelRotation, 0, 0).ToQuaternion();
 						break;
 					}
 				},
-				[&j, &currentBone](MotorbikeInfo& bike)
+				[&j, &extraRot](MotorbikeInfo& bike)
 				{
 					switch (j)
 					{
 					case 2:
-						currentBone->ExtraRotation = EulerAngles(bike.RightWheelsRotation, bike.TurnRate * 8, 0).ToQuaternion();
+						extraRot = EulerAngles(bike.RightWheelsRotation, bike.TurnRate * 8, 0).ToQuaternion();
 						break;
 
 					case 4:
-						currentBone->ExtraRotation = EulerAngles(bike.RightWheelsRotation, 0, 0).ToQuaternion();
+						extraRot = EulerAngles(bike.RightWheelsRotation, 0, 0).ToQuaternion();
 						break;
 
 					case 8:
-						currentBone->ExtraRotation = EulerAngles(bike.LeftWheelRotation, 0, 0).ToQuaternion();
+						extraRot = EulerAngles(bike.LeftWheelRotation, 0, 0).ToQuaternion();
 						break;
 					}
 				},
-				[&j, &currentBone, &prevRotation](MinecartInfo& cart)
+				[&j, &extraRot, &prevRotation](MinecartInfo& cart)
 				{
 					switch (j)
 					{
@@ -247,38 +230,38 @@ namespace TEN::Renderer
 					case 3:
 					case 4:
 						short zRot = (short)std::clamp(cart.Velocity, 0, (int)ANGLE(25.0f)) + EulerAngles(prevRotation).z;
-						currentBone->ExtraRotation = EulerAngles(0, 0, zRot).ToQuaternion();
+						extraRot = EulerAngles(0, 0, zRot).ToQuaternion();
 						break;
 					}
 				},
-				[&j, &currentBone](RubberBoatInfo& boat)
+				[&j, &extraRot](RubberBoatInfo& boat)
 				{
 					if (j == 2)
-						currentBone->ExtraRotation = EulerAngles(0, 0, boat.PropellerRotation).ToQuaternion();
+						extraRot = EulerAngles(0, 0, boat.PropellerRotation).ToQuaternion();
 				},
-				[&j, &currentBone](UPVInfo& upv)
+				[&j, &extraRot](UPVInfo& upv)
 				{
 					switch (j)
 					{
 					case 1:
-						currentBone->ExtraRotation = EulerAngles(upv.LeftRudderRotation, 0, 0).ToQuaternion();
+						extraRot = EulerAngles(upv.LeftRudderRotation, 0, 0).ToQuaternion();
 						break;
 
 					case 2:
-						currentBone->ExtraRotation = EulerAngles(upv.RightRudderRotation, 0, 0).ToQuaternion();
+						extraRot = EulerAngles(upv.RightRudderRotation, 0, 0).ToQuaternion();
 						break;
 
 					case 3:
-						currentBone->ExtraRotation = EulerAngles(0, 0, upv.TurbineRotation).ToQuaternion();
+						extraRot = EulerAngles(0, 0, upv.TurbineRotation).ToQuaternion();
 						break;
 					}
 				},
-				[&j, &currentBone](BigGunInfo& bigGun)
+				[&j, &extraRot](BigGunInfo& bigGun)
 				{
 					if (j == 2)
-						currentBone->ExtraRotation = EulerAngles(0, 0, FROM_RAD(bigGun.BarrelRotation)).ToQuaternion();
+						extraRot = EulerAngles(0, 0, FROM_RAD(bigGun.BarrelRotation)).ToQuaternion();
 				},
-					[&j, &currentBone, &lastJoint](CreatureInfo& creature)
+					[&j, &currentBone, &extraRot, &lastJoint](CreatureInfo& creature)
 				{
 					auto xRot = Quaternion::Identity;
 					auto yRot = Quaternion::Identity;
@@ -302,19 +285,32 @@ namespace TEN::Renderer
 						lastJoint++;
 					}
 
-					currentBone->ExtraRotation = xRot * yRot * zRot;
+					extraRot = xRot * yRot * zRot;
 				});
 		}
 
 		auto frameData = GetFrameInterpData(*nativeItem);
-		UpdateAnimation(itemToDraw, moveableObj, frameData, UINT_MAX);
 
-		for (int m = 0; m < obj->nmeshes; m++)
-			itemToDraw->AnimationTransforms[m] = itemToDraw->AnimationTransforms[m];
+		job = CreatePoseJob(moveableObj.FlatSkeleton, frameData, itemToDraw->BoneExtraRotations, itemToDraw->AnimationTransforms);
+
+		if (!TestPoseJob(job))
+		{
+			TENLog(
+				"Attempted to animate object with ID " + GetObjectName(nativeItem->ObjectNumber) +
+				" using incorrect animation data. Bad animations set for slot?",
+				LogLevel::Error);
+
+			return false;
+		}
+
+		return true;
 	}
 
 	void Renderer::UpdateItemAnimations(RenderView& view)
 	{
+		_poseJobs.clear();
+		_poseJobItemNumbers.clear();
+
 		for (const auto* room : view.RoomsToDraw)
 		{
 			for (const auto* itemToDraw : room->ItemsToDraw)
@@ -325,9 +321,20 @@ namespace TEN::Renderer
 				if (nativeItem.ObjectNumber == ID_LARA)
 					continue;
 
-				UpdateItemAnimations(itemToDraw->ItemNumber, false);
+				auto job = PoseJob{};
+				if (!PrepareItemPose(itemToDraw->ItemNumber, false, job))
+					continue;
+
+				_poseJobs.push_back(job);
+				_poseJobItemNumbers.push_back(itemToDraw->ItemNumber);
 			}
 		}
+
+		// Evaluate all visible item poses in one pass, then apply mutators.
+		EvaluatePoses(_poseJobs);
+
+		for (int itemNumber : _poseJobItemNumbers)
+			ApplyItemMutators(_items[itemNumber], *_moveableObjects[g_Level.Items[itemNumber].ObjectNumber]);
 	}
 
 	void Renderer::BuildHierarchyRecursive(RendererObject *obj, RendererBone *node, RendererBone *parentNode)
@@ -362,7 +369,11 @@ namespace TEN::Renderer
 			farView = DEFAULT_FAR_VIEW;
 
 		farView = farView;
-		_gameCamera = RenderView(cam, roll, fov, 32, farView, g_Configuration.ScreenWidth, g_Configuration.ScreenHeight);
+		_gameCamera = RenderView(cam, roll, fov, 32, farView, g_Configuration.ScreenWidth, g_Configuration.ScreenHeight, &_frameArena);
+
+		_gameCameraRoll = roll;
+		_gameCameraFov = fov;
+		_gameCameraFarView = farView;
 	}
 
 	bool Renderer::SphereBoxIntersection(BoundingBox box, Vector3 sphereCentre, float sphereRadius)
@@ -464,22 +475,25 @@ namespace TEN::Renderer
 		return (int)moveable.ObjectMeshes.size();
 	}
 
+	// Gameplay query; uses pose of current logic frame rather than interpolated render pose.
 	void Renderer::GetBoneMatrix(short itemNumber, int jointIndex, Matrix* outMatrix)
 	{
+		auto* rendererItem = &_items[itemNumber];
+		rendererItem->LogicWorld = GetWorldMatrix(itemNumber);
+
 		if (itemNumber == LaraItem->Index)
 		{
 			auto& object = *_moveableObjects[ID_LARA];
-			*outMatrix = object.AnimationTransforms[jointIndex] * _laraWorldMatrix;
+			*outMatrix = object.AnimationTransforms[jointIndex] * rendererItem->LogicWorld;
 		}
 		else
 		{
 			UpdateItemAnimations(itemNumber, true);
 			
-			auto* rendererItem = &_items[itemNumber];
 			auto* nativeItem = &g_Level.Items[itemNumber];
 
 			auto& obj = *_moveableObjects[nativeItem->ObjectNumber];
-			*outMatrix = obj.AnimationTransforms[jointIndex] * rendererItem->World;
+			*outMatrix = obj.AnimationTransforms[jointIndex] * rendererItem->LogicWorld;
 		}
 	}
 
@@ -581,7 +595,10 @@ namespace TEN::Renderer
 		if (jointIndex >= MAX_BONES)
 			jointIndex = 0;
 
-		auto world = rendererItem->AnimationTransforms[jointIndex] * rendererItem->World;
+		// Gameplay query; uses pose of current logic frame rather than interpolated render pose.
+		rendererItem->LogicWorld = GetWorldMatrix(itemNumber);
+
+		auto world = rendererItem->AnimationTransforms[jointIndex] * rendererItem->LogicWorld;
 		return Vector3::Transform(relOffset, world);
 	}
 
@@ -608,22 +608,24 @@ namespace TEN::Renderer
 		_whiteSprite.Texture = &_whiteTexture;
 	}
 
-	void Renderer::Create()
+	void Renderer::Create(bool useSoftwareDevice)
 	{
-		TENLog("Creating DX11 renderer device...", LogLevel::Info);
+		TENLog(useSoftwareDevice ? "Creating DX11 software (WARP) renderer device..." : "Creating DX11 renderer device...", LogLevel::Info);
 
 		D3D_FEATURE_LEVEL levels[] = { D3D_FEATURE_LEVEL_11_0 };
 		D3D_FEATURE_LEVEL featureLevel;
 		HRESULT res; 
 
+		auto driverType = useSoftwareDevice ? D3D_DRIVER_TYPE_WARP : D3D_DRIVER_TYPE_HARDWARE;
+
 		if constexpr (DebugBuild)
 		{
-			res = D3D11CreateDevice(NULL, D3D_DRIVER_TYPE_HARDWARE, NULL, D3D11_CREATE_DEVICE_DEBUG,
+			res = D3D11CreateDevice(NULL, driverType, NULL, D3D11_CREATE_DEVICE_DEBUG,
 				levels, 1, D3D11_SDK_VERSION, &_device, &featureLevel, &_context);
 		}
 		else
 		{
-			res = D3D11CreateDevice(NULL, D3D_DRIVER_TYPE_HARDWARE, NULL, NULL,
+			res = D3D11CreateDevice(NULL, driverType, NULL, NULL,
 				levels, 1, D3D11_SDK_VERSION, &_device, &featureLevel, &_context);
 		}
 
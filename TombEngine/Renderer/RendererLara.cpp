@@ -92,11 +92,9 @@ void Renderer::UpdateLaraAnimations(bool force)
 		bone->ExtraRotation = Quaternion::Identity;
 
 	// Player world matrix.
-	auto tMatrix = Matrix::CreateTranslation(LaraItem->Pose.Position.ToVector3());
-	auto rotMatrix = LaraItem->Pose.Orientation.ToRotationMatrix();
-
-	_laraWorldMatrix = rotMatrix * tMatrix;
+	_laraWorldMatrix = GetInterpolatedWorldMatrix(LaraItem->Index);
 	rItem.World = _laraWorldMatrix;
+	rItem.LogicWorld = GetWorldMatrix(LaraItem->Index);
 
 	// Update extra head and torso rotations.
 	playerObject.LinearizedBones[LM_TORSO]->ExtraRotation = Lara.ExtraTorsoRot.ToQuaternion();
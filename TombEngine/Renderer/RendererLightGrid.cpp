@@ -0,0 +1,238 @@
+#include "framework.h"
+#include "Renderer/RendererLightGrid.h"
+
+#include <chrono>
+#include <iomanip>
+#include <sstream>
+
+#include "Math/Math.h"
+
+using namespace TEN::Math;
+
+namespace TEN::Renderer::Lighting
+{
+	int LightGrid::GetCellCount() const
+	{
+		return (_cellCountX * _cellCountY * _cellCountZ);
+	}
+
+	int LightGrid::GetEntryCount() const
+	{
+		return (int)_lightIndices.size();
+	}
+
+	int LightGrid::GetLights(const Vector3& pos, const int*& lightIndices) const
+	{
+		lightIndices = nullptr;
+		if (_lightIndices.empty())
+			return 0;
+
+		auto localPos = (pos - _origin) / _cellSize;
+		int x = (int)floor(localPos.x);
+		int y = (int)floor(localPos.y);
+		int z = (int)floor(localPos.z);
+
+		// Outside bounds of all spheres; no light can reach.
+		if (x < 0 || x >= _cellCountX ||
+			y < 0 || y >= _cellCountY ||
+			z < 0 || z >= _cellCountZ)
+		{
+			return 0;
+		}
+
+		int cellIndex = (((z * _cellCountY) + y) * _cellCountX) + x;
+		lightIndices = &_lightIndices[_cellStarts[cellIndex]];
+		return (_cellStarts[cellIndex + 1] - _cellStarts[cellIndex]);
+	}
+
+	void LightGrid::Build(const std::vector<BoundingSphere>& spheres, int cellCountMax, float cellSizeMin)
+	{
+		Clear();
+		if (spheres.empty())
+			return;
+
+		auto minPos = Vector3(FLT_MAX);
+		auto maxPos = Vector3(-FLT_MAX);
+		for (const auto& sphere : spheres)
+		{
+			minPos = Vector3::Min(minPos, Vector3(sphere.Center) - Vector3(sphere.Radius));
+			maxPos = Vector3::Max(maxPos, Vector3(sphere.Center) + Vector3(sphere.Radius));
+		}
+
+		// Grow cells until grid fits cell budget.
+		auto extents = maxPos - minPos;
+		_origin = minPos;
+		_cellSize = std::max(cellSizeMin, std::cbrt((extents.x * extents.y * extents.z) / cellCountMax));
+		while (true)
+		{
+			_cellCountX = (int)(extents.x / _cellSize) + 1;
+			_cellCountY = (int)(extents.y / _cellSize) + 1;
+			_cellCountZ = (int)(extents.z / _cellSize) + 1;
+
+			if (((long long)_cellCountX * _cellCountY * _cellCountZ) <= cellCountMax)
+				break;
+
+			_cellSize *= 1.25f;
+		}
+
+		int cellCount = GetCellCount();
+		_cellStarts.assign(cellCount + 1, 0);
+
+		// Count entries of each cell, then fill cells in place.
+		int minCell[3] = {};
+		int maxCell[3] = {};
+		for (const auto& sphere : spheres)
+		{
+			GetCellRange(sphere, minCell, maxCell);
+
+			for (int z = minCell[2]; z <= maxCell[2]; z++)
+			{
+				for (int y = minCell[1]; y <= maxCell[1]; y++)
+				{
+					for (int x = minCell[0]; x <= maxCell[0]; x++)
+						_cellStarts[(((z * _cellCountY) + y) * _cellCountX) + x + 1]++;
+				}
+			}
+		}
+
+		for (int i = 1; i <= cellCount; i++)
+			_cellStarts[i] += _cellStarts[i - 1];
+
+		_lightIndices.resize(_cellStarts[cellCount]);
+		_cellCursors.assign(_cellStarts.begin(), _cellStarts.end() - 1);
+
+		for (int i = 0; i < spheres.size(); i++)
+		{
+			GetCellRange(spheres[i], minCell, maxCell);
+
+			for (int z = minCell[2]; z <= maxCell[2]; z++)
+			{
+				for (int y = minCell[1]; y <= maxCell[1]; y++)
+				{
+					for (int x = minCell[0]; x <= maxCell[0]; x++)
+						_lightIndices[_cellCursors[(((z * _cellCountY) + y) * _cellCountX) + x]++] = i;
+				}
+			}
+		}
+	}
+
+	void LightGrid::Clear()
+	{
+		_cellCountX = 0;
+		_cellCountY = 0;
+		_cellCountZ = 0;
+		_cellStarts.clear();
+		_lightIndices.clear();
+	}
+
+	void LightGrid::GetCellRange(const BoundingSphere& sphere, int (&minCell)[3], int (&maxCell)[3]) const
+	{
+		auto minPos = ((Vector3(sphere.Center) - Vector3(sphere.Radius)) - _origin) / _cellSize;
+		auto maxPos = ((Vector3(sphere.Center) + Vector3(sphere.Radius)) - _origin) / _cellSize;
+
+		minCell[0] = std::clamp((int)floor(minPos.x), 0, _cellCountX - 1);
+		minCell[1] = std::clamp((int)floor(minPos.y), 0, _cellCountY - 1);
+		minCell[2] = std::clamp((int)floor(minPos.z), 0, _cellCountZ - 1);
+		maxCell[0] = std::clamp((int)floor(maxPos.x), 0, _cellCountX - 1);
+		maxCell[1] = std::clamp((int)floor(maxPos.y), 0, _cellCountY - 1);
+		maxCell[2] = std::clamp((int)floor(maxPos.z), 0, _cellCountZ - 1);
+	}
+
+	std::string RunLightBenchmark()
+	{
+		constexpr auto LIGHT_COUNT	   = 1024;
+		constexpr auto OBJECT_COUNT	   = 4096;
+		constexpr auto AREA_SIZE	   = BLOCK(64);
+		constexpr auto AREA_HEIGHT	   = BLOCK(16);
+		constexpr auto QUERY_RADIUS	   = BLOCK(1);
+		constexpr auto CELL_COUNT_MAX  = 4096;
+		constexpr auto ITERATION_COUNT = 20;
+
+		// Synthetic view: dynamic lights scattered over level area, objects queried with item collection radius.
+		auto spheres = std::vector<BoundingSphere>(LIGHT_COUNT);
+		for (auto& sphere : spheres)
+		{
+			sphere.Center = Vector3(
+				Random::GenerateFloat(0.0f, AREA_SIZE),
+				Random::GenerateFloat(-AREA_HEIGHT, 0.0f),
+				Random::GenerateFloat(0.0f, AREA_SIZE));
+			sphere.Radius = Random::GenerateFloat(CLICK(2), BLOCK(4));
+		}
+
+		auto positions = std::vector<Vector3>(OBJECT_COUNT);
+		for (auto& pos : positions)
+		{
+			pos = Vector3(
+				Random::GenerateFloat(0.0f, AREA_SIZE),
+				Random::GenerateFloat(-AREA_HEIGHT, 0.0f),
+				Random::GenerateFloat(0.0f, AREA_SIZE));
+		}
+
+		auto reachSpheres = spheres;
+		for (auto& sphere : reachSpheres)
+			sphere.Radius += QUERY_RADIUS;
+
+		auto isInRange = [&](const Vector3& pos, const BoundingSphere& sphere)
+		{
+			return (Vector3::DistanceSquared(pos, sphere.Center) <= SQUARE(sphere.Radius + QUERY_RADIUS));
+		};
+
+		auto grid = LightGrid{};
+		auto startTime = std::chrono::high_resolution_clock::now();
+		for (int iteration = 0; iteration < ITERATION_COUNT; iteration++)
+			grid.Build(reachSpheres, CELL_COUNT_MAX, BLOCK(1));
+
+		auto buildEndTime = std::chrono::high_resolution_clock::now();
+
+		// Previous per-object scan over all lights.
+		long long scanCount = 0;
+		for (int iteration = 0; iteration < ITERATION_COUNT; iteration++)
+		{
+			for (const auto& pos : positions)
+			{
+				for (const auto& sphere : spheres)
+				{
+					if (isInRange(pos, sphere))
+						scanCount++;
+				}
+			}
+		}
+
+		auto scanEndTime = std::chrono::high_resolution_clock::now();
+
+		long long gridCount = 0;
+		long long candidateCount = 0;
+		for (int iteration = 0; iteration < ITERATION_COUNT; iteration++)
+		{
+			for (const auto& pos : positions)
+			{
+				const int* lightIndices = nullptr;
+				int lightCount = grid.GetLights(pos, lightIndices);
+				candidateCount += lightCount;
+
+				for (int i = 0; i < lightCount; i++)
+				{
+					if (isInRange(pos, spheres[lightIndices[i]]))
+						gridCount++;
+				}
+			}
+		}
+
+		auto gridEndTime = std::chrono::high_resolution_clock::now();
+
+		double buildTime = std::chrono::duration<double, std::milli>(buildEndTime - startTime).count() / ITERATION_COUNT;
+		double scanTime = std::chrono::duration<double, std::milli>(scanEndTime - buildEndTime).count() / ITERATION_COUNT;
+		double gridTime = std::chrono::duration<double, std::milli>(gridEndTime - scanEndTime).count() / ITERATION_COUNT;
+
+		auto stream = std::ostringstream();
+		stream << std::fixed << std::setprecision(3);
+		stream << "Lights: " << LIGHT_COUNT << ", objects: " << OBJECT_COUNT << ", iterations: " << ITERATION_COUNT << std::endl;
+		stream << "Grid build (ms/frame): " << buildTime << " (" << grid.GetCellCount() << " cells, " << grid.GetEntryCount() << " entries)" << std::endl;
+		stream << "Full scan (ms/frame): " << scanTime << " (" << ((scanTime * 1000000.0) / OBJECT_COUNT) << " ns/object)" << std::endl;
+		stream << "Grid lookup (ms/frame): " << gridTime << " (" << ((gridTime * 1000000.0) / OBJECT_COUNT) << " ns/object, " <<
+			((double)candidateCount / (OBJECT_COUNT * ITERATION_COUNT)) << " candidates/object)" << std::endl;
+		stream << "Lights in range: " << (scanCount / ITERATION_COUNT) << " scanned, " << (gridCount / ITERATION_COUNT) << " from grid" << std::endl;
+
+		return stream.str();
+	}
+}
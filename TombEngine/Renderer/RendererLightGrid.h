@@ -0,0 +1,41 @@
+#pragma once
+#include <SimpleMath.h>
+
+// Spatial binning of light influence spheres. Independent of renderer state, so it can run headless.
+namespace TEN::Renderer::Lighting
+{
+	using namespace DirectX;
+	using namespace DirectX::SimpleMath;
+
+	// Uniform grid over bounds of all spheres. Each cell lists spheres whose bounds overlap it, so every sphere
+	// containing point is listed in point's cell. Listed lights are candidates only and still need exact distance test.
+	class LightGrid
+	{
+	private:
+		// Members
+		Vector3			 _origin	   = Vector3::Zero;
+		float			 _cellSize	   = 0.0f;
+		int				 _cellCountX   = 0;
+		int				 _cellCountY   = 0;
+		int				 _cellCountZ   = 0;
+		std::vector<int> _cellStarts   = {}; // Start of each cell in light indices, plus end of last cell.
+		std::vector<int> _lightIndices = {};
+		std::vector<int> _cellCursors  = {}; // Build scratch.
+
+	public:
+		// Getters
+		int GetCellCount() const;
+		int GetEntryCount() const;
+		int GetLights(const Vector3& pos, const int*& lightIndices) const;
+
+		// Utilities
+		void Build(const std::vector<BoundingSphere>& spheres, int cellCountMax, float cellSizeMin);
+		void Clear();
+
+	private:
+		// Helpers
+		void GetCellRange(const BoundingSphere& sphere, int (&minCell)[3], int (&maxCell)[3]) const;
+	};
+
+	std::string RunLightBenchmark();
+}
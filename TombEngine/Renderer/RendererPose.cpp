@@ -0,0 +1,338 @@
+#include "framework.h"
+#include "Renderer/RendererPose.h"
+
+#include <chrono>
+#include <iomanip>
+#include <sstream>
+
+#include "Game/Lara/lara_struct.h"
+#include "Math/Math.h"
+#include "Renderer/Structures/RendererBone.h"
+
+using namespace DirectX;
+using namespace TEN::Math;
+using namespace TEN::Renderer::Structures;
+
+namespace TEN::Renderer::Pose
+{
+	PoseSkeleton BuildPoseSkeleton(const RendererBone& rootBone)
+	{
+		auto skeleton = PoseSkeleton{};
+
+		// Same depth-first order as previous stack-based traversal.
+		auto stack = std::vector<const RendererBone*>{ &rootBone };
+		while (!stack.empty())
+		{
+			const auto* bone = stack.back();
+			stack.pop_back();
+
+			bool isRoot = (bone == &rootBone);
+			skeleton.BoneIDs.push_back(bone->Index);
+			skeleton.ParentBoneIDs.push_back(isRoot ? NO_VALUE : bone->Parent->Index);
+			skeleton.BindTranslations.push_back(isRoot ? Vector3::Zero : bone->Translation);
+			skeleton.MaxBoneID = std::max(skeleton.MaxBoneID, bone->Index);
+
+			for (const auto* child : bone->Children)
+				stack.push_back(child);
+		}
+
+		return skeleton;
+	}
+
+	bool TestPoseJob(const PoseJob& job)
+	{
+		if (job.Skeleton == nullptr || job.Skeleton->IsEmpty() || job.Transforms == nullptr)
+			return false;
+
+		if (job.Skeleton->MaxBoneID >= MAX_BONES)
+			return false;
+
+		if (job.Orientations0 == nullptr || job.OrientationCount0 <= job.Skeleton->MaxBoneID)
+			return false;
+
+		if (job.Alpha != 0.0f && (job.Orientations1 == nullptr || job.OrientationCount1 <= job.Skeleton->MaxBoneID))
+			return false;
+
+		return true;
+	}
+
+	// Extracts rotation from transform with scale removed.
+	static XMVECTOR GetTransformRotation(const Matrix& transform)
+	{
+		auto matrix = XMLoadFloat4x4(&transform);
+		matrix.r[0] = XMVector3Normalize(matrix.r[0]);
+		matrix.r[1] = XMVector3Normalize(matrix.r[1]);
+		matrix.r[2] = XMVector3Normalize(matrix.r[2]);
+		matrix.r[3] = g_XMIdentityR3;
+
+		return XMQuaternionRotationMatrix(matrix);
+	}
+
+	void EvaluatePose(const PoseJob& job)
+	{
+		const auto& skeleton = *job.Skeleton;
+		bool isBlended = (job.Alpha != 0.0f);
+
+		auto offset = isBlended ? Vector3::Lerp(job.Offset0, job.Offset1, job.Alpha) : job.Offset0;
+
+		// Single linear pass. Parent world transform is always ready when child is reached.
+		for (int slot = 0; slot < skeleton.BoneIDs.size(); slot++)
+		{
+			int boneID = skeleton.BoneIDs[slot];
+			if (!((job.Mask >> boneID) & 1))
+				continue;
+
+			int parentBoneID = skeleton.ParentBoneIDs[slot];
+
+			// Decode and blend keyframe orientations directly.
+			auto orient0 = job.Orientations0[boneID].ToQuaternion();
+			auto orient = XMLoadFloat4(&orient0);
+			if (isBlended)
+			{
+				auto orient1 = job.Orientations1[boneID].ToQuaternion();
+				orient = XMQuaternionSlerp(orient, XMLoadFloat4(&orient1), job.Alpha);
+			}
+
+			// NOTE: XMQuaternionMultiply(q0, q1) applies q0 first, matching matrix product order.
+			if (job.UseObjectWorldRotation && parentBoneID != NO_VALUE)
+			{
+				// Cancel parent world rotation so bone keeps object space orientation.
+				auto extraRot = (job.ExtraRotations != nullptr) ? XMLoadFloat4(&job.ExtraRotations[boneID]) : XMQuaternionIdentity();
+				auto parentRotInverse = XMQuaternionConjugate(GetTransformRotation(job.Transforms[parentBoneID]));
+				orient = XMQuaternionMultiply(XMQuaternionMultiply(orient, extraRot), parentRotInverse);
+			}
+			else if (job.ExtraRotations != nullptr)
+			{
+				orient = XMQuaternionMultiply(XMLoadFloat4(&job.ExtraRotations[boneID]), orient);
+			}
+
+			auto transform = XMMatrixRotationQuaternion(orient);
+			if (parentBoneID == NO_VALUE)
+			{
+				transform.r[3] = XMVectorSetW(XMLoadFloat3(&offset), 1.0f);
+			}
+			else
+			{
+				transform.r[3] = XMVectorSetW(XMLoadFloat3(&skeleton.BindTranslations[slot]), 1.0f);
+				transform = XMMatrixMultiply(transform, XMLoadFloat4x4(&job.Transforms[parentBoneID]));
+			}
+
+			XMStoreFloat4x4(&job.Transforms[boneID], transform);
+		}
+	}
+
+	void EvaluatePoses(const std::vector<PoseJob>& jobs)
+	{
+		for (const auto& job : jobs)
+			EvaluatePose(job);
+	}
+
+	// Previous unpacked keyframe layout: one heap-allocated orientation array per frame.
+	struct LegacyPoseFrame
+	{
+		Vector3					Offset			 = Vector3::Zero;
+		std::vector<Quaternion> BoneOrientations = {};
+	};
+
+	// Previous per-item evaluation: stack walk with matrix round trip before slerp.
+	static void EvaluateLegacyPose(const RendererBone& rootBone, const LegacyPoseFrame& frame0, const LegacyPoseFrame& frame1, float alpha, Matrix* transforms)
+	{
+		const RendererBone* bones[MAX_BONES] = {};
+		int nextBone = 0;
+		bones[nextBone++] = &rootBone;
+
+		while (nextBone != 0)
+		{
+			const auto* bonePtr = bones[--nextBone];
+
+			auto offset = Vector3::Lerp(frame0.Offset, frame1.Offset, alpha);
+			auto quat0 = Quaternion::CreateFromRotationMatrix(Matrix::CreateFromQuaternion(frame0.BoneOrientations[bonePtr->Index]));
+			auto quat1 = Quaternion::CreateFromRotationMatrix(Matrix::CreateFromQuaternion(frame1.BoneOrientations[bonePtr->Index]));
+			auto rotMatrix = Matrix::CreateFromQuaternion(bonePtr->ExtraRotation) * Matrix::CreateFromQuaternion(Quaternion::Slerp(quat0, quat1, alpha));
+
+			if (bonePtr != &rootBone)
+				transforms[bonePtr->Index] = (rotMatrix * bonePtr->Transform) * transforms[bonePtr->Parent->Index];
+			else
+				transforms[bonePtr->Index] = rotMatrix * Matrix::CreateTranslation(offset);
+
+			for (const auto* child : bonePtr->Children)
+				bones[nextBone++] = child;
+		}
+	}
+
+	// Measures batched pose evaluation against previous per-item stack walk on player skeleton and checks that
+	// both produce same transforms. Legacy path is evaluated twice: on source keyframes to report quantization
+	// error, and on decoded packed keyframes to check evaluation itself within tolerance.
+	std::string RunPoseBenchmark()
+	{
+		constexpr auto ITEM_COUNT				 = 256;
+		constexpr auto ITERATION_COUNT			 = 100;
+		constexpr auto ROTATION_TOLERANCE		 = 0.0001f;
+		constexpr auto TRANSLATION_TOLERANCE	 = 0.05f;
+		constexpr auto EXTRA_ROTATION_BONE_IDS	 = std::array<int, 2>{ LM_TORSO, LM_HEAD };
+
+		struct BoneSetup
+		{
+			int		ParentBoneID = NO_VALUE;
+			Vector3 Translation	 = Vector3::Zero;
+		};
+
+		// Player bone hierarchy in LM_* order with approximate stock bone offsets.
+		static const auto PLAYER_BONES = std::array<BoneSetup, NUM_LARA_MESHES>
+		{
+			BoneSetup{ NO_VALUE, Vector3::Zero },
+			BoneSetup{ LM_HIPS, Vector3(42.0f, 24.0f, 0.0f) },
+			BoneSetup{ LM_LTHIGH, Vector3(0.0f, 208.0f, 0.0f) },
+			BoneSetup{ LM_LSHIN, Vector3(0.0f, 216.0f, 0.0f) },
+			BoneSetup{ LM_HIPS, Vector3(-42.0f, 24.0f, 0.0f) },
+			BoneSetup{ LM_RTHIGH, Vector3(0.0f, 208.0f, 0.0f) },
+			BoneSetup{ LM_RSHIN, Vector3(0.0f, 216.0f, 0.0f) },
+			BoneSetup{ LM_HIPS, Vector3(0.0f, -48.0f, 0.0f) },
+			BoneSetup{ LM_TORSO, Vector3(-72.0f, -184.0f, 0.0f) },
+			BoneSetup{ LM_RINARM, Vector3(0.0f, 140.0f, 0.0f) },
+			BoneSetup{ LM_ROUTARM, Vector3(0.0f, 124.0f, 0.0f) },
+			BoneSetup{ LM_TORSO, Vector3(72.0f, -184.0f, 0.0f) },
+			BoneSetup{ LM_LINARM, Vector3(0.0f, 140.0f, 0.0f) },
+			BoneSetup{ LM_LOUTARM, Vector3(0.0f, 124.0f, 0.0f) },
+			BoneSetup{ LM_TORSO, Vector3(0.0f, -232.0f, 0.0f) }
+		};
+
+		constexpr auto BONE_COUNT = (int)NUM_LARA_MESHES;
+
+		auto bones = std::vector<std::unique_ptr<RendererBone>>{};
+		for (int i = 0; i < BONE_COUNT; i++)
+			bones.push_back(std::make_unique<RendererBone>(i));
+
+		for (int i = 1; i < BONE_COUNT; i++)
+		{
+			const auto& setup = PLAYER_BONES[i];
+			bones[i]->Parent = bones[setup.ParentBoneID].get();
+			bones[i]->Translation = setup.Translation;
+			bones[i]->Transform = Matrix::CreateTranslation(setup.Translation);
+			bones[setup.ParentBoneID]->Children.push_back(bones[i].get());
+		}
+
+		// Torso and head carry extra rotations, as for player aiming.
+		auto extraRotations = std::array<Quaternion, MAX_BONES>{};
+		extraRotations.fill(Quaternion::Identity);
+		for (int boneID : EXTRA_ROTATION_BONE_IDS)
+		{
+			extraRotations[boneID] = EulerAngles(Random::GenerateAngle(ANGLE(-45.0f), ANGLE(45.0f)), Random::GenerateAngle(ANGLE(-90.0f), ANGLE(90.0f)), 0).ToQuaternion();
+			bones[boneID]->ExtraRotation = extraRotations[boneID];
+		}
+
+		auto skeleton = BuildPoseSkeleton(*bones[0]);
+
+		// Same keyframes in unpacked per-frame and packed contiguous layouts.
+		auto frames = std::vector<LegacyPoseFrame>(ITEM_COUNT * 2);
+		auto packedOrients = std::vector<PackedQuaternion>{};
+		packedOrients.reserve(frames.size() * BONE_COUNT);
+		for (auto& frame : frames)
+		{
+			frame.Offset = Vector3(0.0f, Random::GenerateFloat(-512.0f, 0.0f), 0.0f);
+			for (int i = 0; i < BONE_COUNT; i++)
+			{
+				auto orient = EulerAngles(Random::GenerateAngle(), Random::GenerateAngle(), Random::GenerateAngle());
+				frame.BoneOrientations.push_back(orient.ToQuaternion());
+				packedOrients.push_back(PackedQuaternion(frame.BoneOrientations.back()));
+			}
+		}
+
+		// Decoded packed keyframes, so reference for correctness check has no quantization error.
+		auto decodedFrames = frames;
+		for (int frameIndex = 0; frameIndex < decodedFrames.size(); frameIndex++)
+		{
+			for (int i = 0; i < BONE_COUNT; i++)
+				decodedFrames[frameIndex].BoneOrientations[i] = packedOrients[(frameIndex * BONE_COUNT) + i].ToQuaternion();
+		}
+
+		auto alphas = std::vector<float>(ITEM_COUNT);
+		for (auto& alpha : alphas)
+			alpha = Random::GenerateFloat(0.01f, 0.99f);
+
+		auto legacyTransforms = std::vector<std::array<Matrix, MAX_BONES>>(ITEM_COUNT);
+		auto referenceTransforms = std::vector<std::array<Matrix, MAX_BONES>>(ITEM_COUNT);
+		auto poseTransforms = std::vector<std::array<Matrix, MAX_BONES>>(ITEM_COUNT);
+
+		auto jobs = std::vector<PoseJob>(ITEM_COUNT);
+		for (int i = 0; i < ITEM_COUNT; i++)
+		{
+			auto& job = jobs[i];
+			job.Skeleton = &skeleton;
+			job.Orientations0 = &packedOrients[(i * 2) * BONE_COUNT];
+			job.Orientations1 = &packedOrients[((i * 2) + 1) * BONE_COUNT];
+			job.OrientationCount0 = BONE_COUNT;
+			job.OrientationCount1 = BONE_COUNT;
+			job.Offset0 = frames[i * 2].Offset;
+			job.Offset1 = frames[(i * 2) + 1].Offset;
+			job.Alpha = alphas[i];
+			job.ExtraRotations = extraRotations.data();
+			job.Transforms = poseTransforms[i].data();
+		}
+
+		auto startTime = std::chrono::high_resolution_clock::now();
+		for (int iteration = 0; iteration < ITERATION_COUNT; iteration++)
+		{
+			for (int i = 0; i < ITEM_COUNT; i++)
+				EvaluateLegacyPose(*bones[0], frames[i * 2], frames[(i * 2) + 1], alphas[i], legacyTransforms[i].data());
+		}
+
+		auto legacyEndTime = std::chrono::high_resolution_clock::now();
+		for (int iteration = 0; iteration < ITERATION_COUNT; iteration++)
+			EvaluatePoses(jobs);
+
+		auto poseEndTime = std::chrono::high_resolution_clock::now();
+
+		for (int i = 0; i < ITEM_COUNT; i++)
+			EvaluateLegacyPose(*bones[0], decodedFrames[i * 2], decodedFrames[(i * 2) + 1], alphas[i], referenceTransforms[i].data());
+
+		// Rotation deviation is measured on 3x3 rotation part, translation deviation as distance in world units.
+		float quantRotDeviation = 0.0f;
+		float quantPosDeviation = 0.0f;
+		float rotDeviation = 0.0f;
+		float posDeviation = 0.0f;
+		for (int i = 0; i < ITEM_COUNT; i++)
+		{
+			for (int boneID : skeleton.BoneIDs)
+			{
+				const auto& legacy = legacyTransforms[i][boneID];
+				const auto& reference = referenceTransforms[i][boneID];
+				const auto& pose = poseTransforms[i][boneID];
+
+				for (int row = 0; row < 3; row++)
+				{
+					for (int col = 0; col < 3; col++)
+					{
+						quantRotDeviation = std::max(quantRotDeviation, std::abs(legacy.m[row][col] - pose.m[row][col]));
+						rotDeviation = std::max(rotDeviation, std::abs(reference.m[row][col] - pose.m[row][col]));
+					}
+				}
+
+				quantPosDeviation = std::max(quantPosDeviation, Vector3::Distance(legacy.Translation(), pose.Translation()));
+				posDeviation = std::max(posDeviation, Vector3::Distance(reference.Translation(), pose.Translation()));
+			}
+		}
+
+		bool isCorrect = (rotDeviation <= ROTATION_TOLERANCE && posDeviation <= TRANSLATION_TOLERANCE);
+
+		double legacyTime = std::chrono::duration<double, std::milli>(legacyEndTime - startTime).count() / ITERATION_COUNT;
+		double poseTime = std::chrono::duration<double, std::milli>(poseEndTime - legacyEndTime).count() / ITERATION_COUNT;
+
+		auto stream = std::ostringstream();
+		stream << std::fixed << std::setprecision(3);
+		stream << "Items: " << ITEM_COUNT << ", bones: " << BONE_COUNT << " (player skeleton), iterations: " << ITERATION_COUNT << std::endl;
+		stream << "Legacy walk (ms/frame): " << legacyTime << " (" << ((legacyTime * 1000000.0) / ITEM_COUNT) << " ns/item)" << std::endl;
+		stream << "Batched pose (ms/frame): " << poseTime << " (" << ((poseTime * 1000000.0) / ITEM_COUNT) << " ns/item)" << std::endl;
+		stream << std::setprecision(6);
+		stream << "Correctness vs. legacy on decoded keyframes: rotation " << rotDeviation << " (tolerance " << ROTATION_TOLERANCE << "), " <<
+			"translation " << posDeviation << " (tolerance " << TRANSLATION_TOLERANCE << "): " << (isCorrect ? "passed" : "FAILED") << std::endl;
+		stream << "Deviation vs. legacy on source keyframes (incl. quantization): rotation " << quantRotDeviation << ", translation " << quantPosDeviation << std::endl;
+		stream << "Keyframe orientations (bytes): " << (frames.size() * BONE_COUNT * sizeof(Quaternion)) << " unpacked, " <<
+			(packedOrients.size() * sizeof(PackedQuaternion)) << " packed" << std::endl;
+
+		if (!isCorrect)
+			TENLog("Batched pose evaluation deviates from legacy path beyond tolerance.", LogLevel::Error);
+
+		return stream.str();
+	}
+}
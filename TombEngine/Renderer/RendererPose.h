@@ -0,0 +1,52 @@
+#pragma once
+#include <SimpleMath.h>
+#include "Math/Objects/PackedQuaternion.h"
+#include "Renderer/RendererEnums.h"
+
+namespace TEN::Renderer::Structures { struct RendererBone; }
+
+// Skeletal pose evaluation. Independent of renderer state, so it can run headless.
+namespace TEN::Renderer::Pose
+{
+	using namespace DirectX::SimpleMath;
+	using TEN::Math::PackedQuaternion;
+
+	// Skeleton flattened in topological order: parent of each bone always precedes it.
+	struct PoseSkeleton
+	{
+		std::vector<int>	 BoneIDs		  = {}; // Bone ID at each slot.
+		std::vector<int>	 ParentBoneIDs	  = {}; // Parent bone ID at each slot. NO_VALUE for root.
+		std::vector<Vector3> BindTranslations = {}; // Translation to parent at each slot.
+		int					 MaxBoneID		  = NO_VALUE;
+
+		bool IsEmpty() const { return BoneIDs.empty(); }
+	};
+
+	struct PoseJob
+	{
+		const PoseSkeleton* Skeleton = nullptr;
+
+		// Keyframe data. Orientations are packed and indexed by bone ID.
+		const PackedQuaternion* Orientations0	  = nullptr;
+		const PackedQuaternion* Orientations1	  = nullptr;
+		int						OrientationCount0 = 0;
+		int						OrientationCount1 = 0;
+		Vector3					Offset0			  = Vector3::Zero;
+		Vector3					Offset1			  = Vector3::Zero;
+		float					Alpha			  = 0.0f;
+
+		const Quaternion* ExtraRotations = nullptr; // Indexed by bone ID. Optional.
+		Matrix*			  Transforms	 = nullptr; // Indexed by bone ID. Transforms of bones outside mask are kept.
+
+		unsigned int Mask					= UINT_MAX;
+		bool		 UseObjectWorldRotation = false;
+	};
+
+	PoseSkeleton BuildPoseSkeleton(const Structures::RendererBone& rootBone);
+
+	bool TestPoseJob(const PoseJob& job);
+	void EvaluatePose(const PoseJob& job);
+	void EvaluatePoses(const std::vector<PoseJob>& jobs);
+
+	std::string RunPoseBenchmark();
+}
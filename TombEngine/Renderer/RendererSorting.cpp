@@ -0,0 +1,326 @@
+#include "framework.h"
+#include "Renderer/RendererSorting.h"
+
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+#include "Math/Math.h"
+#include "Renderer/Structures/RendererSortableObject.h"
+
+using namespace TEN::Math;
+using namespace TEN::Renderer::Structures;
+
+namespace TEN::Renderer::Sorting
+{
+	SortedFaceRecording g_SortedFaceRecording = {};
+
+	int SortedFaceRecording::GetFrameCount() const
+	{
+		return (int)_frameStarts.size();
+	}
+
+	const SortedFaceKey* SortedFaceRecording::GetFrame(int frameIndex, int& keyCount) const
+	{
+		int start = _frameStarts[frameIndex];
+		int end = ((frameIndex + 1) < _frameStarts.size()) ? _frameStarts[frameIndex + 1] : (int)_keys.size();
+
+		keyCount = end - start;
+		return &_keys[start];
+	}
+
+	void SortedFaceRecording::SetEnabled(bool value)
+	{
+		_isEnabled = value;
+	}
+
+	bool SortedFaceRecording::IsEnabled() const
+	{
+		return _isEnabled;
+	}
+
+	bool SortedFaceRecording::Load(const std::string& path)
+	{
+		auto file = std::ifstream(path, std::ios::binary);
+		if (!file.is_open())
+		{
+			TENLog("Unable to open sorted face recording " + path, LogLevel::Error);
+			return false;
+		}
+
+		int magic = 0;
+		int keySize = 0;
+		int frameCount = 0;
+		int keyCount = 0;
+		file.read((char*)&magic, sizeof(int));
+		file.read((char*)&keySize, sizeof(int));
+		file.read((char*)&frameCount, sizeof(int));
+		file.read((char*)&keyCount, sizeof(int));
+
+		if (magic != FILE_MAGIC || keySize != sizeof(SortedFaceKey) || frameCount < 0 || keyCount < 0)
+		{
+			TENLog("Sorted face recording " + path + " is invalid or was recorded with a different key layout.", LogLevel::Error);
+			return false;
+		}
+
+		_frameStarts.resize(frameCount);
+		_keys.resize(keyCount);
+		file.read((char*)_frameStarts.data(), frameCount * sizeof(int));
+		file.read((char*)_keys.data(), keyCount * sizeof(SortedFaceKey));
+
+		TENLog("Loaded sorted face recording with " + std::to_string(frameCount) + " frames.", LogLevel::Info);
+		return file.good();
+	}
+
+	bool SortedFaceRecording::Save(const std::string& path) const
+	{
+		auto file = std::ofstream(path, std::ios::binary | std::ios::trunc);
+		if (!file.is_open())
+		{
+			TENLog("Unable to write sorted face recording " + path, LogLevel::Error);
+			return false;
+		}
+
+		int magic = FILE_MAGIC;
+		int keySize = sizeof(SortedFaceKey);
+		int frameCount = (int)_frameStarts.size();
+		int keyCount = (int)_keys.size();
+		file.write((char*)&magic, sizeof(int));
+		file.write((char*)&keySize, sizeof(int));
+		file.write((char*)&frameCount, sizeof(int));
+		file.write((char*)&keyCount, sizeof(int));
+		file.write((char*)_frameStarts.data(), frameCount * sizeof(int));
+		file.write((char*)_keys.data(), keyCount * sizeof(SortedFaceKey));
+
+		TENLog("Saved sorted face recording with " + std::to_string(frameCount) + " frames.", LogLevel::Info);
+		return file.good();
+	}
+
+	void SortedFaceRecording::Record(const std::vector<SortedFaceKey>& keys)
+	{
+		if (!_isEnabled || _frameStarts.size() >= FRAME_COUNT_MAX)
+			return;
+
+		_frameStarts.push_back((int)_keys.size());
+		_keys.insert(_keys.end(), keys.begin(), keys.end());
+	}
+
+	SortedFaceKey GetSortedFaceKey(const RendererSortableObject& object)
+	{
+		auto key = SortedFaceKey{};
+		key.Distance = object.Distance;
+		key.ObjectType = object.ObjectType;
+
+		switch (object.ObjectType)
+		{
+		case RendererObjectType::Room:
+		case RendererObjectType::MoveableAsStatic:
+			key.Owner = object.Room->RoomNumber;
+			break;
+
+		case RendererObjectType::Moveable:
+			key.Owner = object.Item->ItemNumber;
+			break;
+
+		case RendererObjectType::Static:
+			key.Owner = (object.Static->RoomNumber << 16) | object.Static->IndexInRoom;
+			break;
+
+		case RendererObjectType::Sprite:
+			key.Owner = (int)object.Sprite->Type | (object.Sprite->SoftParticle ? (1 << 8) : 0) | ((int)object.Sprite->renderType << 9);
+			key.BlendMode = (int)object.Sprite->BlendMode;
+			key.Texture = (uint64_t)object.Sprite->Sprite->Texture;
+			key.IndexCount = 6;
+			return key;
+
+		default:
+			return key;
+		}
+
+		key.BlendMode = (int)object.Bucket->BlendMode;
+		key.Texture = (uint64_t)object.Bucket->Texture;
+		key.IndexCount = (object.Polygon->Shape == 0) ? 6 : 3;
+		return key;
+	}
+
+	void SortFaces(const SortedFaceKey* keys, int keyCount, std::vector<int>& order, std::vector<uint64_t>& scratch)
+	{
+		constexpr auto DIGIT_BITS	= 8;
+		constexpr auto DIGIT_COUNT	= 1 << DIGIT_BITS;
+		constexpr auto PASS_COUNT	= 32 / DIGIT_BITS;
+
+		order.resize(keyCount);
+		if (keyCount == 0)
+			return;
+
+		// Pack inverted distance above face index, so ascending LSD radix sort yields stable back-to-front order.
+		scratch.resize(keyCount * 2);
+		auto* src = scratch.data();
+		auto* dest = scratch.data() + keyCount;
+
+		for (int i = 0; i < keyCount; i++)
+		{
+			unsigned int sortKey = UINT_MAX - (unsigned int)std::max(keys[i].Distance, 0);
+			src[i] = ((uint64_t)sortKey << 32) | (unsigned int)i;
+		}
+
+		for (int pass = 0; pass < PASS_COUNT; pass++)
+		{
+			int shift = 32 + (pass * DIGIT_BITS);
+
+			auto offsets = std::array<int, DIGIT_COUNT>{};
+			for (int i = 0; i < keyCount; i++)
+				offsets[(src[i] >> shift) & (DIGIT_COUNT - 1)]++;
+
+			// Skip pass if all faces share digit. Upper digits usually do, as distances rarely exceed 16 bits.
+			if (offsets[(src[0] >> shift) & (DIGIT_COUNT - 1)] == keyCount)
+				continue;
+
+			int offset = 0;
+			for (auto& count : offsets)
+			{
+				int digitCount = count;
+				count = offset;
+				offset += digitCount;
+			}
+
+			for (int i = 0; i < keyCount; i++)
+				dest[offsets[(src[i] >> shift) & (DIGIT_COUNT - 1)]++] = src[i];
+
+			std::swap(src, dest);
+		}
+
+		for (int i = 0; i < keyCount; i++)
+			order[i] = (int)(src[i] & UINT_MAX);
+	}
+
+	static bool TestSameDrawState(const SortedFaceKey& key0, const SortedFaceKey& key1)
+	{
+		return (key0.ObjectType == key1.ObjectType &&
+				key0.Owner == key1.Owner &&
+				key0.Texture == key1.Texture &&
+				key0.BlendMode == key1.BlendMode);
+	}
+
+	void GetFaceBatches(const SortedFaceKey* keys, const std::vector<int>& order, int indexCountMax, std::vector<SortedFaceBatch>& batches)
+	{
+		batches.clear();
+
+		for (int i = 0; i < order.size(); i++)
+		{
+			const auto& key = keys[order[i]];
+
+			if (!batches.empty())
+			{
+				auto& batch = batches.back();
+				const auto& batchKey = keys[order[batch.StartIndex]];
+
+				if (TestSameDrawState(batchKey, key) && (batch.IndexCount + key.IndexCount) < indexCountMax)
+				{
+					batch.Count++;
+					batch.IndexCount += key.IndexCount;
+					continue;
+				}
+			}
+
+			batches.push_back(SortedFaceBatch{ i, 1, key.IndexCount });
+		}
+	}
+
+	std::string RunSortBenchmark(const std::string& dumpPath)
+	{
+		constexpr auto SYNTHETIC_FRAME_COUNT = 60;
+		constexpr auto SYNTHETIC_FACE_COUNT	 = 16384;
+		constexpr auto STATE_COUNT			 = 64;
+
+		auto recording = SortedFaceRecording{};
+		bool isRecorded = (!dumpPath.empty() && recording.Load(dumpPath));
+		if (!isRecorded)
+		{
+			// Synthetic frames: faces clustered by owner with little distance spread, as in water and glass rooms.
+			recording.SetEnabled(true);
+			auto keys = std::vector<SortedFaceKey>(SYNTHETIC_FACE_COUNT);
+			for (int frame = 0; frame < SYNTHETIC_FRAME_COUNT; frame++)
+			{
+				for (auto& key : keys)
+				{
+					int state = Random::GenerateInt(0, STATE_COUNT - 1);
+					key.ObjectType = ((state % 4) == 0) ? RendererObjectType::Sprite : RendererObjectType::Room;
+					key.Owner = state;
+					key.Texture = state % 8;
+					key.IndexCount = (key.ObjectType == RendererObjectType::Sprite) ? 6 : 3;
+					key.Distance = (state * CLICK(1)) + Random::GenerateInt(0, CLICK(2));
+				}
+
+				recording.Record(keys);
+			}
+		}
+
+		int frameCount = recording.GetFrameCount();
+		long long faceCount = 0;
+		long long batchCount = 0;
+		int orderErrorCount = 0;
+		double legacyTime = 0.0;
+		double sortTime = 0.0;
+		double batchTime = 0.0;
+
+		auto objects = std::vector<RendererSortableObject>{};
+		auto order = std::vector<int>{};
+		auto scratch = std::vector<uint64_t>{};
+		auto batches = std::vector<SortedFaceBatch>{};
+
+		for (int frame = 0; frame < frameCount; frame++)
+		{
+			int keyCount = 0;
+			const auto* keys = recording.GetFrame(frame, keyCount);
+
+			// Previous path: comparison sort of full sortable objects.
+			objects.resize(keyCount);
+			for (int i = 0; i < keyCount; i++)
+				objects[i].Distance = keys[i].Distance;
+
+			auto startTime = std::chrono::high_resolution_clock::now();
+			std::sort(
+				objects.begin(), objects.end(),
+				[](const RendererSortableObject& object0, const RendererSortableObject& object1)
+				{
+					return (object0.Distance > object1.Distance);
+				});
+
+			auto legacyEndTime = std::chrono::high_resolution_clock::now();
+			SortFaces(keys, keyCount, order, scratch);
+			auto sortEndTime = std::chrono::high_resolution_clock::now();
+			GetFaceBatches(keys, order, MAX_TRANSPARENT_VERTICES, batches);
+			auto batchEndTime = std::chrono::high_resolution_clock::now();
+
+			legacyTime += std::chrono::duration<double, std::milli>(legacyEndTime - startTime).count();
+			sortTime += std::chrono::duration<double, std::milli>(sortEndTime - legacyEndTime).count();
+			batchTime += std::chrono::duration<double, std::milli>(batchEndTime - sortEndTime).count();
+			faceCount += keyCount;
+			batchCount += batches.size();
+
+			for (int i = 1; i < keyCount; i++)
+			{
+				if (keys[order[i - 1]].Distance < keys[order[i]].Distance ||
+					objects[i].Distance != keys[order[i]].Distance)
+				{
+					orderErrorCount++;
+				}
+			}
+		}
+
+		frameCount = std::max(frameCount, 1);
+
+		auto stream = std::ostringstream();
+		stream << std::fixed << std::setprecision(3);
+		stream << "Frames: " << recording.GetFrameCount() << ", faces: " << faceCount << (isRecorded ? " (recorded)" : " (synthetic)") << std::endl;
+		stream << "Comparison sort (ms/frame): " << (legacyTime / frameCount) << std::endl;
+		stream << "Radix sort (ms/frame): " << (sortTime / frameCount) << std::endl;
+		stream << "Batching (ms/frame): " << (batchTime / frameCount) << std::endl;
+		stream << "Batches per frame: " << ((double)batchCount / frameCount) << " (" << ((double)faceCount / std::max(batchCount, 1LL)) << " faces/batch)" << std::endl;
+		stream << "Order errors: " << orderErrorCount << std::endl;
+
+		return stream.str();
+	}
+}
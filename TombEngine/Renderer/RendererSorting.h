@@ -0,0 +1,67 @@
+#pragma once
+#include "Renderer/RendererEnums.h"
+
+namespace TEN::Renderer::Structures { struct RendererSortableObject; }
+
+// Back-to-front ordering and batching of transparent faces. Works on plain keys independent of renderer state,
+// so recorded frames can be sorted and batched headless.
+namespace TEN::Renderer::Sorting
+{
+	// Draw state of sortable object reduced to comparable values.
+	struct SortedFaceKey
+	{
+		int				   Distance	  = 0;
+		int				   IndexCount = 0; // Index count for mesh polygons, vertex count for sprites.
+		RendererObjectType ObjectType = RendererObjectType::Unknown;
+		int				   BlendMode  = 0;
+		int				   Owner	  = 0; // Room, item or static identity for meshes. Sprite type and flags for sprites.
+		int				   Reserved	  = 0;
+		uint64_t		   Texture	  = 0; // Bucket texture index for meshes, texture address for sprites.
+	};
+
+	// Run of consecutive faces in sorted order sharing draw state.
+	struct SortedFaceBatch
+	{
+		int StartIndex = 0;
+		int Count	   = 0;
+		int IndexCount = 0;
+	};
+
+	class SortedFaceRecording
+	{
+	private:
+		// Constants
+		static constexpr auto FILE_MAGIC	  = 0x54524F53; // "SORT"
+		static constexpr auto FRAME_COUNT_MAX = 1800;
+
+		// Members
+		bool					   _isEnabled	 = false;
+		std::vector<int>		   _frameStarts = {}; // First key of each frame.
+		std::vector<SortedFaceKey> _keys		 = {};
+
+	public:
+		// Getters
+		int					 GetFrameCount() const;
+		const SortedFaceKey* GetFrame(int frameIndex, int& keyCount) const;
+
+		// Setters
+		void SetEnabled(bool value);
+
+		// Inquirers
+		bool IsEnabled() const;
+
+		// Utilities
+		bool Load(const std::string& path);
+		bool Save(const std::string& path) const;
+		void Record(const std::vector<SortedFaceKey>& keys);
+	};
+
+	extern SortedFaceRecording g_SortedFaceRecording;
+
+	SortedFaceKey GetSortedFaceKey(const Structures::RendererSortableObject& object);
+
+	void SortFaces(const SortedFaceKey* keys, int keyCount, std::vector<int>& order, std::vector<uint64_t>& scratch);
+	void GetFaceBatches(const SortedFaceKey* keys, const std::vector<int>& order, int indexCountMax, std::vector<SortedFaceBatch>& batches);
+
+	std::string RunSortBenchmark(const std::string& dumpPath);
+}
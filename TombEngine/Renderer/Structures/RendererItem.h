@@ -14,11 +14,17 @@ namespace TEN::Renderer::Structures
 		int ObjectNumber;
 
 		Vector3 Position;
-		Matrix World;
+		Matrix World;	   // Interpolated for drawing.
+		Matrix LogicWorld; // Pose of current logic frame, used by gameplay queries.
 		Matrix Translation;
 		Matrix Rotation;
 		Matrix Scale;
 		Matrix AnimationTransforms[MAX_BONES];
+		Quaternion BoneExtraRotations[MAX_BONES];
+
+		// Pose at start of current logic frame, used for render interpolation.
+		Vector3	   PrevPosition	   = Vector3::Zero;
+		Quaternion PrevOrientation = Quaternion::Identity;
 
 		int RoomNumber = NO_VALUE;
 		int PrevRoomNumber = NO_VALUE;
@@ -1,6 +1,7 @@
 #pragma once
 #include <vector>
 #include <SimpleMath.h>
+#include "Renderer/RendererPose.h"
 #include "Renderer/Structures/RendererBone.h"
 #include "Renderer/Structures/RendererMesh.h"
 #include "Renderer/RendererEnums.h"
@@ -18,6 +19,7 @@ namespace TEN::Renderer::Structures
 		std::vector<Matrix> AnimationTransforms;
 		std::vector<Matrix> BindPoseTransforms;
 		std::vector<RendererBone*> LinearizedBones;
+		Pose::PoseSkeleton FlatSkeleton;
 		bool DoNotDraw;
 		ShadowMode ShadowType;
 
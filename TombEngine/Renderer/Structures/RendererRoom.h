@@ -2,6 +2,7 @@
 #include <vector>
 #include <SimpleMath.h>
 #include "Renderer/Graphics/RenderTarget2D.h"
+#include "Renderer/RendererLightGrid.h"
 #include "Renderer/Structures/RendererRectangle.h"
 #include "Renderer/Structures/RendererBucket.h"
 #include "Renderer/Structures/RendererLight.h"
@@ -33,5 +34,8 @@ namespace TEN::Renderer::Structures
 		BoundingBox BoundingBox;
 		RendererRectangle ClipBounds;
 		std::vector<int> Neighbors;
+
+		std::vector<RendererLight*> NeighborLights;	   // Point, spot and shadow lights of neighbor rooms.
+		Lighting::LightGrid			NeighborLightGrid; // Indexes NeighborLights.
 	};
 }
@@ -0,0 +1,12 @@
+#pragma once
+#include <string>
+
+// Level function called by engine event. Script resolves name on first call and stores handle here,
+// so later calls skip name lookup. Handle is stale once script generation changes, i.e. after
+// level functions were freed or redefined.
+struct ScriptCallback
+{
+	std::string	 Name		= {};
+	int			 Handle		= NO_VALUE; // Index into script's resolved function table.
+	unsigned int Generation = 0;		// Script generation handle was resolved in.
+};
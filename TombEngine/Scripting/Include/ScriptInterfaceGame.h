@@ -4,6 +4,7 @@
 
 #include "Game/control/event.h"
 #include "Game/room.h"
+#include "Scripting/Include/ScriptCallback.h"
 #include "Specific/level.h"
 
 typedef DWORD D3DCOLOR;
@@ -56,6 +57,7 @@ public:
 	virtual void OnLoad() = 0;
 	virtual void OnLoop(float deltaTime, bool postLoop) = 0;
 	virtual void OnSave() = 0;
+	virtual void OnSaveComplete(int slot, bool isSuccess) = 0;
 	virtual void OnEnd(GameStatus reason) = 0;
 	virtual void ShortenTENCalls() = 0;
 
@@ -63,8 +65,8 @@ public:
 	virtual void ResetScripts(bool clearGameVars) = 0;
 	virtual void ExecuteScriptFile(const std::string& luaFileName) = 0;
 	virtual void ExecuteString(const std::string& command) = 0;
-	virtual void ExecuteFunction(const std::string& luaFuncName, TEN::Control::Volumes::Activator, const std::string& arguments) = 0;
-	virtual void ExecuteFunction(const std::string& luaFuncName, short idOne, short idTwo = 0) = 0;
+	virtual void ExecuteFunction(ScriptCallback& callback, TEN::Control::Volumes::Activator, const std::string& arguments) = 0;
+	virtual void ExecuteFunction(ScriptCallback& callback, short idOne, short idTwo = 0) = 0;
 
 	virtual void GetVariables(std::vector<SavedVar>& vars) = 0;
 	virtual void SetVariables(const std::vector<SavedVar>& vars) = 0;
@@ -0,0 +1,174 @@
+#include "framework.h"
+#include "Scripting/Internal/GarbageCollector.h"
+
+#include <chrono>
+
+#include "Specific/Benchmark.h"
+
+using namespace TEN::Benchmark;
+
+namespace TEN::Scripting
+{
+	GarbageCollector g_GarbageCollector = {};
+
+	GarbageCollectionMode GarbageCollector::GetMode() const
+	{
+		return _mode;
+	}
+
+	const GarbageCollectionStats& GarbageCollector::GetStats() const
+	{
+		return _stats;
+	}
+
+	void GarbageCollector::SetMode(GarbageCollectionMode mode)
+	{
+		_mode = mode;
+		ApplyMode();
+	}
+
+	void GarbageCollector::SetStepSize(int stepSize)
+	{
+		_stepSize = std::max(stepSize, 1);
+	}
+
+	void GarbageCollector::SetTimeBudget(float timeInMs)
+	{
+		_timeBudget = std::max(timeInMs, 0.0f);
+	}
+
+	void GarbageCollector::Initialize(lua_State* state)
+	{
+		_state = state;
+		_stats = GarbageCollectionStats{};
+		ApplyMode();
+
+		_heapSizePrev = GetHeapSize();
+		_heapSizeLive = _heapSizePrev;
+	}
+
+	void GarbageCollector::Update()
+	{
+		if (_state == nullptr)
+			return;
+
+		auto profile = ScopedProfile(ProfileSection::GarbageCollection);
+		auto startTime = std::chrono::high_resolution_clock::now();
+
+		_stats.StepCount = 0;
+
+		switch (_mode)
+		{
+		case GarbageCollectionMode::Full:
+			lua_gc(_state, LUA_GCCOLLECT, 0);
+			_stats.StepCount = 1;
+			break;
+
+		case GarbageCollectionMode::Incremental:
+		{
+			// Scale step with heap growth, so collection keeps pace with scripts that allocate more per frame.
+			int growth = GetHeapSize() - _heapSizePrev;
+			int stepSize = std::max(_stepSize, growth * STEP_GROWTH_SCALE);
+
+			// At least one step per frame guarantees progress. Stop early once cycle is complete.
+			while (_stats.StepCount < STEP_COUNT_MAX)
+			{
+				_stats.StepCount++;
+				if (lua_gc(_state, LUA_GCSTEP, stepSize) != 0)
+				{
+					_heapSizeLive = GetHeapSize();
+					break;
+				}
+
+				auto time = std::chrono::duration<float, std::milli>(std::chrono::high_resolution_clock::now() - startTime).count();
+				if (time >= _timeBudget)
+					break;
+			}
+
+			UpdateAutomaticCollection();
+			break;
+		}
+
+		case GarbageCollectionMode::Generational:
+			// Collector runs automatically on allocation.
+			break;
+		}
+
+		_stats.Time = std::chrono::duration<float, std::milli>(std::chrono::high_resolution_clock::now() - startTime).count();
+		_stats.HeapSize = GetHeapSize();
+		_heapSizePrev = _stats.HeapSize;
+	}
+
+	void GarbageCollector::Collect()
+	{
+		if (_state == nullptr)
+			return;
+
+		lua_gc(_state, LUA_GCCOLLECT, 0);
+		_stats.HeapSize = GetHeapSize();
+		_heapSizePrev = _stats.HeapSize;
+		_heapSizeLive = _stats.HeapSize;
+	}
+
+	void GarbageCollector::ApplyMode()
+	{
+		if (_state == nullptr)
+			return;
+
+		_stats.IsAutomatic = false;
+
+		switch (_mode)
+		{
+		case GarbageCollectionMode::Full:
+#ifdef LUA_GCINC
+			lua_gc(_state, LUA_GCINC, 0, 0, 0);
+#endif
+			lua_gc(_state, LUA_GCRESTART, 0);
+			break;
+
+		case GarbageCollectionMode::Incremental:
+#ifdef LUA_GCINC
+			lua_gc(_state, LUA_GCINC, 0, 0, 0);
+#endif
+			// Automatic collection would run steps at arbitrary allocation points inside scripts,
+			// so it's stopped and all steps are taken from Update() instead.
+			lua_gc(_state, LUA_GCSTOP, 0);
+			break;
+
+		case GarbageCollectionMode::Generational:
+#ifdef LUA_GCGEN
+			lua_gc(_state, LUA_GCGEN, 0, 0);
+			lua_gc(_state, LUA_GCRESTART, 0);
+#else
+			TENLog("Generational garbage collection is not supported by this Lua version. Using incremental mode.", LogLevel::Warning);
+			_mode = GarbageCollectionMode::Incremental;
+			lua_gc(_state, LUA_GCSTOP, 0);
+#endif
+			break;
+		}
+	}
+
+	// Backstop for budgeted steps: if script allocates faster than steps reclaim, hand pacing to Lua's
+	// automatic collector until heap is back under threshold, so heap can't grow unbounded.
+	void GarbageCollector::UpdateAutomaticCollection()
+	{
+		int heapSize = GetHeapSize();
+		int heapSizeMax = std::max(_heapSizeLive * HEAP_GROWTH_MAX, HEAP_SIZE_MIN);
+
+		if (!_stats.IsAutomatic && heapSize > heapSizeMax)
+		{
+			lua_gc(_state, LUA_GCRESTART, 0);
+			_stats.IsAutomatic = true;
+		}
+		else if (_stats.IsAutomatic && heapSize <= heapSizeMax)
+		{
+			lua_gc(_state, LUA_GCSTOP, 0);
+			_stats.IsAutomatic = false;
+		}
+	}
+
+	int GarbageCollector::GetHeapSize() const
+	{
+		return lua_gc(_state, LUA_GCCOUNT, 0);
+	}
+}
@@ -0,0 +1,67 @@
+#pragma once
+
+struct lua_State;
+
+namespace TEN::Scripting
+{
+	enum class GarbageCollectionMode
+	{
+		Full,		  // Stop-the-world collection every frame (legacy behaviour).
+		Incremental,  // Incremental steps within per-frame time budget.
+		Generational  // Lua's own generational collector, if available.
+	};
+
+	struct GarbageCollectionStats
+	{
+		int	  HeapSize		= 0;		// In kilobytes.
+		float Time			= 0.0f;		// In milliseconds.
+		int	  StepCount		= 0;
+		bool  IsAutomatic	= false;	// Heap outgrew budgeted steps and Lua's automatic collector took over.
+	};
+
+	// Drives Lua garbage collection once per frame according to selected policy.
+	// Full collections are requested explicitly on level load and save, when a spike goes unnoticed.
+	class GarbageCollector
+	{
+	private:
+		// Constants
+		static constexpr auto STEP_SIZE_DEFAULT	  = 16;	  // In kilobytes.
+		static constexpr auto TIME_BUDGET_DEFAULT = 1.0f; // In milliseconds.
+		static constexpr auto STEP_COUNT_MAX	  = 64;
+		static constexpr auto STEP_GROWTH_SCALE	  = 2;	  // Step size per kilobyte heap grew since previous frame.
+		static constexpr auto HEAP_GROWTH_MAX	  = 2;	  // Heap size relative to live heap above which automatic collection takes over.
+		static constexpr auto HEAP_SIZE_MIN		  = 4096; // In kilobytes. Lower bound of automatic collection threshold.
+
+		// Members
+		lua_State*			   _state		 = nullptr;
+		GarbageCollectionMode  _mode		 = GarbageCollectionMode::Incremental;
+		int					   _stepSize	 = STEP_SIZE_DEFAULT;
+		float				   _timeBudget	 = TIME_BUDGET_DEFAULT;
+		int					   _heapSizePrev = 0; // In kilobytes.
+		int					   _heapSizeLive = 0; // In kilobytes. Heap size after last completed cycle.
+		GarbageCollectionStats _stats		 = {};
+
+	public:
+		// Getters
+		GarbageCollectionMode		  GetMode() const;
+		const GarbageCollectionStats& GetStats() const;
+
+		// Setters
+		void SetMode(GarbageCollectionMode mode);
+		void SetStepSize(int stepSize);
+		void SetTimeBudget(float timeInMs);
+
+		// Utilities
+		void Initialize(lua_State* state);
+		void Update();
+		void Collect();
+
+	private:
+		// Helpers
+		void ApplyMode();
+		void UpdateAutomaticCollection();
+		int	 GetHeapSize() const;
+	};
+
+	extern GarbageCollector g_GarbageCollector;
+}
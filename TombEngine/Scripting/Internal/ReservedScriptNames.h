@@ -59,6 +59,7 @@ static constexpr char ScriptReserved_OnLoad[]			= "OnLoad";
 static constexpr char ScriptReserved_OnLoop[]			= "OnLoop";
 static constexpr char ScriptReserved_OnControlPhase[]	= "OnControlPhase"; // DEPRECATED
 static constexpr char ScriptReserved_OnSave[]			= "OnSave";
+static constexpr char ScriptReserved_OnSaveComplete[]	= "OnSaveComplete";
 static constexpr char ScriptReserved_OnEnd[]			= "OnEnd";
 
 static constexpr char ScriptReserved_EndReasonExitToTitle[]		= "EXITTOTITLE";
@@ -213,6 +214,7 @@ static constexpr char ScriptReserved_SaveGame[]					= "SaveGame";
 static constexpr char ScriptReserved_LoadGame[]					= "LoadGame";
 static constexpr char ScriptReserved_DeleteSaveGame[]			= "DeleteSaveGame";
 static constexpr char ScriptReserved_DoesSaveGameExist[]		= "DoesSaveGameExist";
+static constexpr char ScriptReserved_IsSaveGameInProgress[]		= "IsSaveGameInProgress";
 static constexpr char ScriptReserved_GetSecretCount[]			= "GetSecretCount";
 static constexpr char ScriptReserved_SetSecretCount[]			= "SetSecretCount";
 static constexpr char ScriptReserved_SetTotalSecretCount[]		= "SetTotalSecretCount";
@@ -235,6 +237,7 @@ static constexpr char ScriptReserved_LaraType[]		  = "LaraType";
 static constexpr char ScriptReserved_RotationAxis[]	  = "RotationAxis";
 static constexpr char ScriptReserved_ItemAction[]	  = "ItemAction";
 static constexpr char ScriptReserved_ErrorMode[]	  = "ErrorMode";
+static constexpr char ScriptReserved_GCMode[]		  = "GCMode";
 static constexpr char ScriptReserved_InventoryItem[]  = "InventoryItem";
 static constexpr char ScriptReserved_LaraWeaponType[] = "LaraWeaponType";
 static constexpr char ScriptReserved_PlayerAmmoType[] = "PlayerAmmoType";
@@ -1,6 +1,7 @@
 #include "framework.h"
 #include "Scripting/Include/ScriptInterfaceState.h"
 
+#include "Scripting/Internal/GarbageCollector.h"
 #include "Scripting/Internal/ReservedScriptNames.h"
 #include "Scripting/Internal/TEN/Effects/EffectsFunctions.h"
 #include "Scripting/Internal/TEN/Flow/FlowHandler.h"
@@ -50,6 +51,8 @@ void ScriptInterfaceState::Init(const std::string& assetsDir)
 	SolState.script("package.path=\"" + assetsDir + "Scripts/?.lua\"");
 	SolState.set_exception_handler(lua_exception_handler);
 
+	TEN::Scripting::g_GarbageCollector.Initialize(SolState.lua_state());
+
 	RootTable = sol::table(SolState.lua_state(), sol::create);
 	SolState.set(ScriptReserved_TEN, RootTable);
 
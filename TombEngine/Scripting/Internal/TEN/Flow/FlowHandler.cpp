@@ -170,6 +170,13 @@ Check if a savegame exists.
 */
 	tableFlow.set_function(ScriptReserved_DoesSaveGameExist, &FlowHandler::DoesSaveGameExist, this);
 
+/***
+Check if a savegame is still being written to disk. Savegame data is collected when OnSave is called and written in background afterwards.
+@function IsSaveGameInProgress
+@treturn bool true if a savegame is being written, false if not.
+*/
+	tableFlow.set_function(ScriptReserved_IsSaveGameInProgress, &FlowHandler::IsSaveGameInProgress, this);
+
 /***
 Returns the player's current per-game secret count.
 @function GetSecretCount
@@ -270,6 +277,7 @@ Specify which translations in the strings table correspond to which languages.
 	m_handler.MakeReadOnlyTable(tableFlow, ScriptReserved_RotationAxis, ROTATION_AXES);
 	m_handler.MakeReadOnlyTable(tableFlow, ScriptReserved_ItemAction, ITEM_MENU_ACTIONS);
 	m_handler.MakeReadOnlyTable(tableFlow, ScriptReserved_ErrorMode, ERROR_MODES);
+	m_handler.MakeReadOnlyTable(tableFlow, ScriptReserved_GCMode, GC_MODES);
 	m_handler.MakeReadOnlyTable(tableFlow, ScriptReserved_GameStatus, GAME_STATUSES);
 }
 
@@ -345,6 +353,10 @@ void FlowHandler::LoadFlowScript()
 	m_handler.ExecuteScript(m_gameDir + "Scripts/Settings.lua", true);
 
 	SetScriptErrorMode(GetSettings()->ErrorMode);
+
+	TEN::Scripting::g_GarbageCollector.SetStepSize(GetSettings()->GCStepSize);
+	TEN::Scripting::g_GarbageCollector.SetTimeBudget(GetSettings()->GCTimeBudget);
+	TEN::Scripting::g_GarbageCollector.SetMode(GetSettings()->GCMode);
 	
 	// Check if levels exist in Gameflow.lua.
 	if (Levels.empty())
@@ -495,6 +507,11 @@ bool FlowHandler::DoesSaveGameExist(int slot)
 	return SaveGame::DoesSaveGameExist(slot, true);
 }
 
+bool FlowHandler::IsSaveGameInProgress()
+{
+	return SaveGame::IsSaveInProgress();
+}
+
 int FlowHandler::GetSecretCount() const
 {
 	return SaveGame::Statistics.Game.Secrets;
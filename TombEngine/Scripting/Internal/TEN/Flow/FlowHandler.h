@@ -69,6 +69,7 @@ public:
 	void		LoadGame(int slot);
 	void		DeleteSaveGame(int slot);
 	bool		DoesSaveGameExist(int slot);
+	bool		IsSaveGameInProgress();
 	int			GetSecretCount() const;
 	void		SetSecretCount(int secretsNum);
 	void		AddSecret(int levelSecretIndex);
@@ -31,6 +31,32 @@ has an unrecoverable error, the game will close.
 
 @mem errorMode
 */
-		"errorMode", &Settings::ErrorMode
+		"errorMode", &Settings::ErrorMode,
+
+/*** How should the engine collect unused Lua memory?
+Must be one of the following:
+`GCMode.INCREMENTAL` - collect in small steps every frame, limited by `gcTimeBudget`. Recommended.
+
+`GCMode.GENERATIONAL` - use Lua's generational collector. Falls back to incremental mode if Lua version doesn't support it.
+
+`GCMode.FULL` - run full collection every frame. This was default behaviour in earlier versions and may cause
+stutter in levels with heavy scripts.
+
+Regardless of mode, full collection is always done when level is loaded or game is saved.
+
+@mem gcMode
+*/
+		"gcMode", &Settings::GCMode,
+
+/*** Amount of memory in kilobytes each incremental garbage collection step processes.
+@mem gcStepSize
+*/
+		"gcStepSize", &Settings::GCStepSize,
+
+/*** Time in milliseconds incremental garbage collection may take per frame.
+At least one step is always done per frame, even if it takes longer.
+@mem gcTimeBudget
+*/
+		"gcTimeBudget", &Settings::GCTimeBudget
 		);
 }
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "Scripting/Internal/GarbageCollector.h"
 #include "Scripting/Internal/ScriptAssert.h"
 #include <string>
 
@@ -9,6 +10,12 @@ static const std::unordered_map<std::string, ErrorMode> ERROR_MODES {
 	{"TERMINATE", ErrorMode::Terminate}
 };
 
+static const std::unordered_map<std::string, TEN::Scripting::GarbageCollectionMode> GC_MODES {
+	{"FULL", TEN::Scripting::GarbageCollectionMode::Full},
+	{"INCREMENTAL", TEN::Scripting::GarbageCollectionMode::Incremental},
+	{"GENERATIONAL", TEN::Scripting::GarbageCollectionMode::Generational}
+};
+
 namespace sol {
 	class state;
 }
@@ -17,6 +24,10 @@ struct Settings
 {
 	ErrorMode ErrorMode;
 
+	TEN::Scripting::GarbageCollectionMode GCMode	   = TEN::Scripting::GarbageCollectionMode::Incremental;
+	int									  GCStepSize   = 16;
+	float								  GCTimeBudget = 1.0f;
+
 	static void Register(sol::table & parent);
 };
 
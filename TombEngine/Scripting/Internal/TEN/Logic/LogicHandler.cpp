@@ -7,6 +7,7 @@
 #include "Game/effects/Electricity.h"
 #include "Game/Lara/lara.h"
 #include "Game/savegame.h"
+#include "Scripting/Internal/GarbageCollector.h"
 #include "Scripting/Internal/ReservedScriptNames.h"
 #include "Scripting/Internal/ScriptAssert.h"
 #include "Scripting/Internal/ScriptUtil.h"
@@ -16,7 +17,9 @@
 #include "Scripting/Internal/TEN/Rotation/Rotation.h"
 #include "Scripting/Internal/TEN/Vec2/Vec2.h"
 #include "Scripting/Internal/TEN/Vec3/Vec3.h"
+#include "Specific/Benchmark.h"
 
+using namespace TEN::Benchmark;
 using namespace TEN::Effects::Electricity;
 
 /***
@@ -374,6 +377,7 @@ bool LogicHandler::SetLevelFuncsMember(sol::table tab, const std::string& name,
 
 		// Add function itself.
 		m_levelFuncs_luaFunctions[fullName] = value;
+		InvalidateCallbackHandles();
 	}
 	else if (sol::type::table == value.get_type())
 	{
@@ -447,6 +451,7 @@ void LogicHandler::FreeLevelScripts()
 
 	m_levelFuncs_tablesOfNames.clear();
 	m_levelFuncs_luaFunctions.clear();
+	InvalidateCallbackHandles();
 	m_levelFuncs_levelFuncObjects = sol::table{ *m_handler.GetState(), sol::create };
 
 	m_levelFuncs_tablesOfNames.emplace(std::make_pair(ScriptReserved_LevelFuncs, std::unordered_map<std::string, std::string>{}));
@@ -456,6 +461,7 @@ void LogicHandler::FreeLevelScripts()
 	m_onLoad = sol::nil;
 	m_onLoop = sol::nil;
 	m_onSave = sol::nil;
+	m_onSaveComplete = sol::nil;
 	m_onEnd = sol::nil;
 	m_handler.GetState()->collect_garbage();
 }
@@ -890,20 +896,57 @@ void LogicHandler::ExecuteString(const std::string& command)
 	m_handler.ExecuteString(command);
 }
 
+// Resolves callback name into function handle on first call and stores handle in callback itself.
+// Volume events store function names relative to LevelFuncs.
+const sol::protected_function& LogicHandler::GetCallbackHandle(ScriptCallback& callback, bool isRelative)
+{
+	if (callback.Generation == m_callbackGeneration && callback.Handle != NO_VALUE)
+		return m_callbackHandles[callback.Handle];
+
+	auto fullName = isRelative ? (std::string(ScriptReserved_LevelFuncs) + "." + callback.Name) : callback.Name;
+
+	auto it = m_callbackIndices.find(fullName);
+	if (it == m_callbackIndices.end())
+	{
+		// Unknown names resolve to invalid handle, so failed lookups aren't repeated either.
+		auto funcIt = m_levelFuncs_luaFunctions.find(fullName);
+		m_callbackHandles.push_back((funcIt != m_levelFuncs_luaFunctions.end()) ? funcIt->second : sol::protected_function{});
+		it = m_callbackIndices.emplace(fullName, (int)m_callbackHandles.size() - 1).first;
+	}
+
+	callback.Handle = it->second;
+	callback.Generation = m_callbackGeneration;
+	return m_callbackHandles[callback.Handle];
+}
+
+void LogicHandler::InvalidateCallbackHandles()
+{
+	m_callbackHandles.clear();
+	m_callbackIndices.clear();
+	m_callbackGeneration++;
+}
+
 // These wind up calling CallLevelFunc, which is where all error checking is.
-void LogicHandler::ExecuteFunction(const std::string& name, short idOne, short idTwo) 
+// Moveable arguments are passed by value, so that sol moves them into Lua-owned userdata
+// instead of allocating separate heap object for each argument.
+void LogicHandler::ExecuteFunction(ScriptCallback& callback, short idOne, short idTwo) 
 {
-	sol::protected_function func = m_levelFuncs_luaFunctions[name];
+	const auto& func = GetCallbackHandle(callback, false);
+	if (!func.valid())
+		return;
 
-	func(std::make_unique<Moveable>(idOne), std::make_unique<Moveable>(idTwo));
+	func(Moveable(idOne), Moveable(idTwo));
 }
 
-void LogicHandler::ExecuteFunction(const std::string& name, TEN::Control::Volumes::Activator activator, const std::string& arguments)
+void LogicHandler::ExecuteFunction(ScriptCallback& callback, TEN::Control::Volumes::Activator activator, const std::string& arguments)
 {
-	sol::protected_function func = (*m_handler.GetState())[ScriptReserved_LevelFuncs][name.c_str()];
+	const auto& func = GetCallbackHandle(callback, true);
+	if (!func.valid())
+		return;
+
 	if (std::holds_alternative<short>(activator))
 	{
-		func(std::make_unique<Moveable>(std::get<short>(activator), true), arguments);
+		func(Moveable(std::get<short>(activator), true), arguments);
 	}
 	else
 	{
@@ -911,6 +954,44 @@ void LogicHandler::ExecuteFunction(const std::string& name, TEN::Control::Volume
 	}
 }
 
+// Dispatches count calls to no-op Lua function through previous lookup path (table lookup by name
+// and heap-allocated arguments) and through cached handle, profiling both for comparison.
+// Function lives in private table and temporary handle slot, so level script state is left untouched.
+void LogicHandler::RunCallbackBenchmark(int count)
+{
+	constexpr auto FUNC_NAME = "BenchmarkCallback";
+
+	auto& state = *m_handler.GetState();
+	auto result = state.safe_script("return function(a, b) end", sol::script_pass_on_error);
+	if (!result.valid())
+		return;
+
+	auto funcs = state.create_table();
+	funcs[FUNC_NAME] = result.get<sol::protected_function>();
+
+	short itemNumber = LaraItem->Index;
+
+	{
+		auto profile = ScopedProfile(ProfileSection::CallbacksLookup);
+		for (int i = 0; i < count; i++)
+		{
+			sol::protected_function func = funcs[FUNC_NAME];
+			func(std::make_unique<Moveable>(itemNumber), std::make_unique<Moveable>(itemNumber));
+		}
+	}
+
+	// Bind callback to temporary slot directly instead of resolving it by name.
+	m_callbackHandles.push_back(funcs[FUNC_NAME]);
+	auto callback = ScriptCallback{ FUNC_NAME, (int)m_callbackHandles.size() - 1, m_callbackGeneration };
+
+	{
+		auto profile = ScopedProfile(ProfileSection::CallbacksCached);
+		for (int i = 0; i < count; i++)
+			ExecuteFunction(callback, itemNumber, itemNumber);
+	}
+
+	m_callbackHandles.pop_back();
+}
 
 void LogicHandler::OnStart()
 {
@@ -922,6 +1003,8 @@ void LogicHandler::OnStart()
 
 	for (auto& name : m_callbacksPostStart)
 		CallLevelFuncByName(name);
+
+	TEN::Scripting::g_GarbageCollector.Collect();
 }
 
 void LogicHandler::OnLoad()
@@ -934,6 +1017,8 @@ void LogicHandler::OnLoad()
 
 	for (auto& name : m_callbacksPostLoad)
 		CallLevelFuncByName(name);
+
+	TEN::Scripting::g_GarbageCollector.Collect();
 }
 
 void LogicHandler::OnLoop(float deltaTime, bool postLoop)
@@ -943,7 +1028,12 @@ void LogicHandler::OnLoop(float deltaTime, bool postLoop)
 		for (auto& name : m_callbacksPreLoop)
 			CallLevelFuncByName(name, deltaTime);
 
-		lua_gc(m_handler.GetState()->lua_state(), LUA_GCCOLLECT, 0);
+		TEN::Scripting::g_GarbageCollector.Update();
+
+		int benchmarkCallbackCount = g_Benchmark.GetSettings().CallbackCount;
+		if (benchmarkCallbackCount > 0)
+			RunCallbackBenchmark(benchmarkCallbackCount);
+
 		if (m_onLoop.valid())
 			CallLevelFunc(m_onLoop, deltaTime);
 	}
@@ -964,6 +1054,15 @@ void LogicHandler::OnSave()
 
 	for (auto& name : m_callbacksPostSave)
 		CallLevelFuncByName(name);
+
+	TEN::Scripting::g_GarbageCollector.Collect();
+}
+
+// Called on game thread once background savegame write has finished or failed.
+void LogicHandler::OnSaveComplete(int slot, bool isSuccess)
+{
+	if (m_onSaveComplete.valid())
+		CallLevelFunc(m_onSaveComplete, slot, isSuccess);
 }
 
 void LogicHandler::OnEnd(GameStatus reason)
@@ -1099,6 +1198,8 @@ __The order of loading is as follows:__
 @tfield function(float) OnLoop Will be called during the game's update loop,
 and provides the delta time (a float representing game time since last call) via its argument.
 @tfield function OnSave Will be called when the player saves the game, just *before* data is saved
+@tfield function(int,bool) OnSaveComplete Will be called once saved game has been written to disk in the background,
+and provides savegame slot and whether writing succeeded via its arguments. If writing failed, previous saved game in slot is kept.
 @tfield function OnEnd(EndReason) Will be called when leaving a level. This includes finishing it, exiting to the menu, or loading a save in a different level. It can take an `EndReason` arg:
 
 	EXITTOTITLE
@@ -1141,5 +1242,6 @@ void LogicHandler::InitCallbacks()
 	assignCB(m_onLoop, ScriptReserved_OnControlPhase);
 	assignCB(m_onLoop, ScriptReserved_OnLoop);
 	assignCB(m_onSave, ScriptReserved_OnSave);
+	assignCB(m_onSaveComplete, ScriptReserved_OnSaveComplete);
 	assignCB(m_onEnd, ScriptReserved_OnEnd);
 }
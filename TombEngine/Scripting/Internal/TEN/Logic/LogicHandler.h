@@ -51,10 +51,17 @@ private:
 	// "LevelFuncs.MyLevel.CoolFuncs"
 	std::unordered_map<std::string, std::unordered_map<std::string, std::string>> m_levelFuncs_tablesOfNames{};
 
+	// Functions called by engine events (volumes, OnHit, OnKilled, collisions). Each ScriptCallback resolves its
+	// name once into index of this table. Cleared and generation bumped whenever level functions are reset or redefined.
+	std::vector<sol::protected_function> m_callbackHandles{};
+	std::unordered_map<std::string, int> m_callbackIndices{}; // Only used while resolving.
+	unsigned int						 m_callbackGeneration = 1;
+
 	sol::protected_function	m_onStart{};
 	sol::protected_function	m_onLoad{};
 	sol::protected_function	m_onLoop{};
 	sol::protected_function	m_onSave{};
+	sol::protected_function	m_onSaveComplete{};
 	sol::protected_function	m_onEnd{};
 
 	std::unordered_set<std::string> m_callbacksPreSave;
@@ -80,6 +87,10 @@ private:
 	void ResetGameTables();
 	LuaHandler m_handler;
 
+	const sol::protected_function& GetCallbackHandle(ScriptCallback& callback, bool isRelative);
+	void InvalidateCallbackHandles();
+	void RunCallbackBenchmark(int count);
+
 public:	
 	LogicHandler(sol::state* lua, sol::table& parent);
 
@@ -134,9 +145,9 @@ public:
 
 	void ExecuteScriptFile(const std::string& luaFilename) override;
 	void ExecuteString(const std::string& command) override;
-	void ExecuteFunction(const std::string& name, TEN::Control::Volumes::Activator, const std::string& arguments) override;
+	void ExecuteFunction(ScriptCallback& callback, TEN::Control::Volumes::Activator, const std::string& arguments) override;
 
-	void ExecuteFunction(const std::string& name, short idOne, short idTwo) override;
+	void ExecuteFunction(ScriptCallback& callback, short idOne, short idTwo) override;
 
 	void GetVariables(std::vector<SavedVar>& vars) override;
 	void SetVariables(const std::vector<SavedVar>& vars) override;
@@ -169,5 +180,6 @@ public:
 	void OnLoad() override;
 	void OnLoop(float deltaTime, bool postLoop) override;
 	void OnSave() override;
+	void OnSaveComplete(int slot, bool isSuccess) override;
 	void OnEnd(GameStatus reason) override;
 };
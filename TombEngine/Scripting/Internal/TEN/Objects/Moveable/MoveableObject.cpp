@@ -1,6 +1,7 @@
 #include "framework.h"
 #include "Scripting/Internal/TEN/Objects/Moveable/MoveableObject.h"
 
+#include "Game/collision/BroadPhase.h"
 #include "Game/collision/floordata.h"
 #include "Game/control/lot.h"
 #include "Game/effects/debris.h"
@@ -21,6 +22,7 @@
 #include "Scripting/Internal/TEN/Vec3/Vec3.h"
 #include "Specific/level.h"
 
+using namespace TEN::Collision::BroadPhase;
 using namespace TEN::Collision::Floordata;
 using namespace TEN::Effects::Items;
 using namespace TEN::Math;
@@ -484,16 +486,16 @@ void Moveable::SetObjectID(GAME_OBJECT_ID id)
 	m_item->ResetModelToDefault();
 }
 
-void SetLevelFuncCallback(const TypeOrNil<LevelFunc>& cb, const std::string& callerName, Moveable& mov, std::string& toModify)
+void SetLevelFuncCallback(const TypeOrNil<LevelFunc>& cb, const std::string& callerName, Moveable& mov, ScriptCallback& toModify)
 {
 	if (std::holds_alternative<LevelFunc>(cb))
 	{
-		toModify = std::get<LevelFunc>(cb).m_funcName;
+		toModify = ScriptCallback{ std::get<LevelFunc>(cb).m_funcName };
 		dynamic_cast<ObjectsHandler*>(g_GameScriptEntities)->TryAddColliding(mov.m_num);
 	}
 	else if (std::holds_alternative<sol::nil_t>(cb))
 	{
-		toModify = std::string{};
+		toModify = ScriptCallback{};
 		dynamic_cast<ObjectsHandler*>(g_GameScriptEntities)->TryRemoveColliding(mov.m_num);
 	}
 	else
@@ -599,6 +601,10 @@ void Moveable::SetPos(const Vec3& pos, sol::optional<bool> updateRoom)
 		}
 	}
 
+	// Re-bucket right away, so collision queries later in same frame find item at new position.
+	if (m_initialized)
+		g_BroadPhase.UpdateItem(m_item->Index);
+
 	if (m_item->IsBridge())
 		UpdateBridgeItem(*m_item);
 }
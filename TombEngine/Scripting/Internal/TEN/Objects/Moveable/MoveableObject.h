@@ -1,4 +1,5 @@
 #pragma once
+#include "Scripting/Include/ScriptCallback.h"
 #include "Scripting/Internal/ScriptUtil.h"
 #include "Scripting/Internal/TEN/Objects/NamedBase.h"
 #include "Scripting/Internal/TEN/Objects/Room/RoomObject.h"
@@ -129,7 +130,7 @@ public:
 	void Init();
 
 	friend bool operator ==(const Moveable&, const Moveable&);
-	friend void SetLevelFuncCallback(const TypeOrNil<LevelFunc>& cb, const std::string& callerName, Moveable& mov, std::string& toModify);
+	friend void SetLevelFuncCallback(const TypeOrNil<LevelFunc>& cb, const std::string& callerName, Moveable& mov, ScriptCallback& toModify);
 
 	short GetIndex() const;
 
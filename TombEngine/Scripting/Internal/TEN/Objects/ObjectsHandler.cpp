@@ -180,15 +180,15 @@ void ObjectsHandler::TestCollidingObjects()
 	for (int itemNumber0 : m_collidingItems)
 	{
 		auto& item = g_Level.Items[itemNumber0];
-		if (!item.Callbacks.OnObjectCollided.empty())
+		if (!item.Callbacks.OnObjectCollided.Name.empty())
 		{
 			// Test against other moveables.
-			auto collObjects = GetCollidedObjects(item, true, false);
+			auto collObjects = GetCollidedObjects(item, true, false, 0.0f, ObjectCollectionMode::Items);
 			for (const auto& collidedItemPtr : collObjects.ItemPtrs)
 				g_GameScript->ExecuteFunction(item.Callbacks.OnObjectCollided, itemNumber0, collidedItemPtr->Index);
 		}
 
-		if (!item.Callbacks.OnRoomCollided.empty())
+		if (!item.Callbacks.OnRoomCollided.Name.empty())
 		{
 			// Test against room geometry.
 			if (TestItemRoomCollisionAABB(&item))
@@ -1,6 +1,8 @@
 #pragma once
 #include "framework.h"
 
+#include "Game/collision/BroadPhase.h"
+#include "Game/collision/Raycast.h"
 #include "Game/effects/debris.h"
 #include "Scripting/Internal/ScriptAssert.h"
 #include "Scripting/Internal/TEN/Objects/Static/StaticObject.h"
@@ -9,6 +11,10 @@
 #include "Scripting/Internal/TEN/Color/Color.h"
 #include "Scripting/Internal/ScriptUtil.h"
 #include "Scripting/Internal/ReservedScriptNames.h"
+
+using namespace TEN::Collision::BroadPhase;
+using namespace TEN::Collision::Raycast;
+
 /***
 Statics
 
@@ -169,6 +175,8 @@ void Static::SetPos(Vec3 const& pos)
 	m_mesh.pos.Position.y = pos.y;
 	m_mesh.pos.Position.z = pos.z;
 	m_mesh.Dirty = true;
+	g_BroadPhase.UpdateStatics(GetStaticRoomNumber(m_mesh));
+	g_Raycast.RebuildRoom(GetStaticRoomNumber(m_mesh));
 }
 
 float Static::GetScale() const
@@ -180,6 +188,8 @@ void Static::SetScale(float const& scale)
 {
 	m_mesh.scale = scale;
 	m_mesh.Dirty = true;
+	g_BroadPhase.UpdateStatics(GetStaticRoomNumber(m_mesh));
+	g_Raycast.RebuildRoom(GetStaticRoomNumber(m_mesh));
 }
 
 int Static::GetHP() const
@@ -212,6 +222,7 @@ void Static::SetRot(Rotation const& rot)
 	m_mesh.pos.Orientation.y = ANGLE(rot.y);
 	m_mesh.pos.Orientation.z = ANGLE(rot.z);
 	m_mesh.Dirty = true;
+	g_Raycast.RebuildRoom(GetStaticRoomNumber(m_mesh));
 }
 
 std::string Static::GetName() const
@@ -248,6 +259,8 @@ void Static::SetSlot(int slot)
 {
 	m_mesh.staticNumber = slot;
 	m_mesh.Dirty = true;
+	g_BroadPhase.UpdateStatics(GetStaticRoomNumber(m_mesh));
+	g_Raycast.RebuildRoom(GetStaticRoomNumber(m_mesh));
 }
 
 ScriptColor Static::GetColor() const
@@ -2,6 +2,7 @@
 #include "Scripting/Internal/TEN/Util/Util.h"
 
 #include "Game/collision/collide_room.h"
+#include "Game/collision/Raycast.h"
 #include "Game/control/los.h"
 #include "Game/Lara/lara.h"
 #include "Game/room.h"
@@ -18,6 +19,7 @@
 #include "Specific/configuration.h"
 #include "Specific/level.h"
 
+using namespace TEN::Collision::Raycast;
 using TEN::Renderer::g_Renderer;
 
 /// Utility functions for various calculations.
@@ -42,8 +44,9 @@ namespace TEN::Scripting::Util
 		auto vector1 = posB.ToGameVector();
 
 		auto vector = Vector3i::Zero;
-		return (LOS(&vector0, &vector1) &&
-			ObjectOnLOS2(&vector0, &vector1, &vector, nullptr) == NO_LOS_ITEM);
+		auto rayHit = RoomRayHit{};
+		return (LOS(&vector0, &vector1, &rayHit) &&
+			ObjectOnLOS2(&vector0, &vector1, &vector, nullptr, GAME_OBJECT_ID::ID_NO_OBJECT, &rayHit) == NO_LOS_ITEM);
 	}
 
 	///Calculate the distance between two positions.
@@ -188,7 +191,8 @@ namespace TEN::Scripting::Util
 	// 
 	static void PrintLog(const std::string& message, const LogLevel& level, TypeOrNil<bool> allowSpam)
 	{
-		TENLog(message, level, LogConfig::All, USE_IF_HAVE(bool, allowSpam, false));
+		// All script messages share this call site, so message text identifies their origin for rate limiting.
+		TENLogAt(LogCallSite(std::hash<std::string>{}(message)), message, level, LogConfig::All, USE_IF_HAVE(bool, allowSpam, false));
 	}
 
 	void Register(sol::state* state, sol::table& parent)
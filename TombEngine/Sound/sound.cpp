@@ -2,7 +2,10 @@
 #include "Sound/sound.h"
 
 #include <filesystem>
+#include <fstream>
+#include <iomanip>
 #include <regex>
+#include <sstream>
 #include <srtparser.h>
 
 #include "Game/camera.h"
@@ -41,6 +44,23 @@ const  std::string TRACKS_EXTENSIONS[] = {".wav", ".mp3", ".ogg"};
 const  std::string TRACKS_PATH = "Audio/";
 static std::string FullAudioDirectory;
 
+// Decoded PCM cache. Entries are keyed by hash of compressed sample data, so they stay valid across levels.
+const  std::string	SAMPLE_CACHE_PATH	 = "Cache/Samples/";
+constexpr auto		SAMPLE_CACHE_MAGIC	 = 0x504E4554u; // "TENP"
+constexpr auto		SAMPLE_CACHE_VERSION = 1;
+
+struct SampleCacheHeader
+{
+	unsigned int Magic		  = SAMPLE_CACHE_MAGIC;
+	int			 Version	  = SAMPLE_CACHE_VERSION;
+	int			 Frequency	  = 0;
+	int			 ChannelCount = 0;
+	int			 SampleCount  = 0;
+};
+
+static std::string FullSampleCacheDirectory;
+static bool		   IsSampleCacheEnabled = false;
+
 std::map<std::string, int> SoundTrackMap;
 std::unordered_map<int, SoundTrackInfo> SoundTracks;
 std::vector<SubtitleItem*> Subtitles;
@@ -69,87 +89,225 @@ void SetVolumeFX(int vol)
 	GlobalFXVolume = vol;
 }
 
-bool LoadSample(char* pointer, int compSize, int uncompSize, int index)
+// Decodes sample to float PCM. Thread-safe, so samples can be decoded on worker threads.
+static bool DecodeSampleData(const char* buffer, int compSize, int index, DecodedSample& sample)
+{
+	constexpr auto CHUNK_SIZE = 4096;
+
+	auto stream = BASS_StreamCreateFile(true, buffer, 0, compSize, BASS_STREAM_DECODE | SOUND_SAMPLE_FLAGS);
+	if (!stream)
+	{
+		TENLog("Error loading sample " + std::to_string(index), LogLevel::Error);
+		return false;
+	}
+
+	auto info = BASS_CHANNELINFO{};
+	BASS_ChannelGetInfo(stream, &info);
+	sample.Frequency = info.freq;
+	sample.ChannelCount = info.chans;
+
+	// Length may be estimate for some codecs, so data is read in chunks until stream ends.
+	auto length = BASS_ChannelGetLength(stream, BASS_POS_BYTE);
+	if (length != (QWORD)-1)
+		sample.Data.reserve(length / sizeof(float));
+
+	auto chunk = std::array<float, CHUNK_SIZE>{};
+	while (true)
+	{
+		auto readSize = BASS_ChannelGetData(stream, chunk.data(), sizeof(chunk));
+		if (readSize == (DWORD)-1 || readSize == 0)
+			break;
+
+		sample.Data.insert(sample.Data.end(), chunk.begin(), chunk.begin() + (readSize / sizeof(float)));
+	}
+
+	BASS_StreamFree(stream);
+	return true;
+}
+
+// Cuts off trailing silence from samples to prevent gaps in looped playback.
+// Tests 4 values at once, then finds exact end within last non-silent block.
+static void TrimSampleSilence(DecodedSample& sample)
+{
+	auto threshold = DirectX::XMVectorReplicate(SOUND_32BIT_SILENCE_LEVEL);
+	auto isSilent = [](float value) { return (value <= SOUND_32BIT_SILENCE_LEVEL && value >= -SOUND_32BIT_SILENCE_LEVEL); };
+
+	int count = (int)sample.Data.size();
+	while ((count % 4) != 0 && isSilent(sample.Data[count - 1]))
+		count--;
+
+	if ((count % 4) == 0)
+	{
+		while (count > 0)
+		{
+			auto values = DirectX::XMVectorAbs(DirectX::XMLoadFloat4((const DirectX::XMFLOAT4*)&sample.Data[count - 4]));
+			if (!DirectX::XMVector4LessOrEqual(values, threshold))
+				break;
+
+			count -= 4;
+		}
+
+		while (count > 0 && isSilent(sample.Data[count - 1]))
+			count--;
+	}
+
+	// Fully silent samples are kept as is.
+	if (count == 0)
+		return;
+
+	// Keep whole frames.
+	int channelCount = std::max(sample.ChannelCount, 1);
+	count += (channelCount - (count % channelCount)) % channelCount;
+
+	sample.Data.resize(count);
+	sample.Data.shrink_to_fit();
+}
+
+// FNV-1a hash of compressed sample data.
+static unsigned long long GetSampleHash(const char* buffer, int size)
+{
+	unsigned long long hash = 14695981039346656037ull;
+	for (int i = 0; i < size; i++)
+	{
+		hash ^= (unsigned char)buffer[i];
+		hash *= 1099511628211ull;
+	}
+
+	return hash;
+}
+
+static std::string GetSampleCachePath(const char* buffer, int compSize)
+{
+	auto stream = std::ostringstream();
+	stream << FullSampleCacheDirectory << std::hex << std::setw(16) << std::setfill('0') << GetSampleHash(buffer, compSize) << "_" << std::dec << compSize << ".pcm";
+	return stream.str();
+}
+
+static bool LoadCachedSample(const std::string& path, DecodedSample& sample)
+{
+	auto file = std::ifstream(path, std::ios::binary);
+	if (!file.is_open())
+		return false;
+
+	auto header = SampleCacheHeader{};
+	file.read((char*)&header, sizeof(header));
+	if (!file || header.Magic != SAMPLE_CACHE_MAGIC || header.Version != SAMPLE_CACHE_VERSION || header.SampleCount < 0)
+		return false;
+
+	sample.Frequency = header.Frequency;
+	sample.ChannelCount = header.ChannelCount;
+	sample.Data.resize(header.SampleCount);
+	file.read((char*)sample.Data.data(), header.SampleCount * sizeof(float));
+	sample.IsCached = (bool)file;
+
+	return sample.IsCached;
+}
+
+static void SaveCachedSample(const std::string& path, const DecodedSample& sample)
+{
+	auto header = SampleCacheHeader{};
+	header.Frequency = sample.Frequency;
+	header.ChannelCount = sample.ChannelCount;
+	header.SampleCount = (int)sample.Data.size();
+
+	// Written to temporary file first, so interrupted write never leaves partial cache entry.
+	auto tempPath = path + ".tmp";
+	{
+		auto file = std::ofstream(tempPath, std::ios::binary | std::ios::trunc);
+		if (!file.is_open())
+			return;
+
+		file.write((const char*)&header, sizeof(header));
+		file.write((const char*)sample.Data.data(), sample.Data.size() * sizeof(float));
+		if (!file)
+			return;
+	}
+
+	auto error = std::error_code{};
+	std::filesystem::rename(tempPath, path, error);
+	if (error)
+		std::filesystem::remove(tempPath, error);
+}
+
+bool DecodeSample(const char* buffer, int compSize, int index, DecodedSample& sample)
 {
 	if (index >= SOUND_MAX_SAMPLES)
 	{
 		TENLog("Sample index " + std::to_string(index) + " is larger than max. amount of samples", LogLevel::Warning);
-		return 0;
+		return false;
 	}
 
-	if (pointer == nullptr || compSize <= 0)
+	if (buffer == nullptr || compSize <= 0)
 	{
 		TENLog("Sample size or memory address is incorrect for index " + std::to_string(index), LogLevel::Warning);
-		return 0;
+		return false;
 	}
 
-	// Load and uncompress sample to 32-bit float format.
-	HSAMPLE sample = BASS_SampleLoad(true, pointer, 0, compSize, 1, SOUND_SAMPLE_FLAGS);
+	auto cachePath = IsSampleCacheEnabled ? GetSampleCachePath(buffer, compSize) : std::string();
+	if (IsSampleCacheEnabled && LoadCachedSample(cachePath, sample))
+		return true;
+
+	sample = DecodedSample{};
+	if (!DecodeSampleData(buffer, compSize, index, sample))
+		return false;
 
-	if (!sample)
+	if (sample.Frequency != 22050 || sample.ChannelCount != 1)
 	{
-		TENLog("Error loading sample " + std::to_string(index), LogLevel::Error);
+		TENLog("Wrong sample parameters, must be 22050 Hz Mono", LogLevel::Error);
 		return false;
 	}
 
+	TrimSampleSilence(sample);
+
+	if (IsSampleCacheEnabled)
+		SaveCachedSample(cachePath, sample);
+
+	return true;
+}
+
+bool CreateSample(const DecodedSample& sample, int index)
+{
 	// Paranoid (c) TeslaRus
 	// Try to free sample before allocating new one.
 	Sound_FreeSample(index);
 
-	BASS_SAMPLE info;
-	BASS_SampleGetInfo(sample, &info);
-	int finalLength = info.length + 44;	// uncompSize is invalid after 16->32 bit conversion
-
-	if (info.freq != 22050 || info.chans != 1)
+	if (sample.Data.empty())
 	{
-		TENLog("Wrong sample parameters, must be 22050 Hz Mono", LogLevel::Error);
+		TENLog("Sample " + std::to_string(index) + " has no data", LogLevel::Warning);
 		return false;
 	}
 
-	// Generate RIFF/WAV header to simplify loading sample data to stream. In case if RIFF/WAV header
-	// exists, stream could be completely created just by calling BASS_StreamCreateFile().
-	char* uncompBuffer = new char[finalLength];
-	ZeroMemory(uncompBuffer, finalLength);
-	memcpy(uncompBuffer, "RIFF\0\0\0\0WAVEfmt \20\0\0\0", 20);
-	memcpy(uncompBuffer + 36, "data\0\0\0\0", 8);
-
-	WAVEFORMATEX *wf = (WAVEFORMATEX*)(uncompBuffer + 20);
-
-	wf->wFormatTag = 3;
-	wf->nChannels = info.chans;
-	wf->wBitsPerSample = 32;
-	wf->nSamplesPerSec = info.freq;
-	wf->nBlockAlign = wf->nChannels * wf->wBitsPerSample / 8;
-	wf->nAvgBytesPerSec = wf->nSamplesPerSec * wf->nBlockAlign;
-
-	// Copy raw PCM data from temporary sample buffer to actual buffer which will be used by engine.
-	BASS_SampleGetData(sample, uncompBuffer + 44);
-	BASS_SampleFree(sample);
-
-	// Cut off trailing silence from samples to prevent gaps in looped playback
-	int cleanLength = info.length;
-	for (DWORD i = 4; i < info.length; i += 4)
+	// Decoded PCM is uploaded directly, so sample is created only once.
+	auto byteLength = (DWORD)(sample.Data.size() * sizeof(float));
+	auto handle = BASS_SampleCreate(byteLength, sample.Frequency, sample.ChannelCount, 65535, BASS_SAMPLE_FLOAT | BASS_SAMPLE_3D);
+	if (!handle || !BASS_SampleSetData(handle, sample.Data.data()))
 	{
-		float *currentSample = reinterpret_cast<float*>(uncompBuffer + finalLength - i);
-		if (*currentSample > SOUND_32BIT_SILENCE_LEVEL || *currentSample < -SOUND_32BIT_SILENCE_LEVEL)
-		{
-			int alignment = i % wf->nBlockAlign;
-			cleanLength -= (i - alignment);
-			break;
-		}
-	}
+		TENLog("Error creating sample " + std::to_string(index), LogLevel::Error);
 
-	// Put data size to header
-	*(DWORD*)(uncompBuffer + 4) = cleanLength + 44 - 8;
-	*(DWORD*)(uncompBuffer + 40) = cleanLength;
+		if (handle)
+			BASS_SampleFree(handle);
 
-	// Create actual sample
-	BASS_SamplePointer[index] = BASS_SampleLoad(true, uncompBuffer, 0, cleanLength + 44, 65535, SOUND_SAMPLE_FLAGS | BASS_SAMPLE_3D);
-	delete[] uncompBuffer;
+		return false;
+	}
 
+	BASS_SamplePointer[index] = handle;
 	return true;
 }
 
+bool LoadSample(char* pointer, int compSize, int uncompSize, int index)
+{
+	auto sample = DecodedSample{};
+	if (!DecodeSample(pointer, compSize, index, sample))
+		return false;
+
+	return CreateSample(sample, index);
+}
+
+void Sound_SetSampleCacheEnabled(bool value)
+{
+	IsSampleCacheEnabled = value;
+}
+
 bool SoundEffect(int effectID, Pose* position, SoundEnvironment condition, float pitchMultiplier, float gainMultiplier)
 {
 	if (!g_Configuration.EnableSound)
@@ -949,6 +1107,18 @@ void Sound_Init(const std::string& gameDirectory)
 	FullAudioDirectory = gameDirectory + TRACKS_PATH;
 	EnumerateLegacyTracks();
 
+	FullSampleCacheDirectory = gameDirectory + SAMPLE_CACHE_PATH;
+	if (IsSampleCacheEnabled)
+	{
+		auto error = std::error_code{};
+		std::filesystem::create_directories(FullSampleCacheDirectory, error);
+		if (error)
+		{
+			TENLog("Unable to create sample cache directory, sample cache is disabled.", LogLevel::Warning);
+			IsSampleCacheEnabled = false;
+		}
+	}
+
 	if (!g_Configuration.EnableSound)
 		return;
 	
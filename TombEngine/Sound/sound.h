@@ -31,6 +31,15 @@ constexpr auto SOUND_BGM_DAMP_COEFFICIENT    = 0.5f;
 constexpr auto SOUND_MIN_PARAM_MULTIPLIER    = 0.05f;
 constexpr auto SOUND_MAX_PARAM_MULTIPLIER    = 5.0f;
 
+// Sample decoded to float PCM, ready for sample creation.
+struct DecodedSample
+{
+	int				   Frequency	= 0;
+	int				   ChannelCount = 0;
+	std::vector<float> Data			= {};
+	bool			   IsCached		= false; // Loaded from decoded sample cache.
+};
+
 enum class SoundPauseMode
 {
 	Global,
@@ -154,6 +163,8 @@ extern std::unordered_map<int, SoundTrackInfo> SoundTracks;
 bool SoundEffect(int effectID, Pose* position, SoundEnvironment condition = SoundEnvironment::Land, float pitchMultiplier = 1.0f, float gainMultiplier = 1.0f);
 void StopSoundEffect(short effectID);
 bool LoadSample(char *buffer, int compSize, int uncompSize, int currentIndex);
+bool DecodeSample(const char* buffer, int compSize, int index, DecodedSample& sample);
+bool CreateSample(const DecodedSample& sample, int index);
 void FreeSamples();
 void StopAllSounds();
 void PauseAllSounds(SoundPauseMode mode);
@@ -181,6 +192,7 @@ void  SetVolumeTracks(int vol);
 void  SetVolumeFX(int vol);
 
 void  Sound_Init(const std::string& gameDirectory);
+void  Sound_SetSampleCacheEnabled(bool value);
 void  Sound_DeInit();
 bool  Sound_CheckBASSError(const char* message, bool verbose, ...);
 void  Sound_UpdateScene();
@@ -0,0 +1,570 @@
+#include "framework.h"
+#include "Specific/Benchmark.h"
+
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+#include "Game/animation.h"
+#include "Game/camera.h"
+#include "Game/collision/BroadPhase.h"
+#include "Game/collision/Raycast.h"
+#include "Game/collision/RoomIndex.h"
+#include "Game/effects/ParticlePool.h"
+#include "Game/items.h"
+#include "Game/savegame.h"
+#include "Math/Math.h"
+#include "Renderer/RendererLightGrid.h"
+#include "Renderer/RendererPose.h"
+#include "Renderer/RendererSorting.h"
+#include "Specific/clock.h"
+#include "Specific/JobSystem.h"
+#include "Specific/level.h"
+
+using namespace TEN::Collision::BroadPhase;
+using namespace TEN::Collision::Raycast;
+using namespace TEN::Collision::RoomIndex;
+using namespace TEN::Effects::ParticlePool;
+using namespace TEN::Input;
+using namespace TEN::Jobs;
+using namespace TEN::Math;
+using namespace TEN::Renderer::Lighting;
+using namespace TEN::Renderer::Pose;
+using namespace TEN::Renderer::Sorting;
+
+namespace TEN::Benchmark
+{
+	BenchmarkController g_Benchmark = {};
+
+	static const auto PROFILE_SECTION_NAMES = std::array<std::string, (int)ProfileSection::Count>
+	{
+		"Input",
+		"Scripts",
+		"Items",
+		"Effects",
+		"Player",
+		"Collision",
+		"Camera",
+		"Particles",
+		"BroadPhase",
+		"Think",
+		"CamColl",
+		"LuaGC",
+		"CbLookup",
+		"CbCached",
+		"Total"
+	};
+
+	static const auto PROFILE_COUNTER_NAMES = std::array<std::string, (int)ProfileCounter::Count>
+	{
+		"BroadPhaseQueries",
+		"BroadPhaseCandidates",
+		"BroadPhaseScanned",
+		"PathSearches",
+		"PathCacheHits",
+		"PathExpansions",
+		"PathPrefetches",
+		"CollisionProbes",
+		"CollisionCacheHits",
+		"CameraCandidates",
+		"CameraScanned",
+		"ParticleRecycles"
+	};
+
+	int SampleSet::GetCount() const
+	{
+		return (int)_samples.size();
+	}
+
+	double SampleSet::GetMean() const
+	{
+		if (_samples.empty())
+			return 0.0;
+
+		double sum = 0.0;
+		for (double sample : _samples)
+			sum += sample;
+
+		return (sum / _samples.size());
+	}
+
+	double SampleSet::GetPercentile(float percentile) const
+	{
+		if (_samples.empty())
+			return 0.0;
+
+		// Nearest-rank percentile on sorted copy to keep sample order intact.
+		auto sortedSamples = _samples;
+		int rank = (int)ceil((std::clamp(percentile, 0.0f, 100.0f) / 100.0f) * sortedSamples.size());
+		int index = std::clamp(rank - 1, 0, (int)sortedSamples.size() - 1);
+
+		std::nth_element(sortedSamples.begin(), sortedSamples.begin() + index, sortedSamples.end());
+		return sortedSamples[index];
+	}
+
+	void SampleSet::Add(double value)
+	{
+		_samples.push_back(value);
+	}
+
+	void SampleSet::Clear()
+	{
+		_samples.clear();
+	}
+
+	bool FrameProfiler::IsEnabled() const
+	{
+		return _isEnabled;
+	}
+
+	const SampleSet& FrameProfiler::GetSamples(ProfileSection section) const
+	{
+		return _samples[(int)section];
+	}
+
+	long long FrameProfiler::GetCount(ProfileCounter counter) const
+	{
+		return _counters[(int)counter];
+	}
+
+	void FrameProfiler::SetEnabled(bool value)
+	{
+		_isEnabled = value;
+	}
+
+	void FrameProfiler::BeginFrame()
+	{
+		if (!_isEnabled)
+			return;
+
+		_frameTimes.fill(0.0);
+		_frameStartTime = std::chrono::high_resolution_clock::now();
+	}
+
+	void FrameProfiler::EndFrame()
+	{
+		if (!_isEnabled)
+			return;
+
+		auto frameEndTime = std::chrono::high_resolution_clock::now();
+		_frameTimes[(int)ProfileSection::Total] = std::chrono::duration<double, std::milli>(frameEndTime - _frameStartTime).count();
+
+		for (int i = 0; i < (int)ProfileSection::Count; i++)
+			_samples[i].Add(_frameTimes[i]);
+	}
+
+	void FrameProfiler::AddTime(ProfileSection section, double timeInMs)
+	{
+		_frameTimes[(int)section] += timeInMs;
+	}
+
+	void FrameProfiler::AddCount(ProfileCounter counter, long long value)
+	{
+		_counters[(int)counter] += value;
+	}
+
+	void FrameProfiler::Clear()
+	{
+		_frameTimes.fill(0.0);
+		_counters.fill(0);
+
+		for (auto& sampleSet : _samples)
+			sampleSet.Clear();
+	}
+
+	std::string FrameProfiler::GetReport() const
+	{
+		auto stream = std::ostringstream();
+		stream << std::fixed << std::setprecision(3);
+		stream << "Frames: " << _samples[(int)ProfileSection::Total].GetCount() << std::endl;
+		stream << std::left << std::setw(12) << "Section" << std::right <<
+			std::setw(10) << "mean" << std::setw(10) << "p50" << std::setw(10) << "p95" << std::setw(10) << "p99" << " (ms)" << std::endl;
+
+		for (int i = 0; i < (int)ProfileSection::Count; i++)
+		{
+			const auto& sampleSet = _samples[i];
+			stream << std::left << std::setw(12) << PROFILE_SECTION_NAMES[i] << std::right <<
+				std::setw(10) << sampleSet.GetMean() <<
+				std::setw(10) << sampleSet.GetPercentile(50.0f) <<
+				std::setw(10) << sampleSet.GetPercentile(95.0f) <<
+				std::setw(10) << sampleSet.GetPercentile(99.0f) << std::endl;
+		}
+
+		int frameCount = std::max(_samples[(int)ProfileSection::Total].GetCount(), 1);
+		stream << std::endl << std::left << std::setw(24) << "Counter" << std::right <<
+			std::setw(14) << "total" << std::setw(14) << "per frame" << std::endl;
+
+		for (int i = 0; i < (int)ProfileCounter::Count; i++)
+		{
+			stream << std::left << std::setw(24) << PROFILE_COUNTER_NAMES[i] << std::right <<
+				std::setw(14) << _counters[i] <<
+				std::setw(14) << ((double)_counters[i] / frameCount) << std::endl;
+		}
+
+		return stream.str();
+	}
+
+	ScopedProfile::ScopedProfile(ProfileSection section)
+	{
+		_section = section;
+
+		if (g_Benchmark.Profiler.IsEnabled())
+			_startTime = std::chrono::high_resolution_clock::now();
+	}
+
+	ScopedProfile::~ScopedProfile()
+	{
+		if (!g_Benchmark.Profiler.IsEnabled())
+			return;
+
+		auto endTime = std::chrono::high_resolution_clock::now();
+		g_Benchmark.Profiler.AddTime(_section, std::chrono::duration<double, std::milli>(endTime - _startTime).count());
+	}
+
+	int InputRecording::GetFrameCount() const
+	{
+		return (int)_frames.size();
+	}
+
+	bool InputRecording::IsEmpty() const
+	{
+		return _frames.empty();
+	}
+
+	bool InputRecording::Load(const std::string& path)
+	{
+		auto file = std::ifstream(path, std::ios::binary);
+		if (!file.is_open())
+		{
+			TENLog("Unable to open input recording " + path, LogLevel::Error);
+			return false;
+		}
+
+		int magic = 0;
+		int actionCount = 0;
+		int axisCount = 0;
+		int frameCount = 0;
+		file.read((char*)&magic, sizeof(int));
+		file.read((char*)&actionCount, sizeof(int));
+		file.read((char*)&axisCount, sizeof(int));
+		file.read((char*)&frameCount, sizeof(int));
+
+		if (magic != FILE_MAGIC || actionCount != (int)In::Count || axisCount != (int)InputAxis::Count || frameCount < 0)
+		{
+			TENLog("Input recording " + path + " is invalid or was recorded with a different action layout.", LogLevel::Error);
+			return false;
+		}
+
+		_frames.resize(frameCount);
+		file.read((char*)_frames.data(), frameCount * sizeof(InputFrame));
+		_playbackFrame = 0;
+
+		TENLog("Loaded input recording with " + std::to_string(frameCount) + " frames.", LogLevel::Info);
+		return file.good();
+	}
+
+	bool InputRecording::Save(const std::string& path) const
+	{
+		auto file = std::ofstream(path, std::ios::binary | std::ios::trunc);
+		if (!file.is_open())
+		{
+			TENLog("Unable to write input recording " + path, LogLevel::Error);
+			return false;
+		}
+
+		int magic = FILE_MAGIC;
+		int actionCount = (int)In::Count;
+		int axisCount = (int)InputAxis::Count;
+		int frameCount = (int)_frames.size();
+		file.write((char*)&magic, sizeof(int));
+		file.write((char*)&actionCount, sizeof(int));
+		file.write((char*)&axisCount, sizeof(int));
+		file.write((char*)&frameCount, sizeof(int));
+		file.write((char*)_frames.data(), frameCount * sizeof(InputFrame));
+
+		TENLog("Saved input recording with " + std::to_string(frameCount) + " frames.", LogLevel::Info);
+		return file.good();
+	}
+
+	void InputRecording::Record()
+	{
+		auto& frame = _frames.emplace_back();
+
+		for (const auto& action : ActionMap)
+			frame.Actions[(int)action.GetID()] = action.GetValue();
+
+		for (int i = 0; i < (int)InputAxis::Count; i++)
+			frame.Axes[i] = AxisMap[i];
+	}
+
+	void InputRecording::Playback()
+	{
+		// Once recording is exhausted, keep feeding neutral input.
+		auto frame = (_playbackFrame < _frames.size()) ? _frames[_playbackFrame] : InputFrame{};
+		_playbackFrame++;
+
+		for (auto& action : ActionMap)
+			action.Update(frame.Actions[(int)action.GetID()]);
+
+		for (int i = 0; i < (int)InputAxis::Count; i++)
+			AxisMap[i] = frame.Axes[i];
+	}
+
+	void InputRecording::Rewind()
+	{
+		_playbackFrame = 0;
+	}
+
+	const BenchmarkSettings& BenchmarkController::GetSettings() const
+	{
+		return _settings;
+	}
+
+	bool BenchmarkController::IsHeadless() const
+	{
+		return _settings.IsHeadless;
+	}
+
+	bool BenchmarkController::IsRecording() const
+	{
+		return !_settings.RecordPath.empty();
+	}
+
+	bool BenchmarkController::IsPlayingBack() const
+	{
+		return !_settings.PlaybackPath.empty();
+	}
+
+	bool BenchmarkController::TestFinished() const
+	{
+		if (!_settings.IsHeadless)
+			return false;
+
+		return (_frameCount >= _settings.FrameCount);
+	}
+
+	void BenchmarkController::Initialize(const BenchmarkSettings& settings)
+	{
+		_settings = settings;
+		_frameCount = 0;
+		_stateHash = 0;
+		_recording = {};
+		_losReport.clear();
+		_frameReport.clear();
+		_isJobCheckPass = false;
+		_parallelStateHash = 0;
+		_parallelReport.clear();
+
+		if (IsPlayingBack() && !_recording.Load(_settings.PlaybackPath))
+			_settings.PlaybackPath.clear();
+
+		g_SortedFaceRecording.SetEnabled(!_settings.SortDumpPath.empty());
+
+		// Headless runs are deterministic: fixed seed and fixed step regardless of wall time.
+		if (_settings.IsHeadless)
+		{
+			if (_settings.FrameCount <= 0)
+				_settings.FrameCount = IsPlayingBack() ? _recording.GetFrameCount() : FPS * 60;
+
+			Random::SetSeed(_settings.Seed);
+			Profiler.SetEnabled(true);
+			g_Raycast.SetRecording(_settings.IsLosBenchmark);
+
+			TENLog("Headless benchmark: " + std::to_string(_settings.FrameCount) + " frames, seed " + std::to_string(_settings.Seed) + ".", LogLevel::Info);
+		}
+	}
+
+	void BenchmarkController::Deinitialize()
+	{
+		if (IsRecording())
+			_recording.Save(_settings.RecordPath);
+
+		if (g_SortedFaceRecording.IsEnabled())
+			g_SortedFaceRecording.Save(_settings.SortDumpPath);
+
+		if (_settings.IsHeadless)
+		{
+			if (_settings.IsLosBenchmark)
+				_losReport = ReplayRecordedRays();
+
+			// Animation frames of last played level, so memory and sampling cost are measured on real data.
+			_frameReport = RunFrameSamplingBenchmark();
+
+			Report();
+		}
+	}
+
+	// Restarts headless run from same seed and input with every job on game thread.
+	// Returns false if job check isn't requested or second pass already ran.
+	bool BenchmarkController::BeginJobCheckPass()
+	{
+		if (!_settings.IsHeadless || !_settings.IsJobCheck || _isJobCheckPass)
+			return false;
+
+		_isJobCheckPass = true;
+		_parallelStateHash = _stateHash;
+		_parallelReport = Profiler.GetReport();
+		int workerCount = g_Jobs.GetWorkerCount();
+
+		_stateHash = 0;
+		_frameCount = 0;
+		_recording.Rewind();
+		Profiler.Clear();
+		Random::SetSeed(_settings.Seed);
+
+		// LOS replay uses queries of first pass only.
+		g_Raycast.SetRecording(false);
+
+		g_Jobs.Initialize(0);
+		TENLog("Job check: repeating run without job workers (first pass used " + std::to_string(workerCount) + ").", LogLevel::Info);
+		return true;
+	}
+
+	void BenchmarkController::UpdateInput(ItemInfo* item)
+	{
+		if (IsPlayingBack())
+		{
+			_recording.Playback();
+		}
+		else if (!_settings.IsHeadless)
+		{
+			// TODO: To allow cutscene skipping later, don't clear Deselect action.
+			UpdateInputActions(item, true);
+		}
+
+		// Job check pass replays same input, so it's recorded only once.
+		if (IsRecording() && !_isJobCheckPass)
+			_recording.Record();
+	}
+
+	void BenchmarkController::BeginFrame()
+	{
+		Profiler.BeginFrame();
+	}
+
+	void BenchmarkController::EndFrame()
+	{
+		Profiler.EndFrame();
+		_frameCount++;
+
+		if (_settings.IsHeadless)
+			UpdateStateHash();
+	}
+
+	void BenchmarkController::Report() const
+	{
+		auto stream = std::ostringstream();
+		stream << "State hash: 0x" << std::hex << std::setw(8) << std::setfill('0') << _stateHash << std::endl;
+
+		auto report = Profiler.GetReport() + stream.str();
+		if (_isJobCheckPass)
+		{
+			auto checkStream = std::ostringstream();
+			checkStream << "State hash with job workers: 0x" << std::hex << std::setw(8) << std::setfill('0') << _parallelStateHash << std::endl;
+			checkStream << "Job check: " << ((_parallelStateHash == _stateHash) ? "passed" : "FAILED, gameplay depends on job scheduling") << std::endl;
+
+			report = "With job workers:\n" + _parallelReport + "Without job workers:\n" + report + checkStream.str();
+		}
+
+		report += _losReport + _frameReport;
+		TENLog("Benchmark results:\n" + report, LogLevel::Info);
+
+		if (_settings.ReportPath.empty())
+			return;
+
+		auto file = std::ofstream(_settings.ReportPath, std::ios::trunc);
+		if (!file.is_open())
+		{
+			TENLog("Unable to write benchmark report " + _settings.ReportPath, LogLevel::Error);
+			return;
+		}
+
+		file << report;
+	}
+
+	// Folds gameplay-relevant item state into running hash. Two runs of same recording and seed
+	// must produce same hash, e.g. with job system enabled and disabled.
+	void BenchmarkController::UpdateStateHash()
+	{
+		auto hashCombine = [this](int value)
+		{
+			_stateHash ^= (unsigned int)value + 0x9E3779B9 + (_stateHash << 6) + (_stateHash >> 2);
+		};
+
+		for (const auto& item : g_Level.Items)
+		{
+			if (!item.Active && !item.IsLara())
+				continue;
+
+			hashCombine(item.Index);
+			hashCombine(item.Pose.Position.x);
+			hashCombine(item.Pose.Position.y);
+			hashCombine(item.Pose.Position.z);
+			hashCombine(item.Pose.Orientation.y);
+			hashCombine(item.RoomNumber);
+			hashCombine(item.HitPoints);
+			hashCombine(item.Animation.AnimNumber);
+			hashCombine(item.Animation.FrameNumber);
+		}
+	}
+
+	struct MicroBenchmark
+	{
+		std::string Name  = {}; // Command line name.
+		std::string Title = {}; // Report title.
+		std::function<std::string(const BenchmarkSettings& settings)> Run = nullptr;
+	};
+
+	// Micro-benchmarks live next to modules they measure and need no window or level.
+	static const auto MICRO_BENCHMARKS = std::vector<MicroBenchmark>
+	{
+		{ "particle", "Particle", [](const BenchmarkSettings& settings) { return RunParticleBenchmark(); } },
+		{ "room", "Room query", [](const BenchmarkSettings& settings) { return RunRoomBenchmark(); } },
+		{ "pose", "Pose", [](const BenchmarkSettings& settings) { return RunPoseBenchmark(); } },
+		{ "sort", "Sorting", [](const BenchmarkSettings& settings) { return RunSortBenchmark(settings.SortDumpPath); } },
+		{ "light", "Light grid", [](const BenchmarkSettings& settings) { return RunLightBenchmark(); } },
+		{ "camera", "Camera collision", [](const BenchmarkSettings& settings) { return RunCameraBenchmark(); } },
+		{ "broadphase", "Broad phase", [](const BenchmarkSettings& settings) { return RunBroadPhaseBenchmark(); } },
+		{ "hub", "Hub compression", [](const BenchmarkSettings& settings) { return RunHubCompressionBenchmark(); } }
+	};
+
+	bool RunMicroBenchmark(const BenchmarkSettings& settings)
+	{
+		bool runAll = (settings.MicroBenchmark == "all");
+
+		auto report = std::string();
+		for (const auto& benchmark : MICRO_BENCHMARKS)
+		{
+			if (!runAll && benchmark.Name != settings.MicroBenchmark)
+				continue;
+
+			auto result = benchmark.Run(settings);
+			TENLog(benchmark.Title + " benchmark results:\n" + result, LogLevel::Info);
+
+			report += benchmark.Title + " benchmark\n" + result + "\n";
+		}
+
+		if (report.empty())
+		{
+			auto names = std::string("all");
+			for (const auto& benchmark : MICRO_BENCHMARKS)
+				names += ", " + benchmark.Name;
+
+			TENLog("Unknown micro-benchmark " + settings.MicroBenchmark + ". Available: " + names + ".", LogLevel::Error);
+			return false;
+		}
+
+		if (settings.ReportPath.empty())
+			return true;
+
+		auto file = std::ofstream(settings.ReportPath, std::ios::trunc);
+		if (!file.is_open())
+		{
+			TENLog("Unable to write benchmark report " + settings.ReportPath, LogLevel::Error);
+			return false;
+		}
+
+		file << report;
+		return true;
+	}
+}
@@ -0,0 +1,196 @@
+#pragma once
+#include <chrono>
+
+#include "Specific/Input/Input.h"
+
+namespace TEN::Benchmark
+{
+	enum class ProfileSection
+	{
+		Input,
+		Scripts,
+		Items,
+		Effects,
+		Player,
+		Collision,
+		Camera,
+		Particles,
+		BroadPhase,		   // Nested in other sections.
+		Think,			   // Nested in Items.
+		CameraCollision,   // Nested in Camera.
+		GarbageCollection, // Nested in Scripts.
+		CallbacksLookup,   // Nested in Scripts.
+		CallbacksCached,   // Nested in Scripts.
+		Total,
+
+		Count
+	};
+
+	enum class ProfileCounter
+	{
+		BroadPhaseQueries,
+		BroadPhaseCandidates,
+		BroadPhaseScanned,
+		PathSearches,
+		PathCacheHits,
+		PathExpansions,
+		PathPrefetches,
+		CollisionProbes,
+		CollisionCacheHits,
+		CameraCandidates,
+		CameraScanned,
+		ParticleRecycles,
+
+		Count
+	};
+
+	class SampleSet
+	{
+	private:
+		// Members
+		std::vector<double> _samples = {};
+
+	public:
+		// Getters
+		int	   GetCount() const;
+		double GetMean() const;
+		double GetPercentile(float percentile) const;
+
+		// Utilities
+		void Add(double value);
+		void Clear();
+	};
+
+	class FrameProfiler
+	{
+	private:
+		// Members
+		bool											  _isEnabled	  = false;
+		std::chrono::high_resolution_clock::time_point	  _frameStartTime = {};
+		std::array<double, (int)ProfileSection::Count>	  _frameTimes	  = {}; // Accumulated time in milliseconds.
+		std::array<SampleSet, (int)ProfileSection::Count> _samples		  = {};
+		std::array<long long, (int)ProfileCounter::Count> _counters		  = {};
+
+	public:
+		// Getters
+		bool			 IsEnabled() const;
+		const SampleSet& GetSamples(ProfileSection section) const;
+		long long		 GetCount(ProfileCounter counter) const;
+
+		// Setters
+		void SetEnabled(bool value);
+
+		// Utilities
+		void BeginFrame();
+		void EndFrame();
+		void AddTime(ProfileSection section, double timeInMs);
+		void AddCount(ProfileCounter counter, long long value);
+		void Clear();
+
+		std::string GetReport() const;
+	};
+
+	class ScopedProfile
+	{
+	private:
+		// Members
+		ProfileSection _section = ProfileSection::Total;
+		std::chrono::high_resolution_clock::time_point _startTime = {};
+
+	public:
+		// Constructors, destructors
+		ScopedProfile(ProfileSection section);
+		~ScopedProfile();
+	};
+
+	struct InputFrame
+	{
+		std::array<float, (int)TEN::Input::In::Count>			 Actions = {};
+		std::array<Vector2, (int)TEN::Input::InputAxis::Count> Axes	 = {};
+	};
+
+	class InputRecording
+	{
+	private:
+		// Constants
+		static constexpr auto FILE_MAGIC = 0x52504E49; // "INPR"
+
+		// Members
+		std::vector<InputFrame> _frames		   = {};
+		unsigned int			_playbackFrame = 0;
+
+	public:
+		// Getters
+		int	 GetFrameCount() const;
+		bool IsEmpty() const;
+
+		// Utilities
+		bool Load(const std::string& path);
+		bool Save(const std::string& path) const;
+		void Record();
+		void Playback();
+		void Rewind();
+	};
+
+	struct BenchmarkSettings
+	{
+		bool		 IsHeadless		= false;
+		bool		 IsLosBenchmark = false; // Record LOS queries of headless run and replay them at end.
+		bool		 IsJobCheck		= false; // Replay headless run with jobs on game thread and compare state hashes.
+		int			 FrameCount		= 0;
+		int			 CallbackCount	= 0; // Synthetic script callback dispatches per frame.
+		unsigned int Seed			= 0;
+
+		std::string MicroBenchmark = {}; // Name of micro-benchmark to run instead of game, or "all".
+		std::string PlaybackPath   = {};
+		std::string RecordPath	   = {};
+		std::string ReportPath	   = {};
+		std::string SortDumpPath   = {}; // Sorted face keys recorded by game run and replayed by sorting benchmark.
+	};
+
+	class BenchmarkController
+	{
+	private:
+		// Members
+		BenchmarkSettings _settings	   = {};
+		InputRecording	  _recording   = {};
+		int				  _frameCount  = 0;
+		unsigned int	  _stateHash   = 0; // Running hash of item state, equal across runs with equal gameplay outcome.
+		std::string		  _losReport   = {};
+		std::string		  _frameReport = {};
+
+		// Job check: first pass runs with job workers, second pass with all jobs on game thread.
+		bool		 _isJobCheckPass	 = false;
+		unsigned int _parallelStateHash	 = 0;
+		std::string	 _parallelReport	 = {};
+
+	public:
+		FrameProfiler Profiler = {};
+
+		// Getters
+		const BenchmarkSettings& GetSettings() const;
+		bool					 IsHeadless() const;
+		bool					 IsRecording() const;
+		bool					 IsPlayingBack() const;
+
+		// Inquirers
+		bool TestFinished() const;
+
+		// Utilities
+		void Initialize(const BenchmarkSettings& settings);
+		void Deinitialize();
+		bool BeginJobCheckPass();
+		void UpdateInput(ItemInfo* item);
+		void BeginFrame();
+		void EndFrame();
+		void Report() const;
+
+	private:
+		// Helpers
+		void UpdateStateHash();
+	};
+
+	extern BenchmarkController g_Benchmark;
+
+	bool RunMicroBenchmark(const BenchmarkSettings& settings);
+}
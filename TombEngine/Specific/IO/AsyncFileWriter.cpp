@@ -0,0 +1,149 @@
+#include "framework.h"
+#include "Specific/IO/AsyncFileWriter.h"
+
+#include <chrono>
+
+static bool WriteFileAtomic(const std::string& path, const std::vector<char>& data)
+{
+	auto tempPath = path + ".tmp";
+
+	auto fileHandle = CreateFileA(tempPath.c_str(), GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (fileHandle == INVALID_HANDLE_VALUE)
+		return false;
+
+	DWORD writtenSize = 0;
+	bool isSuccess = WriteFile(fileHandle, data.data(), (DWORD)data.size(), &writtenSize, nullptr) && (writtenSize == data.size());
+
+	// Data must reach disk before rename, otherwise crash may leave renamed but empty file.
+	isSuccess = isSuccess && FlushFileBuffers(fileHandle);
+	CloseHandle(fileHandle);
+
+	if (isSuccess)
+		isSuccess = MoveFileExA(tempPath.c_str(), path.c_str(), MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH);
+
+	if (!isSuccess)
+		DeleteFileA(tempPath.c_str());
+
+	return isSuccess;
+}
+
+AsyncFileWriter::~AsyncFileWriter()
+{
+	Deinitialize();
+}
+
+bool AsyncFileWriter::IsBusy() const
+{
+	auto lock = std::lock_guard<std::mutex>(_mutex);
+	return (_isWriting || _pendingJob.has_value());
+}
+
+bool AsyncFileWriter::IsPending(const std::string& path) const
+{
+	auto lock = std::lock_guard<std::mutex>(_mutex);
+	return ((_isWriting && _activePath == path) || (_pendingJob.has_value() && _pendingJob->Path == path));
+}
+
+void AsyncFileWriter::Submit(const std::string& path, int tag, EncodeFunction&& encode)
+{
+	auto lock = std::unique_lock<std::mutex>(_mutex);
+
+	if (!_thread.joinable())
+	{
+		_isStopping = false;
+		_thread = std::thread(&AsyncFileWriter::WorkerLoop, this);
+	}
+
+	// Only one queued job. If it targets other file, wait until writer picks it up.
+	_idleCondition.wait(lock, [&]() { return (!_pendingJob.has_value() || _pendingJob->Path == path); });
+
+	if (_pendingJob.has_value())
+		TENLog("Replacing queued write to " + path + " with newer data.", LogLevel::Info);
+
+	_pendingJob = WriteJob{ path, tag, std::move(encode) };
+	lock.unlock();
+
+	_wakeCondition.notify_one();
+}
+
+void AsyncFileWriter::Flush()
+{
+	auto lock = std::unique_lock<std::mutex>(_mutex);
+	_idleCondition.wait(lock, [this]() { return (!_isWriting && !_pendingJob.has_value()); });
+}
+
+void AsyncFileWriter::Deinitialize()
+{
+	if (!_thread.joinable())
+		return;
+
+	Flush();
+
+	{
+		auto lock = std::lock_guard<std::mutex>(_mutex);
+		_isStopping = true;
+	}
+
+	_wakeCondition.notify_one();
+	_thread.join();
+}
+
+std::vector<AsyncFileWriteResult> AsyncFileWriter::TakeResults()
+{
+	auto lock = std::lock_guard<std::mutex>(_mutex);
+
+	auto results = std::vector<AsyncFileWriteResult>{};
+	std::swap(results, _results);
+	return results;
+}
+
+void AsyncFileWriter::WorkerLoop()
+{
+	while (true)
+	{
+		auto job = WriteJob{};
+		{
+			auto lock = std::unique_lock<std::mutex>(_mutex);
+			_wakeCondition.wait(lock, [this]() { return (_isStopping || _pendingJob.has_value()); });
+
+			if (!_pendingJob.has_value())
+				return;
+
+			job = std::move(*_pendingJob);
+			_pendingJob.reset();
+			_activePath = job.Path;
+			_isWriting = true;
+		}
+
+		// Queue slot is free again.
+		_idleCondition.notify_all();
+
+		auto startTime = std::chrono::high_resolution_clock::now();
+
+		auto result = AsyncFileWriteResult{};
+		result.Path = job.Path;
+		result.Tag = job.Tag;
+
+		try
+		{
+			auto data = job.Encode();
+			result.Size = data.size();
+			result.IsSuccess = WriteFileAtomic(job.Path, data);
+		}
+		catch (const std::exception& ex)
+		{
+			TENLog("Error encoding " + job.Path + ": " + ex.what(), LogLevel::Error);
+		}
+
+		result.Time = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - startTime).count();
+
+		{
+			auto lock = std::lock_guard<std::mutex>(_mutex);
+			_results.push_back(std::move(result));
+			_activePath.clear();
+			_isWriting = false;
+		}
+
+		_idleCondition.notify_all();
+	}
+}
@@ -0,0 +1,66 @@
+#pragma once
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+
+struct AsyncFileWriteResult
+{
+	std::string Path	  = {};
+	int			Tag		  = 0;
+	bool		IsSuccess = false;
+	size_t		Size	  = 0;
+	double		Time	  = 0.0; // Encoding and writing time in milliseconds.
+};
+
+// Encodes and writes files on background thread.
+// Data is written to temporary file, flushed to disk and renamed over target, so interrupted write never leaves partial file.
+// Double-buffered: one write may be in flight while next one is queued. Newer queued write to same path replaces older one.
+class AsyncFileWriter
+{
+public:
+	using EncodeFunction = std::function<std::vector<char>()>;
+
+private:
+	struct WriteJob
+	{
+		std::string	   Path	  = {};
+		int			   Tag	  = 0;
+		EncodeFunction Encode = nullptr; // Runs on writer thread. Must only use data it owns.
+	};
+
+	// Members
+	std::thread				_thread			= {};
+	mutable std::mutex		_mutex			= {};
+	std::condition_variable _wakeCondition	= {};
+	std::condition_variable _idleCondition	= {};
+
+	std::optional<WriteJob>			  _pendingJob = std::nullopt;
+	std::string						  _activePath = {};
+	bool							  _isWriting  = false;
+	bool							  _isStopping = false;
+	std::vector<AsyncFileWriteResult> _results	  = {};
+
+public:
+	// Constructors, destructors
+	AsyncFileWriter() = default;
+	AsyncFileWriter(const AsyncFileWriter& other) = delete;
+	~AsyncFileWriter();
+
+	// Inquirers
+	bool IsBusy() const;
+	bool IsPending(const std::string& path) const;
+
+	// Utilities
+	void Submit(const std::string& path, int tag, EncodeFunction&& encode);
+	void Flush();
+	void Deinitialize();
+
+	std::vector<AsyncFileWriteResult> TakeResults();
+
+private:
+	// Helpers
+	void WorkerLoop();
+};
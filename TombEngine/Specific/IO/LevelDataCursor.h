@@ -0,0 +1,182 @@
+#pragma once
+
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <d3d11.h>
+#include <SimpleMath.h>
+
+#include "Specific/memory/MappableVector.h"
+
+using namespace DirectX;
+using namespace DirectX::SimpleMath;
+using namespace TEN::Memory;
+
+// Position and element alignment of array read by cursor.
+struct LevelArrayRecord
+{
+	size_t Offset	 = 0;
+	size_t Alignment = 0;
+};
+
+// Sequential reader over a block of decompressed level data.
+// Each level section is parsed through its own cursor, so sections can be decompressed independently.
+class LevelDataCursor
+{
+private:
+	// Members
+	const char* _begin		  = nullptr;
+	const char* _ptr		  = nullptr;
+	const char* _end		  = nullptr;
+	bool		_isPersistent = false; // Underlying memory outlives parsing (memory-mapped level).
+
+	std::vector<LevelArrayRecord>* _arrayLog = nullptr; // Arrays read, recorded for level conversion.
+
+public:
+	// Constructors
+	LevelDataCursor() = default;
+	LevelDataCursor(const char* data, size_t size, bool isPersistent = false) :
+		_begin(data),
+		_ptr(data),
+		_end(data + size),
+		_isPersistent(isPersistent)
+	{
+	}
+
+	// Getters
+	const char* GetPointer() const { return _ptr; }
+	size_t		GetPosition() const { return (size_t)(_ptr - _begin); }
+	size_t		GetRemainingSize() const { return (size_t)(_end - _ptr); }
+
+	// Setters
+	void SetArrayLog(std::vector<LevelArrayRecord>* log) { _arrayLog = log; }
+
+	// Inquirers
+	bool IsEnd() const { return (_ptr >= _end); }
+
+	// Utilities
+	void Skip(size_t count)
+	{
+		Validate(count);
+		_ptr += count;
+	}
+
+	void ReadBytes(void* dest, size_t count)
+	{
+		Validate(count);
+		std::memcpy(dest, _ptr, count);
+		_ptr += count;
+	}
+
+	// Views persistent data in place, otherwise copies it.
+	// Arrays in mapped level are padded to alignment of their elements relative to page-aligned section start.
+	template <typename T>
+	void ReadArray(MappableVector<T>& dest, size_t count)
+	{
+		if (_arrayLog != nullptr)
+			_arrayLog->push_back(LevelArrayRecord{ GetPosition(), alignof(T) });
+
+		if (_isPersistent)
+			Skip(GetAlignmentPadding(GetPosition(), alignof(T)));
+
+		size_t byteCount = count * sizeof(T);
+		Validate(byteCount);
+
+		if (_isPersistent)
+		{
+			assertion(((uintptr_t)_ptr % alignof(T)) == 0, "Mapped level array is misaligned.");
+			dest.SetView((const T*)_ptr, count);
+		}
+		else
+		{
+			dest.Assign((const T*)_ptr, count);
+		}
+
+		_ptr += byteCount;
+	}
+
+	unsigned char  ReadUInt8()	{ return Read<unsigned char>(); }
+	short		   ReadInt16()	{ return Read<short>(); }
+	unsigned short ReadUInt16() { return Read<unsigned short>(); }
+	int			   ReadInt32()	{ return Read<int>(); }
+	float		   ReadFloat()	{ return Read<float>(); }
+	bool		   ReadBool()	{ return bool(ReadUInt8()); }
+
+	Vector2 ReadVector2()
+	{
+		// NOTE: Braces are necessary to ensure correct value init order.
+		return Vector2{ ReadFloat(), ReadFloat() };
+	}
+
+	Vector3 ReadVector3()
+	{
+		return Vector3{ ReadFloat(), ReadFloat(), ReadFloat() };
+	}
+
+	Vector4 ReadVector4()
+	{
+		return Vector4{ ReadFloat(), ReadFloat(), ReadFloat(), ReadFloat() };
+	}
+
+	long long ReadLEB128(bool sign)
+	{
+		long long result = 0;
+		int currentShift = 0;
+
+		unsigned char currentByte;
+		do
+		{
+			currentByte = ReadUInt8();
+
+			result |= (long long)(currentByte & 0x7F) << currentShift;
+			currentShift += 7;
+		}
+		while ((currentByte & 0x80) != 0);
+
+		// Sign extend.
+		if (sign)
+		{
+			int shift = 64 - currentShift;
+			if (shift > 0)
+				result = (long long)(result << shift) >> shift;
+		}
+
+		return result;
+	}
+
+	std::string ReadString()
+	{
+		auto numBytes = ReadLEB128(false);
+		if (numBytes <= 0)
+			return std::string();
+
+		Validate((size_t)numBytes);
+		auto result = std::string(_ptr, _ptr + numBytes);
+		_ptr += numBytes;
+		return result;
+	}
+
+	static size_t GetAlignmentPadding(size_t offset, size_t alignment)
+	{
+		return ((alignment - (offset % alignment)) % alignment);
+	}
+
+private:
+	// Helpers
+	template <typename T>
+	T Read()
+	{
+		Validate(sizeof(T));
+
+		T value;
+		std::memcpy(&value, _ptr, sizeof(T));
+		_ptr += sizeof(T);
+		return value;
+	}
+
+	void Validate(size_t count) const
+	{
+		if (count > GetRemainingSize())
+			throw std::runtime_error("Level data is truncated or corrupted.");
+	}
+};
@@ -0,0 +1,139 @@
+#include "framework.h"
+#include "Specific/IO/LevelWriter.h"
+
+#include <fstream>
+#include <zlib.h>
+
+#include "Specific/level.h"
+
+constexpr auto LEVEL_FILE_HEADER_SIZE	 = 12;
+constexpr auto MAPPED_SECTION_ALIGNMENT = 4096;
+
+static void WriteSectionedLevel(std::ofstream& file, const char* data, const std::vector<LevelSectionRange>& sections)
+{
+	auto headers = std::vector<LevelSectionHeader>{};
+	auto payloads = std::vector<std::vector<char>>{};
+
+	for (const auto& range : sections)
+	{
+		const auto* sectionData = (const Bytef*)(data + range.Offset);
+
+		auto payload = std::vector<char>(compressBound((uLong)range.Size));
+		auto compressedSize = (uLongf)payload.size();
+		bool isCompressed = (compress2((Bytef*)payload.data(), &compressedSize, sectionData, (uLong)range.Size, Z_BEST_COMPRESSION) == Z_OK) &&
+							(compressedSize < range.Size);
+
+		// Store section uncompressed if compression doesn't pay off (e.g. empty section).
+		if (isCompressed)
+		{
+			payload.resize(compressedSize);
+		}
+		else
+		{
+			payload.assign((const char*)sectionData, (const char*)sectionData + range.Size);
+		}
+
+		auto header = LevelSectionHeader{};
+		header.Type = range.Type;
+		header.UncompressedSize = (int)range.Size;
+		header.CompressedSize = isCompressed ? (int)payload.size() : 0;
+
+		headers.push_back(header);
+		payloads.push_back(std::move(payload));
+	}
+
+	int sectionCount = (int)headers.size();
+	file.write((const char*)&sectionCount, sizeof(int));
+	file.write((const char*)headers.data(), headers.size() * sizeof(LevelSectionHeader));
+
+	for (const auto& payload : payloads)
+		file.write(payload.data(), payload.size());
+}
+
+static std::vector<char> GetMappedSectionPayload(const char* data, const LevelSectionRange& range, const std::vector<LevelArrayRecord>& arrays)
+{
+	auto payload = std::vector<char>{};
+	payload.reserve(range.Size);
+
+	// Pad each array start to alignment of its elements, matching padding skipped by LevelDataCursor::ReadArray().
+	size_t offset = range.Offset;
+	for (const auto& array : arrays)
+	{
+		if (array.Offset < range.Offset || array.Offset >= (range.Offset + range.Size))
+			continue;
+
+		payload.insert(payload.end(), data + offset, data + array.Offset);
+		payload.resize(payload.size() + LevelDataCursor::GetAlignmentPadding(payload.size(), array.Alignment), '\0');
+		offset = array.Offset;
+	}
+
+	payload.insert(payload.end(), data + offset, data + range.Offset + range.Size);
+	return payload;
+}
+
+static void WriteMappedLevel(std::ofstream& file, const char* data, const std::vector<LevelSectionRange>& sections, const std::vector<LevelArrayRecord>& arrays)
+{
+	auto alignOffset = [](long long offset)
+	{
+		return (((offset + MAPPED_SECTION_ALIGNMENT - 1) / MAPPED_SECTION_ALIGNMENT) * MAPPED_SECTION_ALIGNMENT);
+	};
+
+	int sectionCount = (int)sections.size();
+
+	auto payloads = std::vector<std::vector<char>>{};
+	for (const auto& range : sections)
+		payloads.push_back(GetMappedSectionPayload(data, range, arrays));
+
+	// Sections follow table at page-aligned offsets, so padding within section aligns arrays in mapping too.
+	auto headers = std::vector<LevelMappedSectionHeader>{};
+	long long offset = LEVEL_FILE_HEADER_SIZE + sizeof(int) + (sectionCount * sizeof(LevelMappedSectionHeader));
+	for (int i = 0; i < sectionCount; i++)
+	{
+		offset = alignOffset(offset);
+
+		auto header = LevelMappedSectionHeader{};
+		header.Type = sections[i].Type;
+		header.Size = (int)payloads[i].size();
+		header.Offset = offset;
+		headers.push_back(header);
+
+		offset += payloads[i].size();
+	}
+
+	file.write((const char*)&sectionCount, sizeof(int));
+	file.write((const char*)headers.data(), headers.size() * sizeof(LevelMappedSectionHeader));
+
+	for (int i = 0; i < sectionCount; i++)
+	{
+		auto padding = std::vector<char>((size_t)(headers[i].Offset - (long long)file.tellp()), '\0');
+		file.write(padding.data(), padding.size());
+		file.write(payloads[i].data(), payloads[i].size());
+	}
+}
+
+bool WriteLevelFile(const std::string& path, char format, const char* fileHeader, const char* data,
+					const std::vector<LevelSectionRange>& sections, const std::vector<LevelArrayRecord>& arrays)
+{
+	if (format != LEVEL_HEADER_SECTIONED && format != LEVEL_HEADER_MAPPED)
+		return false;
+
+	auto file = std::ofstream(path, std::ios::binary | std::ios::trunc);
+	if (!file.is_open())
+		return false;
+
+	auto header = std::array<char, LEVEL_FILE_HEADER_SIZE>{};
+	std::copy(fileHeader, fileHeader + LEVEL_FILE_HEADER_SIZE, header.begin());
+	header[3] = format;
+	file.write(header.data(), header.size());
+
+	if (format == LEVEL_HEADER_MAPPED)
+	{
+		WriteMappedLevel(file, data, sections, arrays);
+	}
+	else
+	{
+		WriteSectionedLevel(file, data, sections);
+	}
+
+	return file.good();
+}
@@ -0,0 +1,20 @@
+#pragma once
+#include <string>
+#include <vector>
+
+#include "Specific/IO/LevelDataCursor.h"
+
+// Byte range of one level section inside decompressed level data.
+struct LevelSectionRange
+{
+	int	   Type	  = 0;
+	size_t Offset = 0;
+	size_t Size	  = 0;
+};
+
+// Writes decompressed level data as sectioned or memory-mapped level file.
+// Level compiler doesn't emit these formats yet, so legacy levels are converted with it to build test levels.
+// File header holds 12 bytes of header, version and system hash; fourth header byte is replaced by format.
+// Arrays recorded while parsing data are padded to their alignment in mapped format, since mapped level views them in place.
+bool WriteLevelFile(const std::string& path, char format, const char* fileHeader, const char* data,
+					const std::vector<LevelSectionRange>& sections, const std::vector<LevelArrayRecord>& arrays);
@@ -0,0 +1,72 @@
+#include "framework.h"
+#include "Specific/IO/MappedFile.h"
+
+MappedFile::~MappedFile()
+{
+	Close();
+}
+
+const char* MappedFile::GetData() const
+{
+	return _data;
+}
+
+size_t MappedFile::GetSize() const
+{
+	return _size;
+}
+
+bool MappedFile::IsOpen() const
+{
+	return (_data != nullptr);
+}
+
+bool MappedFile::Open(const std::string& path)
+{
+	Close();
+
+	_fileHandle = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+	if (_fileHandle == INVALID_HANDLE_VALUE)
+		return false;
+
+	auto fileSize = LARGE_INTEGER{};
+	if (!GetFileSizeEx(_fileHandle, &fileSize) || fileSize.QuadPart == 0)
+	{
+		Close();
+		return false;
+	}
+
+	_mappingHandle = CreateFileMappingA(_fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	if (_mappingHandle == nullptr)
+	{
+		Close();
+		return false;
+	}
+
+	_data = (const char*)MapViewOfFile(_mappingHandle, FILE_MAP_READ, 0, 0, 0);
+	if (_data == nullptr)
+	{
+		Close();
+		return false;
+	}
+
+	_size = (size_t)fileSize.QuadPart;
+	return true;
+}
+
+void MappedFile::Close()
+{
+	if (_data != nullptr)
+		UnmapViewOfFile(_data);
+
+	if (_mappingHandle != nullptr)
+		CloseHandle(_mappingHandle);
+
+	if (_fileHandle != INVALID_HANDLE_VALUE)
+		CloseHandle(_fileHandle);
+
+	_data = nullptr;
+	_mappingHandle = nullptr;
+	_fileHandle = INVALID_HANDLE_VALUE;
+	_size = 0;
+}
@@ -0,0 +1,33 @@
+#pragma once
+#include <string>
+
+// Read-only memory mapping of a whole file.
+class MappedFile
+{
+private:
+	// Members
+	HANDLE		_fileHandle	   = INVALID_HANDLE_VALUE;
+	HANDLE		_mappingHandle = nullptr;
+	const char* _data		   = nullptr;
+	size_t		_size		   = 0;
+
+public:
+	// Constructors, destructors
+	MappedFile() = default;
+	MappedFile(const MappedFile& other) = delete;
+	~MappedFile();
+
+	// Getters
+	const char* GetData() const;
+	size_t		GetSize() const;
+
+	// Inquirers
+	bool IsOpen() const;
+
+	// Utilities
+	bool Open(const std::string& path);
+	void Close();
+
+	// Operators
+	MappedFile& operator =(const MappedFile& other) = delete;
+};
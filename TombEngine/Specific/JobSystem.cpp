@@ -0,0 +1,108 @@
+#include "framework.h"
+#include "Specific/JobSystem.h"
+
+namespace TEN::Jobs
+{
+	JobSystem g_Jobs = {};
+
+	int JobSystem::GetWorkerCount() const
+	{
+		return (int)_workers.size();
+	}
+
+	// Negative worker count uses all hardware threads except main one. Zero runs every job on calling thread.
+	void JobSystem::Initialize(int workerCount)
+	{
+		Deinitialize();
+
+		if (workerCount < 0)
+			workerCount = std::max((int)std::thread::hardware_concurrency() - 1, 0);
+
+		_isStopping = false;
+		for (int i = 0; i < workerCount; i++)
+			_workers.push_back(std::thread(&JobSystem::WorkerLoop, this));
+
+		TENLog("Job system: " + std::to_string(workerCount) + " worker threads.", LogLevel::Info);
+	}
+
+	void JobSystem::Deinitialize()
+	{
+		if (_workers.empty())
+			return;
+
+		{
+			auto lock = std::lock_guard<std::mutex>(_mutex);
+			_isStopping = true;
+		}
+		_startCondition.notify_all();
+
+		for (auto& worker : _workers)
+			worker.join();
+
+		_workers.clear();
+	}
+
+	// Runs job for every index in [0, count) and returns once all are complete.
+	// Calling thread participates, so small batches don't wait on worker wake-up.
+	void JobSystem::ParallelFor(int count, const std::function<void(int index)>& job)
+	{
+		if (count <= 0)
+			return;
+
+		if (_workers.empty() || count == 1)
+		{
+			for (int i = 0; i < count; i++)
+				job(i);
+
+			return;
+		}
+
+		{
+			auto lock = std::lock_guard<std::mutex>(_mutex);
+			_job = &job;
+			_jobCount = count;
+			_nextJobIndex = 0;
+			_busyWorkers = (int)_workers.size();
+			_generation++;
+		}
+		_startCondition.notify_all();
+
+		RunJobs();
+
+		auto lock = std::unique_lock<std::mutex>(_mutex);
+		_finishCondition.wait(lock, [this]() { return (_busyWorkers == 0); });
+		_job = nullptr;
+	}
+
+	void JobSystem::WorkerLoop()
+	{
+		unsigned int generation = 0;
+
+		while (true)
+		{
+			{
+				auto lock = std::unique_lock<std::mutex>(_mutex);
+				_startCondition.wait(lock, [&]() { return (_isStopping || _generation != generation); });
+
+				if (_isStopping)
+					return;
+
+				generation = _generation;
+			}
+
+			RunJobs();
+
+			{
+				auto lock = std::lock_guard<std::mutex>(_mutex);
+				_busyWorkers--;
+			}
+			_finishCondition.notify_one();
+		}
+	}
+
+	void JobSystem::RunJobs()
+	{
+		for (int i = _nextJobIndex++; i < _jobCount; i = _nextJobIndex++)
+			(*_job)(i);
+	}
+}
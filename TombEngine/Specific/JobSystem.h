@@ -0,0 +1,46 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+namespace TEN::Jobs
+{
+	// Persistent worker pool for data-parallel per-frame work.
+	// Jobs must only read shared world state and write to their own output slot, so that
+	// results don't depend on worker count or scheduling order.
+	class JobSystem
+	{
+	private:
+		// Members
+		std::vector<std::thread> _workers = {};
+
+		std::mutex				_mutex			 = {};
+		std::condition_variable _startCondition	 = {};
+		std::condition_variable _finishCondition = {};
+
+		const std::function<void(int)>* _job		  = nullptr;
+		int								_jobCount	  = 0;
+		std::atomic<int>				_nextJobIndex = 0;
+		int								_busyWorkers  = 0;
+		unsigned int					_generation	  = 0;
+		bool							_isStopping	  = false;
+
+	public:
+		// Getters
+		int GetWorkerCount() const;
+
+		// Utilities
+		void Initialize(int workerCount);
+		void Deinitialize();
+		void ParallelFor(int count, const std::function<void(int index)>& job);
+
+	private:
+		// Helpers
+		void WorkerLoop();
+		void RunJobs();
+	};
+
+	extern JobSystem g_Jobs;
+}
@@ -1,24 +1,70 @@
 #include "framework.h"
 #include "Specific/clock.h"
 
+// Sleeping may overshoot by up to one timer period, so wake up early and spin for remaining time.
+constexpr auto SYNC_SPIN_TIME = 0.002; // In seconds.
+
 // Globals
 LARGE_INTEGER PerformanceCount = {};
 double		  LdFreq		   = 0.0;
 double		  LdSync		   = 0.0;
+HANDLE		  SyncTimer		   = nullptr;
 
-int Sync()
+static double GetSyncCounter()
 {
 	auto ct = LARGE_INTEGER{};
 	QueryPerformanceCounter(&ct);
 
 	double dCounter = (double)ct.LowPart + (double)ct.HighPart * (double)0xffffffff;
-	dCounter /= LdFreq;
+	return (dCounter / LdFreq);
+}
+
+static void SleepFor(double seconds)
+{
+	if (seconds <= 0.0)
+		return;
+
+	// Without high resolution timer, sleep granularity is too coarse, so caller spins instead.
+	if (SyncTimer == nullptr)
+		return;
+
+	// Relative due time in 100 ns units.
+	auto dueTime = LARGE_INTEGER{};
+	dueTime.QuadPart = -(LONGLONG)(seconds * 10000000.0);
+
+	if (SetWaitableTimer(SyncTimer, &dueTime, 0, nullptr, nullptr, FALSE))
+		WaitForSingleObject(SyncTimer, INFINITE);
+}
+
+int Sync()
+{
+	double dCounter = GetSyncCounter();
 
 	long gameFrames = (long)dCounter - (long)LdSync;
 	LdSync = dCounter;
 	return gameFrames;
 }
 
+// Part of current tick elapsed by last Sync() call, used to interpolate rendered frames.
+float GetSyncTickFraction()
+{
+	return float(LdSync - floor(LdSync));
+}
+
+// Waits until tickCount more ticks have started since last Sync() call, sleeping for most of that time.
+void WaitForTicks(int tickCount)
+{
+	double targetCounter = floor(LdSync) + tickCount;
+	double spinTicks = SYNC_SPIN_TIME * 60.0;
+
+	double remainingTicks = targetCounter - GetSyncCounter();
+	if (remainingTicks > spinTicks)
+		SleepFor((remainingTicks - spinTicks) / 60.0);
+
+	while (GetSyncCounter() < targetCounter)
+		YieldProcessor();
+}
+
 bool TimeReset()
 {
 	auto fq = LARGE_INTEGER{};
@@ -37,10 +83,24 @@ bool TimeInit()
 
 	LdFreq = (double)fq.LowPart + ((double)fq.HighPart * (double)0xffffffff);
 	LdFreq /= 60.0;
+
+	// High resolution timers are only available since Windows 10 1803.
+	if (SyncTimer == nullptr)
+		SyncTimer = CreateWaitableTimerExW(nullptr, nullptr, CREATE_WAITABLE_TIMER_HIGH_RESOLUTION, TIMER_ALL_ACCESS);
+
 	TimeReset();
 	return true;
 }
 
+void TimeDeinit()
+{
+	if (SyncTimer != nullptr)
+	{
+		CloseHandle(SyncTimer);
+		SyncTimer = nullptr;
+	}
+}
+
 GameTime GetGameTime(int ticks)
 {
 	auto gameTime = GameTime{};
@@ -17,9 +17,12 @@ struct GameTime
 	int Seconds = 0;
 };
 
-int	 Sync();
-bool TimeInit();
-bool TimeReset();
+int	  Sync();
+float GetSyncTickFraction();
+void  WaitForTicks(int tickCount);
+bool  TimeInit();
+bool  TimeReset();
+void  TimeDeinit();
 
 GameTime GetGameTime(int ticks);
 
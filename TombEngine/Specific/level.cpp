@@ -1,15 +1,21 @@
 #include "framework.h"
 #include "Specific/level.h"
 
+#include <chrono>
+#include <filesystem>
 #include <process.h>
 #include <zlib.h>
 
 #include "Game/animation.h"
 #include "Game/animation.h"
+#include "Game/collision/BroadPhase.h"
+#include "Game/collision/Raycast.h"
+#include "Game/collision/RoomIndex.h"
 #include "Game/control/box.h"
 #include "Game/control/control.h"
 #include "Game/control/volume.h"
 #include "Game/control/lot.h"
+#include "Game/control/Pathfinding.h"
 #include "Game/items.h"
 #include "Game/Lara/lara.h"
 #include "Game/Lara/lara_initialise.h"
@@ -26,13 +32,22 @@
 #include "Scripting/Include/ScriptInterfaceGame.h"
 #include "Scripting/Include/ScriptInterfaceLevel.h"
 #include "Sound/sound.h"
+#include "Specific/Benchmark.h"
 #include "Specific/Input/Input.h"
+#include "Specific/IO/LevelWriter.h"
+#include "Specific/JobSystem.h"
 #include "Specific/trutils.h"
 
 using TEN::Renderer::g_Renderer;
+using namespace TEN::Benchmark;
+using namespace TEN::Collision::BroadPhase;
+using namespace TEN::Collision::Raycast;
+using namespace TEN::Collision::RoomIndex;
+using namespace TEN::Control::Pathfinding;
 
 using namespace TEN::Entities::Doors;
 using namespace TEN::Input;
+using namespace TEN::Jobs;
 using namespace TEN::Utils;
 
 const std::vector<GAME_OBJECT_ID> BRIDGE_OBJECT_IDS =
@@ -79,127 +94,16 @@ const std::vector<GAME_OBJECT_ID> BRIDGE_OBJECT_IDS =
 	ID_BRIDGE_CUSTOM
 };
 
-char* LevelDataPtr;
 std::vector<int> MoveablesIds;
 std::vector<int> StaticObjectsIds;
 std::vector<int> SpriteSequencesIds;
 LEVEL g_Level;
 
-unsigned char ReadUInt8()
-{
-	unsigned char value = *(unsigned char*)LevelDataPtr;
-	LevelDataPtr += 1;
-	return value;
-}
-
-short ReadInt16()
-{
-	short value = *(short*)LevelDataPtr;
-	LevelDataPtr += 2;
-	return value;
-}
-
-unsigned short ReadUInt16()
-{
-	unsigned short value = *(unsigned short*)LevelDataPtr;
-	LevelDataPtr += 2;
-	return value;
-}
-
-int ReadInt32()
-{
-	int value = *(int*)LevelDataPtr;
-	LevelDataPtr += 4;
-	return value;
-}
-
-float ReadFloat()
-{
-	float value = *(float*)LevelDataPtr;
-	LevelDataPtr += 4;
-	return value;
-}
-
-Vector2 ReadVector2()
-{
-	Vector2 value;
-	value.x = ReadFloat();
-	value.y = ReadFloat();
-	return value;
-}
-
-Vector3 ReadVector3()
-{
-	Vector3 value;
-	value.x = ReadFloat();
-	value.y = ReadFloat();
-	value.z = ReadFloat();
-	return value;
-}
-
-Vector4 ReadVector4()
-{
-	Vector4 value;
-	value.x = ReadFloat();
-	value.y = ReadFloat();
-	value.z = ReadFloat();
-	value.w = ReadFloat();
-	return value;
-}
-
-bool ReadBool()
-{
-	return bool(ReadUInt8());
-}
-
-void ReadBytes(void* dest, int count)
-{
-	memcpy(dest, LevelDataPtr, count);
-	LevelDataPtr += count;
-}
-
-long long ReadLEB128(bool sign)
-{
-	long long result = 0;
-	int currentShift = 0;
-
-	unsigned char currentByte;
-	do
-	{
-		currentByte = ReadUInt8();
-
-		result |= (long long)(currentByte & 0x7F) << currentShift;
-		currentShift += 7;
-	} while ((currentByte & 0x80) != 0);
-
-	if (sign) // Sign extend
-	{
-		int shift = 64 - currentShift;
-		if (shift > 0)
-			result = (long long)(result << shift) >> shift;
-	}
-
-	return result;
-}
-
-std::string ReadString()
-{
-	auto numBytes = ReadLEB128(false);
-
-	if (numBytes <= 0)
-		return std::string();
-	else
-	{
-		auto newPtr = LevelDataPtr + numBytes;
-		auto result = std::string(LevelDataPtr, newPtr);
-		LevelDataPtr = newPtr;
-		return result;
-	}
-}
+char LevelConversionFormat = '\0';
 
-void LoadItems()
+void LoadItems(LevelDataCursor& cursor)
 {
-	g_Level.NumItems = ReadInt32();
+	g_Level.NumItems = cursor.ReadInt32();
 	TENLog("Num items: " + std::to_string(g_Level.NumItems), LogLevel::Info);
 
 	if (g_Level.NumItems == 0)
@@ -214,18 +118,18 @@ void LoadItems()
 			auto* item = &g_Level.Items[i];
 
 			item->Data = ItemData{};
-			item->ObjectNumber = from_underlying(ReadInt16());
-			item->RoomNumber = ReadInt16();
-			item->Pose.Position.x = ReadInt32();
-			item->Pose.Position.y = ReadInt32();
-			item->Pose.Position.z = ReadInt32();
-			item->Pose.Orientation.y = ReadInt16();
-			item->Pose.Orientation.x = ReadInt16();
-			item->Pose.Orientation.z = ReadInt16();
-			item->Model.Color = ReadVector4();
-			item->TriggerFlags = ReadInt16();
-			item->Flags = ReadInt16();
-			item->Name = ReadString();
+			item->ObjectNumber = from_underlying(cursor.ReadInt16());
+			item->RoomNumber = cursor.ReadInt16();
+			item->Pose.Position.x = cursor.ReadInt32();
+			item->Pose.Position.y = cursor.ReadInt32();
+			item->Pose.Position.z = cursor.ReadInt32();
+			item->Pose.Orientation.y = cursor.ReadInt16();
+			item->Pose.Orientation.x = cursor.ReadInt16();
+			item->Pose.Orientation.z = cursor.ReadInt16();
+			item->Model.Color = cursor.ReadVector4();
+			item->TriggerFlags = cursor.ReadInt16();
+			item->Flags = cursor.ReadInt16();
+			item->Name = cursor.ReadString();
 			
 			g_GameScriptEntities->AddName(item->Name, (short)i);
 			g_GameScriptEntities->TryAddColliding((short)i);
@@ -260,12 +164,12 @@ void LoadItems()
 	}
 }
 
-void LoadObjects()
+void LoadObjects(LevelDataCursor& cursor)
 {
 	Objects.Initialize();
 	std::memset(StaticObjects, 0, sizeof(StaticInfo) * MAX_STATICS);
 
-	int numMeshes = ReadInt32();
+	int numMeshes = cursor.ReadInt32();
 	TENLog("Num meshes: " + std::to_string(numMeshes), LogLevel::Info);
 
 	g_Level.Meshes.reserve(numMeshes);
@@ -273,49 +177,42 @@ void LoadObjects()
 	{
 		MESH mesh;
 
-		mesh.lightMode = (LightMode)ReadUInt8();
-
-		mesh.sphere.Center.x = ReadFloat();
-		mesh.sphere.Center.y = ReadFloat();
-		mesh.sphere.Center.z = ReadFloat();
-		mesh.sphere.Radius = ReadFloat();
+		mesh.lightMode = (LightMode)cursor.ReadUInt8();
 
-		int numVertices = ReadInt32();
+		mesh.sphere.Center.x = cursor.ReadFloat();
+		mesh.sphere.Center.y = cursor.ReadFloat();
+		mesh.sphere.Center.z = cursor.ReadFloat();
+		mesh.sphere.Radius = cursor.ReadFloat();
 
-		mesh.positions.resize(numVertices);
-		ReadBytes(mesh.positions.data(), 12 * numVertices);
+		int numVertices = cursor.ReadInt32();
 
-		mesh.colors.resize(numVertices);
-		ReadBytes(mesh.colors.data(), 12 * numVertices);
-
-		mesh.effects.resize(numVertices);
-		ReadBytes(mesh.effects.data(), 12 * numVertices);
-
-		mesh.bones.resize(numVertices);
-		ReadBytes(mesh.bones.data(), 4 * numVertices);
+		cursor.ReadArray(mesh.positions, numVertices);
+		cursor.ReadArray(mesh.colors, numVertices);
+		cursor.ReadArray(mesh.effects, numVertices);
+		cursor.ReadArray(mesh.bones, numVertices);
 		
-		int numBuckets = ReadInt32();
+		int numBuckets = cursor.ReadInt32();
 		mesh.buckets.reserve(numBuckets);
 		for (int j = 0; j < numBuckets; j++)
 		{
 			BUCKET bucket;
 
-			bucket.texture = ReadInt32();
-			bucket.blendMode = (BlendMode)ReadUInt8();
-			bucket.animated = ReadBool();
+			bucket.texture = cursor.ReadInt32();
+			bucket.blendMode = (BlendMode)cursor.ReadUInt8();
+			bucket.animated = cursor.ReadBool();
 			bucket.numQuads = 0;
 			bucket.numTriangles = 0;
 
-			int numPolygons = ReadInt32();
+			int numPolygons = cursor.ReadInt32();
 			bucket.polygons.reserve(numPolygons);
 			for (int k = 0; k < numPolygons; k++)
 			{
 				POLYGON poly;
 
-				poly.shape = ReadInt32();
-				poly.animatedSequence = ReadInt32();
-				poly.animatedFrame = ReadInt32();
-				poly.shineStrength = ReadFloat();
+				poly.shape = cursor.ReadInt32();
+				poly.animatedSequence = cursor.ReadInt32();
+				poly.animatedFrame = cursor.ReadInt32();
+				poly.shineStrength = cursor.ReadFloat();
 				int count = (poly.shape == 0 ? 4 : 3);
 				poly.indices.resize(count);
 				poly.textureCoordinates.resize(count);
@@ -324,15 +221,15 @@ void LoadObjects()
 				poly.binormals.resize(count);
 				
 				for (int n = 0; n < count; n++)
-					poly.indices[n] = ReadInt32();
+					poly.indices[n] = cursor.ReadInt32();
 				for (int n = 0; n < count; n++)
-					poly.textureCoordinates[n] = ReadVector2();
+					poly.textureCoordinates[n] = cursor.ReadVector2();
 				for (int n = 0; n < count; n++)
-					poly.normals[n] = ReadVector3();
+					poly.normals[n] = cursor.ReadVector3();
 				for (int n = 0; n < count; n++)
-					poly.tangents[n] = ReadVector3();
+					poly.tangents[n] = cursor.ReadVector3();
 				for (int n = 0; n < count; n++)
-					poly.binormals[n] = ReadVector3();
+					poly.binormals[n] = cursor.ReadVector3();
 
 				bucket.polygons.push_back(poly);
 
@@ -348,7 +245,7 @@ void LoadObjects()
 		g_Level.Meshes.push_back(mesh);
 	}
 
-	int numAnimations = ReadInt32();
+	int numAnimations = cursor.ReadInt32();
 	TENLog("Num animations: " + std::to_string(numAnimations), LogLevel::Info);
 
 	g_Level.Anims.resize(numAnimations);
@@ -356,79 +253,127 @@ void LoadObjects()
 	{
 		auto* anim = &g_Level.Anims[i];
 
-		anim->FramePtr = ReadInt32();
-		anim->Interpolation = ReadInt32();
-		anim->ActiveState = ReadInt32();
-		anim->VelocityStart = ReadVector3();
-		anim->VelocityEnd = ReadVector3();
-		anim->frameBase = ReadInt32();
-		anim->frameEnd = ReadInt32();
-		anim->JumpAnimNum = ReadInt32();
-		anim->JumpFrameNum = ReadInt32();
-		anim->NumStateDispatches = ReadInt32();
-		anim->StateDispatchIndex = ReadInt32();
-		anim->NumCommands = ReadInt32();
-		anim->CommandIndex = ReadInt32();
+		anim->FramePtr = cursor.ReadInt32();
+		anim->Interpolation = cursor.ReadInt32();
+		anim->ActiveState = cursor.ReadInt32();
+		anim->VelocityStart = cursor.ReadVector3();
+		anim->VelocityEnd = cursor.ReadVector3();
+		anim->frameBase = cursor.ReadInt32();
+		anim->frameEnd = cursor.ReadInt32();
+		anim->JumpAnimNum = cursor.ReadInt32();
+		anim->JumpFrameNum = cursor.ReadInt32();
+		anim->NumStateDispatches = cursor.ReadInt32();
+		anim->StateDispatchIndex = cursor.ReadInt32();
+		anim->NumCommands = cursor.ReadInt32();
+		anim->CommandIndex = cursor.ReadInt32();
 	}
 
-	int numChanges = ReadInt32();
+	int numChanges = cursor.ReadInt32();
 	g_Level.Changes.resize(numChanges);
-	ReadBytes(g_Level.Changes.data(), sizeof(StateDispatchData) * numChanges);
+	cursor.ReadBytes(g_Level.Changes.data(), sizeof(StateDispatchData) * numChanges);
 
-	int numRanges = ReadInt32();
+	int numRanges = cursor.ReadInt32();
 	g_Level.Ranges.resize(numRanges);
-	ReadBytes(g_Level.Ranges.data(), sizeof(StateDispatchRangeData) * numRanges);
+	cursor.ReadBytes(g_Level.Ranges.data(), sizeof(StateDispatchRangeData) * numRanges);
 
-	int numCommands = ReadInt32();
+	int numCommands = cursor.ReadInt32();
 	g_Level.Commands.resize(numCommands);
-	ReadBytes(g_Level.Commands.data(), sizeof(short) * numCommands);
+	cursor.ReadBytes(g_Level.Commands.data(), sizeof(short) * numCommands);
 
-	int numBones = ReadInt32();
+	int numBones = cursor.ReadInt32();
 	g_Level.Bones.resize(numBones);
-	ReadBytes(g_Level.Bones.data(), 4 * numBones);
+	cursor.ReadBytes(g_Level.Bones.data(), 4 * numBones);
 
-	int numFrames = ReadInt32();
+	int numFrames = cursor.ReadInt32();
 	g_Level.Frames.resize(numFrames);
+	g_Level.FrameOrientations.clear();
+	g_Level.SourceFrameOrientations.clear();
+	g_Level.FrameOrientationError = 0.0f;
+
+	// Benchmark compares packed sampling against original unquantized layout.
+	bool keepSourceOrients = g_Benchmark.IsHeadless();
+	if (keepSourceOrients)
+		g_Level.SourceFrameOrientations.resize(numFrames);
+
+	// Bone orientations are quantized into one contiguous buffer. Frames with same pose as previous frame share its data.
+	auto packedOrients = std::vector<PackedQuaternion>{};
+	int numBoneOrientations = 0;
+	int numReducedFrames = 0;
+
 	for (int i = 0; i < numFrames; i++)
 	{
 		auto* frame = &g_Level.Frames[i];
 
-		frame->BoundingBox.X1 = ReadInt16();
-		frame->BoundingBox.X2 = ReadInt16();
-		frame->BoundingBox.Y1 = ReadInt16();
-		frame->BoundingBox.Y2 = ReadInt16();
-		frame->BoundingBox.Z1 = ReadInt16();
-		frame->BoundingBox.Z2 = ReadInt16();
+		frame->BoundingBox.X1 = cursor.ReadInt16();
+		frame->BoundingBox.X2 = cursor.ReadInt16();
+		frame->BoundingBox.Y1 = cursor.ReadInt16();
+		frame->BoundingBox.Y2 = cursor.ReadInt16();
+		frame->BoundingBox.Z1 = cursor.ReadInt16();
+		frame->BoundingBox.Z2 = cursor.ReadInt16();
 
 		// NOTE: Braces are necessary to ensure correct value init order.
-		frame->Offset = Vector3{ (float)ReadInt16(), (float)ReadInt16(), (float)ReadInt16() };
+		frame->Offset = Vector3{ (float)cursor.ReadInt16(), (float)cursor.ReadInt16(), (float)cursor.ReadInt16() };
 
-		int numAngles = ReadInt16();
-		frame->BoneOrientations.resize(numAngles);
+		int numAngles = cursor.ReadInt16();
+		packedOrients.resize(numAngles);
 		for (int j = 0; j < numAngles; j++)
 		{
-			auto* q = &frame->BoneOrientations[j];
-			q->x = ReadFloat();
-			q->y = ReadFloat();
-			q->z = ReadFloat();
-			q->w = ReadFloat();
+			auto q = Quaternion::Identity;
+			q.x = cursor.ReadFloat();
+			q.y = cursor.ReadFloat();
+			q.z = cursor.ReadFloat();
+			q.w = cursor.ReadFloat();
+			packedOrients[j] = PackedQuaternion(q);
+
+			q.Normalize();
+			float dot = std::abs(q.Dot(packedOrients[j].ToQuaternion()));
+			g_Level.FrameOrientationError = std::max(g_Level.FrameOrientationError, 2.0f * std::acos(std::min(dot, 1.0f)));
+
+			if (keepSourceOrients)
+				g_Level.SourceFrameOrientations[i].push_back(q);
 		}
+
+		numBoneOrientations += numAngles;
+		frame->BoneCount = numAngles;
+
+		if (i > 0)
+		{
+			const auto& prevFrame = g_Level.Frames[i - 1];
+			if (prevFrame.BoneCount == numAngles &&
+				std::equal(packedOrients.begin(), packedOrients.end(), g_Level.FrameOrientations.begin() + prevFrame.BoneOrientationIndex))
+			{
+				frame->BoneOrientationIndex = prevFrame.BoneOrientationIndex;
+				numReducedFrames++;
+				continue;
+			}
+		}
+
+		frame->BoneOrientationIndex = (int)g_Level.FrameOrientations.size();
+		g_Level.FrameOrientations.insert(g_Level.FrameOrientations.end(), packedOrients.begin(), packedOrients.end());
 	}
 
-	int numModels = ReadInt32();
+	g_Level.FrameOrientations.shrink_to_fit();
+	TENLog(
+		"Num frames: " + std::to_string(numFrames) + " (" + std::to_string(numReducedFrames) + " reduced), bone orientations: " +
+		std::to_string((g_Level.FrameOrientations.size() * sizeof(PackedQuaternion)) / 1024) + " KB packed, " +
+		std::to_string((numBoneOrientations * sizeof(Quaternion)) / 1024) + " KB unpacked, max quantization error: " +
+		std::to_string(RAD_TO_DEG(g_Level.FrameOrientationError)) + " degrees.",
+		LogLevel::Info);
+
+	int numModels = cursor.ReadInt32();
 	TENLog("Num models: " + std::to_string(numModels), LogLevel::Info);
 
 	for (int i = 0; i < numModels; i++)
 	{
-		int objNum = ReadInt32();
+		int objNum = cursor.ReadInt32();
 		MoveablesIds.push_back(objNum);
 
 		Objects[objNum].loaded = true;
-		Objects[objNum].nmeshes = ReadInt32();
-		Objects[objNum].meshIndex = ReadInt32();
-		Objects[objNum].boneIndex = ReadInt32();
-		Objects[objNum].frameBase = ReadInt32();
-		Objects[objNum].animIndex = ReadInt32();
+		Objects[objNum].nmeshes = cursor.ReadInt32();
+		Objects[objNum].meshIndex = cursor.ReadInt32();
+		Objects[objNum].boneIndex = cursor.ReadInt32();
+		Objects[objNum].frameBase = cursor.ReadInt32();
+		Objects[objNum].animIndex = cursor.ReadInt32();
 
 		Objects[objNum].loaded = true;
 	}
@@ -436,12 +381,12 @@ void LoadObjects()
 	TENLog("Initializing objects...", LogLevel::Info);
 	InitializeObjects();
 
-	int numStatics = ReadInt32();
+	int numStatics = cursor.ReadInt32();
 	TENLog("Num statics: " + std::to_string(numStatics), LogLevel::Info);
 
 	for (int i = 0; i < numStatics; i++)
 	{
-		int meshID = ReadInt32();
+		int meshID = cursor.ReadInt32();
 
 		if (meshID >= MAX_STATICS)
 		{
@@ -453,32 +398,32 @@ void LoadObjects()
 
 		StaticObjectsIds.push_back(meshID);
 
-		StaticObjects[meshID].meshNumber = (short)ReadInt32();
+		StaticObjects[meshID].meshNumber = (short)cursor.ReadInt32();
 
-		StaticObjects[meshID].visibilityBox.X1 = ReadInt16();
-		StaticObjects[meshID].visibilityBox.X2 = ReadInt16();
-		StaticObjects[meshID].visibilityBox.Y1 = ReadInt16();
-		StaticObjects[meshID].visibilityBox.Y2 = ReadInt16();
-		StaticObjects[meshID].visibilityBox.Z1 = ReadInt16();
-		StaticObjects[meshID].visibilityBox.Z2 = ReadInt16();
+		StaticObjects[meshID].visibilityBox.X1 = cursor.ReadInt16();
+		StaticObjects[meshID].visibilityBox.X2 = cursor.ReadInt16();
+		StaticObjects[meshID].visibilityBox.Y1 = cursor.ReadInt16();
+		StaticObjects[meshID].visibilityBox.Y2 = cursor.ReadInt16();
+		StaticObjects[meshID].visibilityBox.Z1 = cursor.ReadInt16();
+		StaticObjects[meshID].visibilityBox.Z2 = cursor.ReadInt16();
 
-		StaticObjects[meshID].collisionBox.X1 = ReadInt16();
-		StaticObjects[meshID].collisionBox.X2 = ReadInt16();
-		StaticObjects[meshID].collisionBox.Y1 = ReadInt16();
-		StaticObjects[meshID].collisionBox.Y2 = ReadInt16();
-		StaticObjects[meshID].collisionBox.Z1 = ReadInt16();
-		StaticObjects[meshID].collisionBox.Z2 = ReadInt16();
+		StaticObjects[meshID].collisionBox.X1 = cursor.ReadInt16();
+		StaticObjects[meshID].collisionBox.X2 = cursor.ReadInt16();
+		StaticObjects[meshID].collisionBox.Y1 = cursor.ReadInt16();
+		StaticObjects[meshID].collisionBox.Y2 = cursor.ReadInt16();
+		StaticObjects[meshID].collisionBox.Z1 = cursor.ReadInt16();
+		StaticObjects[meshID].collisionBox.Z2 = cursor.ReadInt16();
 
-		StaticObjects[meshID].flags = (short)ReadInt16();
+		StaticObjects[meshID].flags = (short)cursor.ReadInt16();
 
-		StaticObjects[meshID].shatterType = (ShatterType)ReadInt16();
-		StaticObjects[meshID].shatterSound = (short)ReadInt16();
+		StaticObjects[meshID].shatterType = (ShatterType)cursor.ReadInt16();
+		StaticObjects[meshID].shatterSound = (short)cursor.ReadInt16();
 	}
 }
 
-void LoadCameras()
+void LoadCameras(LevelDataCursor& cursor)
 {
-	int numCameras = ReadInt32();
+	int numCameras = cursor.ReadInt32();
 	TENLog("Num cameras: " + std::to_string(numCameras), LogLevel::Info);
 
 	g_Level.Cameras.reserve(numCameras);
@@ -486,48 +431,48 @@ void LoadCameras()
 	{
 		auto& camera = g_Level.Cameras.emplace_back();
 		camera.Index = i;
-		camera.Position.x = ReadInt32();
-		camera.Position.y = ReadInt32();
-		camera.Position.z = ReadInt32();
-		camera.RoomNumber = ReadInt32();
-		camera.Flags = ReadInt32();
-		camera.Speed = ReadInt32();
-		camera.Name = ReadString();
+		camera.Position.x = cursor.ReadInt32();
+		camera.Position.y = cursor.ReadInt32();
+		camera.Position.z = cursor.ReadInt32();
+		camera.RoomNumber = cursor.ReadInt32();
+		camera.Flags = cursor.ReadInt32();
+		camera.Speed = cursor.ReadInt32();
+		camera.Name = cursor.ReadString();
 
 		g_GameScriptEntities->AddName(camera.Name, camera);
 	}
 
-	NumberSpotcams = ReadInt32();
+	NumberSpotcams = cursor.ReadInt32();
 
 	// TODO: Read properly!
 	if (NumberSpotcams != 0)
-		ReadBytes(SpotCam, NumberSpotcams * sizeof(SPOTCAM));
+		cursor.ReadBytes(SpotCam, NumberSpotcams * sizeof(SPOTCAM));
 
-	int numSinks = ReadInt32();
+	int numSinks = cursor.ReadInt32();
 	TENLog("Num sinks: " + std::to_string(numSinks), LogLevel::Info);
 
 	g_Level.Sinks.reserve(numSinks);
 	for (int i = 0; i < numSinks; i++)
 	{
 		auto& sink = g_Level.Sinks.emplace_back();
-		sink.Position.x = ReadInt32();
-		sink.Position.y = ReadInt32();
-		sink.Position.z = ReadInt32();
-		sink.Strength = ReadInt32();
-		sink.BoxIndex = ReadInt32();
-		sink.Name = ReadString();
+		sink.Position.x = cursor.ReadInt32();
+		sink.Position.y = cursor.ReadInt32();
+		sink.Position.z = cursor.ReadInt32();
+		sink.Strength = cursor.ReadInt32();
+		sink.BoxIndex = cursor.ReadInt32();
+		sink.Name = cursor.ReadString();
 
 		g_GameScriptEntities->AddName(sink.Name, sink);
 	}
 }
 
-void LoadTextures()
+void LoadTextures(LevelDataCursor& cursor)
 {
 	TENLog("Loading textures... ", LogLevel::Info);
 
 	int size;
 
-	int numTextures = ReadInt32();
+	int numTextures = cursor.ReadInt32();
 	TENLog("Num room textures: " + std::to_string(numTextures), LogLevel::Info);
 
 	g_Level.RoomTextures.reserve(numTextures);
@@ -535,25 +480,23 @@ void LoadTextures()
 	{
 		TEXTURE texture;
 
-		texture.width = ReadInt32();
-		texture.height = ReadInt32();
+		texture.width = cursor.ReadInt32();
+		texture.height = cursor.ReadInt32();
 
-		size = ReadInt32();
-		texture.colorMapData.resize(size);
-		ReadBytes(texture.colorMapData.data(), size);
+		size = cursor.ReadInt32();
+		cursor.ReadArray(texture.colorMapData, size);
 		
-		bool hasNormalMap = ReadBool();
+		bool hasNormalMap = cursor.ReadBool();
 		if (hasNormalMap)
 		{
-			size = ReadInt32();
-			texture.normalMapData.resize(size);
-			ReadBytes(texture.normalMapData.data(), size);
+			size = cursor.ReadInt32();
+			cursor.ReadArray(texture.normalMapData, size);
 		}
 
 		g_Level.RoomTextures.push_back(texture);
 	}
 
-	numTextures = ReadInt32();
+	numTextures = cursor.ReadInt32();
 	TENLog("Num object textures: " + std::to_string(numTextures), LogLevel::Info);
 
 	g_Level.MoveablesTextures.reserve(numTextures);
@@ -561,25 +504,23 @@ void LoadTextures()
 	{
 		TEXTURE texture;
 
-		texture.width = ReadInt32();
-		texture.height = ReadInt32();
+		texture.width = cursor.ReadInt32();
+		texture.height = cursor.ReadInt32();
 
-		size = ReadInt32();
-		texture.colorMapData.resize(size);
-		ReadBytes(texture.colorMapData.data(), size);
+		size = cursor.ReadInt32();
+		cursor.ReadArray(texture.colorMapData, size);
 
-		bool hasNormalMap = ReadBool();
+		bool hasNormalMap = cursor.ReadBool();
 		if (hasNormalMap)
 		{
-			size = ReadInt32();
-			texture.normalMapData.resize(size);
-			ReadBytes(texture.normalMapData.data(), size);
+			size = cursor.ReadInt32();
+			cursor.ReadArray(texture.normalMapData, size);
 		}
 
 		g_Level.MoveablesTextures.push_back(texture);
 	}
 
-	numTextures = ReadInt32();
+	numTextures = cursor.ReadInt32();
 	TENLog("Num static textures: " + std::to_string(numTextures), LogLevel::Info);
 
 	g_Level.StaticsTextures.reserve(numTextures);
@@ -587,25 +528,23 @@ void LoadTextures()
 	{
 		TEXTURE texture;
 
-		texture.width = ReadInt32();
-		texture.height = ReadInt32();
+		texture.width = cursor.ReadInt32();
+		texture.height = cursor.ReadInt32();
 
-		size = ReadInt32();
-		texture.colorMapData.resize(size);
-		ReadBytes(texture.colorMapData.data(), size);
+		size = cursor.ReadInt32();
+		cursor.ReadArray(texture.colorMapData, size);
 
-		bool hasNormalMap = ReadBool();
+		bool hasNormalMap = cursor.ReadBool();
 		if (hasNormalMap)
 		{
-			size = ReadInt32();
-			texture.normalMapData.resize(size);
-			ReadBytes(texture.normalMapData.data(), size);
+			size = cursor.ReadInt32();
+			cursor.ReadArray(texture.normalMapData, size);
 		}
 
 		g_Level.StaticsTextures.push_back(texture);
 	}
 
-	numTextures = ReadInt32();
+	numTextures = cursor.ReadInt32();
 	TENLog("Num anim textures: " + std::to_string(numTextures), LogLevel::Info);
 
 	g_Level.AnimatedTextures.reserve(numTextures);
@@ -613,25 +552,23 @@ void LoadTextures()
 	{
 		TEXTURE texture;
 
-		texture.width = ReadInt32();
-		texture.height = ReadInt32();
+		texture.width = cursor.ReadInt32();
+		texture.height = cursor.ReadInt32();
 
-		size = ReadInt32();
-		texture.colorMapData.resize(size);
-		ReadBytes(texture.colorMapData.data(), size);
+		size = cursor.ReadInt32();
+		cursor.ReadArray(texture.colorMapData, size);
 
-		bool hasNormalMap = ReadBool();
+		bool hasNormalMap = cursor.ReadBool();
 		if (hasNormalMap)
 		{
-			size = ReadInt32();
-			texture.normalMapData.resize(size);
-			ReadBytes(texture.normalMapData.data(), size);
+			size = cursor.ReadInt32();
+			cursor.ReadArray(texture.normalMapData, size);
 		}
 
 		g_Level.AnimatedTextures.push_back(texture);
 	}
 
-	numTextures = ReadInt32();
+	numTextures = cursor.ReadInt32();
 	TENLog("Num sprite textures: " + std::to_string(numTextures), LogLevel::Info);
 
 	g_Level.SpritesTextures.reserve(numTextures);
@@ -639,21 +576,19 @@ void LoadTextures()
 	{
 		TEXTURE texture;
 
-		texture.width = ReadInt32();
-		texture.height = ReadInt32();
+		texture.width = cursor.ReadInt32();
+		texture.height = cursor.ReadInt32();
 
-		size = ReadInt32();
-		texture.colorMapData.resize(size);
-		ReadBytes(texture.colorMapData.data(), size);
+		size = cursor.ReadInt32();
+		cursor.ReadArray(texture.colorMapData, size);
 
 		g_Level.SpritesTextures.push_back(texture);
 	}
 
-	g_Level.SkyTexture.width = ReadInt32();
-	g_Level.SkyTexture.height = ReadInt32();
-	size = ReadInt32();
-	g_Level.SkyTexture.colorMapData.resize(size);
-	ReadBytes(g_Level.SkyTexture.colorMapData.data(), size);
+	g_Level.SkyTexture.width = cursor.ReadInt32();
+	g_Level.SkyTexture.height = cursor.ReadInt32();
+	size = cursor.ReadInt32();
+	cursor.ReadArray(g_Level.SkyTexture.colorMapData, size);
 }
 
 // The way floordata "planes" were previously stored was non-standard.
@@ -676,12 +611,12 @@ static Plane ConvertFakePlaneToPlane(const Vector3& fakePlane, bool isFloor)
 	return Plane(normal, dist);
 }
 
-void ReadRooms()
+void ReadRooms(LevelDataCursor& cursor)
 {
 	constexpr auto ILLEGAL_FLOOR_SLOPE_ANGLE   = ANGLE(36.0f);
 	constexpr auto ILLEGAL_CEILING_SLOPE_ANGLE = ANGLE(45.0f);
 
-	int roomCount = ReadInt32();
+	int roomCount = cursor.ReadInt32();
 	TENLog("Rooms: " + std::to_string(roomCount), LogLevel::Info);
 
 	g_Level.Rooms.reserve(roomCount);
@@ -689,53 +624,53 @@ void ReadRooms()
 	{
 		auto& room = g_Level.Rooms.emplace_back();
 		
-		room.name = ReadString();
+		room.name = cursor.ReadString();
 
-		int tagCount = ReadInt32();
+		int tagCount = cursor.ReadInt32();
 		for (int j = 0; j < tagCount; j++)
-			room.tags.push_back(ReadString());
+			room.tags.push_back(cursor.ReadString());
 		
-		room.x = ReadInt32();
+		room.x = cursor.ReadInt32();
 		room.y = 0;
-		room.z = ReadInt32();
-		room.minfloor = ReadInt32();
-		room.maxceiling = ReadInt32();
+		room.z = cursor.ReadInt32();
+		room.minfloor = cursor.ReadInt32();
+		room.maxceiling = cursor.ReadInt32();
 
-		int vertexCount = ReadInt32();
+		int vertexCount = cursor.ReadInt32();
 
 		room.positions.reserve(vertexCount);
 		for (int j = 0; j < vertexCount; j++)
-			room.positions.push_back(ReadVector3());
+			room.positions.push_back(cursor.ReadVector3());
 
 		room.colors.reserve(vertexCount);
 		for (int j = 0; j < vertexCount; j++)
-			room.colors.push_back(ReadVector3());
+			room.colors.push_back(cursor.ReadVector3());
 
 		room.effects.reserve(vertexCount);
 		for (int j = 0; j < vertexCount; j++)
-			room.effects.push_back(ReadVector3());
+			room.effects.push_back(cursor.ReadVector3());
 
-		int bucketCount = ReadInt32();
+		int bucketCount = cursor.ReadInt32();
 		room.buckets.reserve(bucketCount);
 		for (int j = 0; j < bucketCount; j++)
 		{
 			auto bucket = BUCKET{};
 
-			bucket.texture = ReadInt32();
-			bucket.blendMode = (BlendMode)ReadUInt8();
-			bucket.animated = ReadBool();
+			bucket.texture = cursor.ReadInt32();
+			bucket.blendMode = (BlendMode)cursor.ReadUInt8();
+			bucket.animated = cursor.ReadBool();
 			bucket.numQuads = 0;
 			bucket.numTriangles = 0;
 
-			int polyCount = ReadInt32();
+			int polyCount = cursor.ReadInt32();
 			bucket.polygons.reserve(polyCount);
 			for (int k = 0; k < polyCount; k++)
 			{
 				auto poly = POLYGON{};
 				
-				poly.shape = ReadInt32();
-				poly.animatedSequence = ReadInt32();
-				poly.animatedFrame = ReadInt32();
+				poly.shape = cursor.ReadInt32();
+				poly.animatedSequence = cursor.ReadInt32();
+				poly.animatedFrame = cursor.ReadInt32();
 
 				int count = (poly.shape == 0 ? 4 : 3);
 				poly.indices.resize(count);
@@ -745,19 +680,19 @@ void ReadRooms()
 				poly.binormals.resize(count);
 
 				for (int l = 0; l < count; l++)
-					poly.indices[l] = ReadInt32();
+					poly.indices[l] = cursor.ReadInt32();
 
 				for (int n = 0; n < count; n++)
-					poly.textureCoordinates[n] = ReadVector2();
+					poly.textureCoordinates[n] = cursor.ReadVector2();
 
 				for (int n = 0; n < count; n++)
-					poly.normals[n] = ReadVector3();
+					poly.normals[n] = cursor.ReadVector3();
 
 				for (int n = 0; n < count; n++)
-					poly.tangents[n] = ReadVector3();
+					poly.tangents[n] = cursor.ReadVector3();
 
 				for (int n = 0; n < count; n++)
-					poly.binormals[n] = ReadVector3();
+					poly.binormals[n] = cursor.ReadVector3();
 
 				bucket.polygons.push_back(poly);
 
@@ -767,112 +702,112 @@ void ReadRooms()
 			room.buckets.push_back(bucket);
 		}
 
-		int portalCount = ReadInt32();
+		int portalCount = cursor.ReadInt32();
 		for (int j = 0; j < portalCount; j++)
-			LoadPortal(room);
+			LoadPortal(cursor, room);
 
-		room.zSize = ReadInt32();
-		room.xSize = ReadInt32();
+		room.zSize = cursor.ReadInt32();
+		room.xSize = cursor.ReadInt32();
 
 		room.floor.reserve(room.zSize * room.xSize);
 		for (int j = 0; j < (room.zSize * room.xSize); j++)
 		{
 			auto sector = FloorInfo{};
 
-			sector.TriggerIndex = ReadInt32();
-			sector.Box = ReadInt32();
+			sector.TriggerIndex = cursor.ReadInt32();
+			sector.Box = cursor.ReadInt32();
 
 			sector.FloorSurface.Triangles[0].Material =
 			sector.FloorSurface.Triangles[1].Material =
 			sector.CeilingSurface.Triangles[0].Material =
-			sector.CeilingSurface.Triangles[1].Material = (MaterialType)ReadInt32();
+			sector.CeilingSurface.Triangles[1].Material = (MaterialType)cursor.ReadInt32();
 
-			sector.Stopper = (bool)ReadInt32();
+			sector.Stopper = (bool)cursor.ReadInt32();
 
-			sector.FloorSurface.SplitAngle = FROM_RAD(ReadFloat());
+			sector.FloorSurface.SplitAngle = FROM_RAD(cursor.ReadFloat());
 			sector.FloorSurface.Triangles[0].IllegalSlopeAngle = ILLEGAL_FLOOR_SLOPE_ANGLE;
 			sector.FloorSurface.Triangles[1].IllegalSlopeAngle = ILLEGAL_FLOOR_SLOPE_ANGLE;
-			sector.FloorSurface.Triangles[0].PortalRoomNumber = ReadInt32();
-			sector.FloorSurface.Triangles[1].PortalRoomNumber = ReadInt32();
-			sector.FloorSurface.Triangles[0].Plane = ConvertFakePlaneToPlane(ReadVector3(), true);
-			sector.FloorSurface.Triangles[1].Plane = ConvertFakePlaneToPlane(ReadVector3(), true);
+			sector.FloorSurface.Triangles[0].PortalRoomNumber = cursor.ReadInt32();
+			sector.FloorSurface.Triangles[1].PortalRoomNumber = cursor.ReadInt32();
+			sector.FloorSurface.Triangles[0].Plane = ConvertFakePlaneToPlane(cursor.ReadVector3(), true);
+			sector.FloorSurface.Triangles[1].Plane = ConvertFakePlaneToPlane(cursor.ReadVector3(), true);
 
-			sector.CeilingSurface.SplitAngle = FROM_RAD(ReadFloat());
+			sector.CeilingSurface.SplitAngle = FROM_RAD(cursor.ReadFloat());
 			sector.CeilingSurface.Triangles[0].IllegalSlopeAngle = ILLEGAL_CEILING_SLOPE_ANGLE;
 			sector.CeilingSurface.Triangles[1].IllegalSlopeAngle = ILLEGAL_CEILING_SLOPE_ANGLE;
-			sector.CeilingSurface.Triangles[0].PortalRoomNumber = ReadInt32();
-			sector.CeilingSurface.Triangles[1].PortalRoomNumber = ReadInt32();
-			sector.CeilingSurface.Triangles[0].Plane = ConvertFakePlaneToPlane(ReadVector3(), false);
-			sector.CeilingSurface.Triangles[1].Plane = ConvertFakePlaneToPlane(ReadVector3(), false);
-
-			sector.SidePortalRoomNumber = ReadInt32();
-			sector.Flags.Death = ReadBool();
-			sector.Flags.Monkeyswing = ReadBool();
-			sector.Flags.ClimbNorth = ReadBool();
-			sector.Flags.ClimbSouth = ReadBool();
-			sector.Flags.ClimbEast = ReadBool();
-			sector.Flags.ClimbWest = ReadBool();
-			sector.Flags.MarkTriggerer = ReadBool();
+			sector.CeilingSurface.Triangles[0].PortalRoomNumber = cursor.ReadInt32();
+			sector.CeilingSurface.Triangles[1].PortalRoomNumber = cursor.ReadInt32();
+			sector.CeilingSurface.Triangles[0].Plane = ConvertFakePlaneToPlane(cursor.ReadVector3(), false);
+			sector.CeilingSurface.Triangles[1].Plane = ConvertFakePlaneToPlane(cursor.ReadVector3(), false);
+
+			sector.SidePortalRoomNumber = cursor.ReadInt32();
+			sector.Flags.Death = cursor.ReadBool();
+			sector.Flags.Monkeyswing = cursor.ReadBool();
+			sector.Flags.ClimbNorth = cursor.ReadBool();
+			sector.Flags.ClimbSouth = cursor.ReadBool();
+			sector.Flags.ClimbEast = cursor.ReadBool();
+			sector.Flags.ClimbWest = cursor.ReadBool();
+			sector.Flags.MarkTriggerer = cursor.ReadBool();
 			sector.Flags.MarkTriggererActive = 0; // TODO: Needs to be written to and read from savegames.
-			sector.Flags.MarkBeetle = ReadBool();
+			sector.Flags.MarkBeetle = cursor.ReadBool();
 
 			sector.RoomNumber = i;
 
 			room.floor.push_back(sector);
 		}
 
-		room.ambient = ReadVector3();
+		room.ambient = cursor.ReadVector3();
 
-		int numLights = ReadInt32();
+		int numLights = cursor.ReadInt32();
 		room.lights.reserve(numLights);
 		for (int j = 0; j < numLights; j++)
 		{
 			ROOM_LIGHT light;
 
-			light.x = ReadInt32();
-			light.y = ReadInt32();
-			light.z = ReadInt32();
-			light.dx = ReadFloat();
-			light.dy = ReadFloat();
-			light.dz = ReadFloat();
-			light.r = ReadFloat();
-			light.g = ReadFloat();
-			light.b = ReadFloat();
-			light.intensity = ReadFloat();
-			light.in = ReadFloat();
-			light.out = ReadFloat();
-			light.length = ReadFloat();
-			light.cutoff = ReadFloat();
-			light.type = ReadUInt8();
-			light.castShadows = ReadBool();
+			light.x = cursor.ReadInt32();
+			light.y = cursor.ReadInt32();
+			light.z = cursor.ReadInt32();
+			light.dx = cursor.ReadFloat();
+			light.dy = cursor.ReadFloat();
+			light.dz = cursor.ReadFloat();
+			light.r = cursor.ReadFloat();
+			light.g = cursor.ReadFloat();
+			light.b = cursor.ReadFloat();
+			light.intensity = cursor.ReadFloat();
+			light.in = cursor.ReadFloat();
+			light.out = cursor.ReadFloat();
+			light.length = cursor.ReadFloat();
+			light.cutoff = cursor.ReadFloat();
+			light.type = cursor.ReadUInt8();
+			light.castShadows = cursor.ReadBool();
 
 			room.lights.push_back(light);
 		}
 		
-		int numStatics = ReadInt32();
+		int numStatics = cursor.ReadInt32();
 		room.mesh.reserve(numStatics);
 		for (int j = 0; j < numStatics; j++)
 		{
 			auto& mesh = room.mesh.emplace_back();
 
 			mesh.roomNumber = i;
-			mesh.pos.Position.x = ReadInt32();
-			mesh.pos.Position.y = ReadInt32();
-			mesh.pos.Position.z = ReadInt32();
-			mesh.pos.Orientation.y = ReadUInt16();
-			mesh.pos.Orientation.x = ReadUInt16();
-			mesh.pos.Orientation.z = ReadUInt16();
-			mesh.scale = ReadFloat();
-			mesh.flags = ReadUInt16();
-			mesh.color = ReadVector4();
-			mesh.staticNumber = ReadUInt16();
-			mesh.HitPoints = ReadInt16();
-			mesh.Name = ReadString();
+			mesh.pos.Position.x = cursor.ReadInt32();
+			mesh.pos.Position.y = cursor.ReadInt32();
+			mesh.pos.Position.z = cursor.ReadInt32();
+			mesh.pos.Orientation.y = cursor.ReadUInt16();
+			mesh.pos.Orientation.x = cursor.ReadUInt16();
+			mesh.pos.Orientation.z = cursor.ReadUInt16();
+			mesh.scale = cursor.ReadFloat();
+			mesh.flags = cursor.ReadUInt16();
+			mesh.color = cursor.ReadVector4();
+			mesh.staticNumber = cursor.ReadUInt16();
+			mesh.HitPoints = cursor.ReadInt16();
+			mesh.Name = cursor.ReadString();
 
 			g_GameScriptEntities->AddName(mesh.Name, mesh);
 		}
 
-		int numTriggerVolumes = ReadInt32();
+		int numTriggerVolumes = cursor.ReadInt32();
 
 		// Reserve in advance so the vector doesn't resize itself and leave anything
 		// in the script name-to-reference map obsolete.
@@ -881,18 +816,18 @@ void ReadRooms()
 		{
 			auto& volume = room.triggerVolumes.emplace_back();
 
-			volume.Type = (VolumeType)ReadInt32();
+			volume.Type = (VolumeType)cursor.ReadInt32();
 
 			// NOTE: Braces are necessary to ensure correct value init order.
-			auto pos = Vector3{ ReadFloat(), ReadFloat(), ReadFloat() };
-			auto orient = Quaternion{ ReadFloat(), ReadFloat(), ReadFloat(), ReadFloat() };
-			auto scale = Vector3{ ReadFloat(), ReadFloat(), ReadFloat() };
+			auto pos = Vector3{ cursor.ReadFloat(), cursor.ReadFloat(), cursor.ReadFloat() };
+			auto orient = Quaternion{ cursor.ReadFloat(), cursor.ReadFloat(), cursor.ReadFloat(), cursor.ReadFloat() };
+			auto scale = Vector3{ cursor.ReadFloat(), cursor.ReadFloat(), cursor.ReadFloat() };
 
-			volume.Enabled = ReadBool();
-			volume.DetectInAdjacentRooms = ReadBool();
+			volume.Enabled = cursor.ReadBool();
+			volume.DetectInAdjacentRooms = cursor.ReadBool();
 
-			volume.Name = ReadString();
-			volume.EventSetIndex = ReadInt32();
+			volume.Name = cursor.ReadString();
+			volume.EventSetIndex = cursor.ReadInt32();
 
 			volume.Box    = BoundingOrientedBox(pos, scale, orient);
 			volume.Sphere = BoundingSphere(pos, scale.x);
@@ -902,11 +837,11 @@ void ReadRooms()
 			g_GameScriptEntities->AddName(volume.Name, volume);
 		}
 
-		room.flippedRoom = ReadInt32();
-		room.flags = ReadInt32();
-		room.meshEffect = ReadInt32();
-		room.reverbType = (ReverbType)ReadInt32();
-		room.flipNumber = ReadInt32();
+		room.flippedRoom = cursor.ReadInt32();
+		room.flags = cursor.ReadInt32();
+		room.meshEffect = cursor.ReadInt32();
+		room.reverbType = (ReverbType)cursor.ReadInt32();
+		room.flipNumber = cursor.ReadInt32();
 
 		room.itemNumber = NO_VALUE;
 		room.fxNumber = NO_VALUE;
@@ -916,18 +851,18 @@ void ReadRooms()
 	}
 }
 
-void LoadRooms()
+void LoadRooms(LevelDataCursor& cursor)
 {
 	TENLog("Loading rooms... ", LogLevel::Info);
 	
 	Wibble = 0;
 
-	ReadRooms();
-	BuildOutsideRoomsTable();
+	ReadRooms(cursor);
+	g_RoomIndex.Initialize();
 
-	int numFloorData = ReadInt32(); 
+	int numFloorData = cursor.ReadInt32(); 
 	g_Level.FloorData.resize(numFloorData);
-	ReadBytes(g_Level.FloorData.data(), numFloorData * sizeof(short));
+	cursor.ReadBytes(g_Level.FloorData.data(), numFloorData * sizeof(short));
 }
 
 void FreeLevel()
@@ -939,6 +874,10 @@ void FreeLevel()
 		return;
 	}
 
+	g_BroadPhase.Deinitialize();
+	g_Raycast.Deinitialize();
+	g_RoomIndex.Deinitialize();
+
 	g_Level.RoomTextures.resize(0);
 	g_Level.MoveablesTextures.resize(0);
 	g_Level.StaticsTextures.resize(0);
@@ -957,6 +896,7 @@ void FreeLevel()
 	g_Level.Ranges.resize(0);
 	g_Level.Commands.resize(0);
 	g_Level.Frames.resize(0);
+	g_Level.FrameOrientations.resize(0);
 	g_Level.Sprites.resize(0);
 	g_Level.SoundDetails.resize(0);
 	g_Level.SoundMap.resize(0);
@@ -969,6 +909,7 @@ void FreeLevel()
 	g_Level.GlobalEventSets.resize(0);
 	g_Level.LoopedEventSetIndices.resize(0);
 	g_Level.Items.resize(0);
+	g_Level.SkyTexture = {};
 
 	for (int i = 0; i < 2; i++)
 	{
@@ -981,6 +922,9 @@ void FreeLevel()
 	g_GameScriptEntities->FreeEntities();
 
 	FreeSamples();
+
+	// Release mapping only after all views into it are gone.
+	g_Level.MappedData.Close();
 }
 
 size_t ReadFileEx(void* ptr, size_t size, size_t count, FILE* stream)
@@ -991,9 +935,9 @@ size_t ReadFileEx(void* ptr, size_t size, size_t count, FILE* stream)
 	return result;
 }
 
-void LoadSoundSources()
+void LoadSoundSources(LevelDataCursor& cursor)
 {
-	int numSoundSources = ReadInt32();
+	int numSoundSources = cursor.ReadInt32();
 	TENLog("Num sound sources: " + std::to_string(numSoundSources), LogLevel::Info);
 
 	g_Level.SoundSources.reserve(numSoundSources);
@@ -1001,40 +945,40 @@ void LoadSoundSources()
 	{
 		auto& source = g_Level.SoundSources.emplace_back(SoundSourceInfo{});
 
-		source.Position.x = ReadInt32();
-		source.Position.y = ReadInt32();
-		source.Position.z = ReadInt32();
-		source.SoundID = ReadInt32();
-		source.Flags = ReadInt32();
-		source.Name = ReadString();
+		source.Position.x = cursor.ReadInt32();
+		source.Position.y = cursor.ReadInt32();
+		source.Position.z = cursor.ReadInt32();
+		source.SoundID = cursor.ReadInt32();
+		source.Flags = cursor.ReadInt32();
+		source.Name = cursor.ReadString();
 
 		g_GameScriptEntities->AddName(source.Name, source);
 	}
 }
 
-void LoadAnimatedTextures()
+void LoadAnimatedTextures(LevelDataCursor& cursor)
 {
-	int numAnimatedTextures = ReadInt32();
+	int numAnimatedTextures = cursor.ReadInt32();
 	TENLog("Num anim textures: " + std::to_string(numAnimatedTextures), LogLevel::Info);
 
 	for (int i = 0; i < numAnimatedTextures; i++)
 	{
 		ANIMATED_TEXTURES_SEQUENCE sequence;
-		sequence.atlas = ReadInt32();
-		sequence.Fps = ReadInt32();
-		sequence.numFrames = ReadInt32();
+		sequence.atlas = cursor.ReadInt32();
+		sequence.Fps = cursor.ReadInt32();
+		sequence.numFrames = cursor.ReadInt32();
 
 		for (int j = 0; j < sequence.numFrames; j++)
 		{
 			ANIMATED_TEXTURES_FRAME frame;
-			frame.x1 = ReadFloat();
-			frame.y1 = ReadFloat();
-			frame.x2 = ReadFloat();
-			frame.y2 = ReadFloat();
-			frame.x3 = ReadFloat();
-			frame.y3 = ReadFloat();
-			frame.x4 = ReadFloat();
-			frame.y4 = ReadFloat();
+			frame.x1 = cursor.ReadFloat();
+			frame.y1 = cursor.ReadFloat();
+			frame.x2 = cursor.ReadFloat();
+			frame.y2 = cursor.ReadFloat();
+			frame.x3 = cursor.ReadFloat();
+			frame.y3 = cursor.ReadFloat();
+			frame.x4 = cursor.ReadFloat();
+			frame.y4 = cursor.ReadFloat();
 			sequence.frames.push_back(frame);
 		}
 
@@ -1042,9 +986,9 @@ void LoadAnimatedTextures()
 	}
 }
 
-void LoadAIObjects()
+void LoadAIObjects(LevelDataCursor& cursor)
 {
-	int nAIObjects = ReadInt32();
+	int nAIObjects = cursor.ReadInt32();
 	TENLog("Num AI objects: " + std::to_string(nAIObjects), LogLevel::Info);
 
 	g_Level.AIObjects.reserve(nAIObjects);
@@ -1052,26 +996,26 @@ void LoadAIObjects()
 	{
 		auto& obj = g_Level.AIObjects.emplace_back();
 
-		obj.objectNumber = (GAME_OBJECT_ID)ReadInt16();
-		obj.roomNumber = ReadInt16();
-		obj.pos.Position.x = ReadInt32();
-		obj.pos.Position.y = ReadInt32();
-		obj.pos.Position.z = ReadInt32();
-		obj.pos.Orientation.y = ReadInt16();
-		obj.pos.Orientation.x = ReadInt16();
-		obj.pos.Orientation.z = ReadInt16();
-		obj.triggerFlags = ReadInt16();
-		obj.flags = ReadInt16();
-		obj.boxNumber = ReadInt32();
-		obj.Name = ReadString();
+		obj.objectNumber = (GAME_OBJECT_ID)cursor.ReadInt16();
+		obj.roomNumber = cursor.ReadInt16();
+		obj.pos.Position.x = cursor.ReadInt32();
+		obj.pos.Position.y = cursor.ReadInt32();
+		obj.pos.Position.z = cursor.ReadInt32();
+		obj.pos.Orientation.y = cursor.ReadInt16();
+		obj.pos.Orientation.x = cursor.ReadInt16();
+		obj.pos.Orientation.z = cursor.ReadInt16();
+		obj.triggerFlags = cursor.ReadInt16();
+		obj.flags = cursor.ReadInt16();
+		obj.boxNumber = cursor.ReadInt32();
+		obj.Name = cursor.ReadString();
 
 		g_GameScriptEntities->AddName(obj.Name, obj);
 	}
 }
 
-void LoadEvent(EventSet& eventSet)
+void LoadEvent(LevelDataCursor& cursor, EventSet& eventSet)
 {
-	int eventType = ReadInt32();
+	int eventType = cursor.ReadInt32();
 
 	if (eventType >= (int)EventType::Count)
 	{
@@ -1081,50 +1025,50 @@ void LoadEvent(EventSet& eventSet)
 
 	auto& evt = eventSet.Events[eventType];
 
-	evt.Mode = (EventMode)ReadInt32();
-	evt.Function = ReadString();
-	evt.Data = ReadString();
-	evt.CallCounter = ReadInt32();
+	evt.Mode = (EventMode)cursor.ReadInt32();
+	evt.Function = ScriptCallback{ cursor.ReadString() };
+	evt.Data = cursor.ReadString();
+	evt.CallCounter = cursor.ReadInt32();
 }
 
-void LoadEventSets()
+void LoadEventSets(LevelDataCursor& cursor)
 {
-	int eventSetCount = ReadInt32();
+	int eventSetCount = cursor.ReadInt32();
 	if (eventSetCount == 0)
 		return;
 
-	int globalEventSetCount = ReadInt32();
+	int globalEventSetCount = cursor.ReadInt32();
 	TENLog("Num global event sets: " + std::to_string(globalEventSetCount), LogLevel::Info);
 
 	for (int i = 0; i < globalEventSetCount; i++)
 	{
 		auto eventSet = EventSet();
 
-		eventSet.Name = ReadString();
+		eventSet.Name = cursor.ReadString();
 
-		int eventCount = ReadInt32();
+		int eventCount = cursor.ReadInt32();
 		for (int j = 0; j < eventCount; j++)
-			LoadEvent(eventSet);
+			LoadEvent(cursor, eventSet);
 
 		g_Level.GlobalEventSets.push_back(eventSet);
 
-		if (!eventSet.Events[(int)EventType::Loop].Function.empty())
+		if (!eventSet.Events[(int)EventType::Loop].Function.Name.empty())
 			g_Level.LoopedEventSetIndices.push_back(i);
 	}
 
-	int volumeEventSetCount = ReadInt32();
+	int volumeEventSetCount = cursor.ReadInt32();
 	TENLog("Num volume event sets: " + std::to_string(volumeEventSetCount), LogLevel::Info);
 
 	for (int i = 0; i < volumeEventSetCount; i++)
 	{
 		auto eventSet = EventSet();
 
-		eventSet.Name = ReadString();
-		eventSet.Activators = (ActivatorFlags)ReadInt32();
+		eventSet.Name = cursor.ReadString();
+		eventSet.Activators = (ActivatorFlags)cursor.ReadInt32();
 
-		int eventCount = ReadInt32();
+		int eventCount = cursor.ReadInt32();
 		for (int j = 0; j < eventCount; j++)
-			LoadEvent(eventSet);
+			LoadEvent(cursor, eventSet);
 
 		g_Level.VolumeEventSets.push_back(eventSet);
 	}
@@ -1150,16 +1094,148 @@ bool Decompress(byte* dest, byte* src, unsigned long compressedSize, unsigned lo
 	strm.next_out = (BYTE*)dest;
 	strm.next_in = (BYTE*)src;
 
-	inflateInit(&strm);
+	if (inflateInit(&strm) != Z_OK)
+		return false;
+
 	inflate(&strm, Z_FULL_FLUSH);
 
-	if (strm.total_out == uncompressedSize)
+	bool result = (strm.total_out == uncompressedSize);
+	inflateEnd(&strm);
+	return result;
+}
+
+static std::vector<char> DecompressLevelSection(std::vector<char> compressedData, int uncompressedSize)
+{
+	auto data = std::vector<char>(uncompressedSize);
+	if (!Decompress((byte*)data.data(), (byte*)compressedData.data(), (unsigned long)compressedData.size(), uncompressedSize))
+		throw std::runtime_error("Unable to decompress level section.");
+
+	return data;
+}
+
+static void ReadLevelSections(FILE* filePtr, std::array<LevelSection, (int)LevelSectionType::Count>& sections)
+{
+	int sectionCount = 0;
+	ReadFileEx(&sectionCount, 1, 4, filePtr);
+
+	if (sectionCount <= 0)
+		throw std::runtime_error("Level file contains no data sections.");
+
+	auto headers = std::vector<LevelSectionHeader>(sectionCount);
+	ReadFileEx(headers.data(), sizeof(LevelSectionHeader), sectionCount, filePtr);
+
+	// Inflate every section on a worker as soon as its compressed payload is read from disk.
+	for (const auto& header : headers)
 	{
-		inflateEnd(&strm);
-		return true;
+		// Zero compressed size indicates section is stored uncompressed.
+		bool isCompressed = (header.CompressedSize > 0);
+
+		auto data = std::vector<char>(isCompressed ? header.CompressedSize : header.UncompressedSize);
+		if (ReadFileEx(data.data(), data.size(), 1, filePtr) != 1)
+			throw std::runtime_error("Level file is truncated.");
+
+		if (header.Type < 0 || header.Type >= (int)LevelSectionType::Count)
+		{
+			TENLog("Unknown level section type " + std::to_string(header.Type) + " will be ignored.", LogLevel::Warning);
+			continue;
+		}
+
+		auto& section = sections[header.Type];
+		section.IsPresent = true;
+
+		if (isCompressed)
+		{
+			section.Task = std::async(std::launch::async, DecompressLevelSection, std::move(data), header.UncompressedSize);
+		}
+		else
+		{
+			section.Data = std::move(data);
+			section.Cursor = LevelDataCursor(section.Data.data(), section.Data.size());
+		}
 	}
+}
+
+static void MapLevelSections(const std::string& levelPath, std::array<LevelSection, (int)LevelSectionType::Count>& sections)
+{
+	// Texture and vertex data will view mapped memory directly, so mapping is owned by level data.
+	auto& mapping = g_Level.MappedData;
+	if (!mapping.Open(levelPath))
+		throw std::runtime_error("Unable to map level file: " + levelPath);
 
-	return false;
+	constexpr auto TABLE_OFFSET = 12; // Header, version and system hash.
+
+	auto cursor = LevelDataCursor(mapping.GetData(), mapping.GetSize(), true);
+	cursor.Skip(TABLE_OFFSET);
+
+	int sectionCount = cursor.ReadInt32();
+	if (sectionCount <= 0)
+		throw std::runtime_error("Level file contains no data sections.");
+
+	for (int i = 0; i < sectionCount; i++)
+	{
+		auto header = LevelMappedSectionHeader{};
+		cursor.ReadBytes(&header, sizeof(LevelMappedSectionHeader));
+
+		if (header.Type < 0 || header.Type >= (int)LevelSectionType::Count)
+		{
+			TENLog("Unknown level section type " + std::to_string(header.Type) + " will be ignored.", LogLevel::Warning);
+			continue;
+		}
+
+		if (header.Offset < 0 || header.Size < 0 || (size_t)(header.Offset + header.Size) > mapping.GetSize())
+			throw std::runtime_error("Level section " + std::to_string(header.Type) + " is out of file bounds.");
+
+		sections[header.Type].IsPresent = true;
+		sections[header.Type].Cursor = LevelDataCursor(mapping.GetData() + header.Offset, header.Size, true);
+	}
+}
+
+static LevelDataCursor& AcquireLevelSection(std::array<LevelSection, (int)LevelSectionType::Count>& sections, LevelSectionType type)
+{
+	auto& section = sections[(int)type];
+
+	// Wait for worker to finish decompressing this section only.
+	if (section.Task.valid())
+	{
+		section.Data = section.Task.get();
+		section.Cursor = LevelDataCursor(section.Data.data(), section.Data.size());
+	}
+
+	// Present section may be empty, in which case empty cursor is returned.
+	if (!section.IsPresent)
+		throw std::runtime_error("Level section " + std::to_string((int)type) + " is missing.");
+
+	return section.Cursor;
+}
+
+static void ConvertLevelFile(const std::string& levelPath, const char* header, const unsigned char* version, int systemHash,
+							 const std::vector<char>& data, const std::vector<LevelSectionRange>& sections, const std::vector<LevelArrayRecord>& arrays)
+{
+	auto path = std::filesystem::path(levelPath);
+	auto suffix = (LevelConversionFormat == LEVEL_HEADER_MAPPED) ? "_mapped" : "_sectioned";
+	auto convertedPath = (path.parent_path() / (path.stem().string() + suffix + path.extension().string())).string();
+
+	auto fileHeader = std::array<char, 12>{};
+	std::copy(header, header + 4, fileHeader.begin());
+	std::copy(version, version + 4, fileHeader.begin() + 4);
+	std::memcpy(fileHeader.data() + 8, &systemHash, sizeof(int));
+
+	if (WriteLevelFile(convertedPath, LevelConversionFormat, fileHeader.data(), data.data(), sections, arrays))
+	{
+		TENLog("Converted level file written: " + convertedPath, LogLevel::Info);
+	}
+	else
+	{
+		TENLog("Unable to write converted level file: " + convertedPath, LogLevel::Warning);
+	}
+}
+
+static void ReleaseLevelSection(std::array<LevelSection, (int)LevelSectionType::Count>& sections, LevelSectionType type)
+{
+	auto& section = sections[(int)type];
+	section.Cursor = {};
+	section.Data.clear();
+	section.Data.shrink_to_fit();
 }
 
 bool LoadLevel(int levelIndex)
@@ -1170,11 +1246,15 @@ bool LoadLevel(int levelIndex)
 	auto levelPath = assetDir + level->FileName;
 	TENLog("Loading level file: " + levelPath, LogLevel::Info);
 
-	LevelDataPtr = nullptr;
 	FILE* filePtr = nullptr;
-	char* dataPtr = nullptr;
 	bool LoadedSuccessfully;
 
+	// Legacy level files are a single compressed block; sectioned files consist of independently compressed sections.
+	auto legacyData = std::vector<char>{};
+	auto legacyCursor = LevelDataCursor{};
+	auto sections = std::array<LevelSection, (int)LevelSectionType::Count>{};
+	bool isSectioned = false;
+
 	auto loadingScreenPath = TEN::Utils::ToWString(assetDir + level->LoadScreenFileName);
 	g_Renderer.SetLoadingScreen(loadingScreenPath);
 
@@ -1190,8 +1270,6 @@ bool LoadLevel(int levelIndex)
 
 		char header[4];
 		unsigned char version[4];
-		int compressedSize;
-		int uncompressedSize;
 		int systemHash;
 
 		// Read file header
@@ -1200,8 +1278,13 @@ bool LoadLevel(int levelIndex)
 		ReadFileEx(&systemHash, 1, 4, filePtr);
 
 		// Check file header
-		if (std::string(header) != "TEN")
+		if (std::strncmp(header, "TEN", 3) != 0 ||
+			(header[3] != '\0' && header[3] != LEVEL_HEADER_SECTIONED && header[3] != LEVEL_HEADER_MAPPED))
+		{
 			throw std::invalid_argument("Level file header is not valid! Must be TEN. Probably old level version?");
+		}
+
+		isSectioned = (header[3] == LEVEL_HEADER_SECTIONED || header[3] == LEVEL_HEADER_MAPPED);
 		
 		TENLog("Level compiler version: " + std::to_string(version[0]) + "." + std::to_string(version[1]) + "." + std::to_string(version[2]), LogLevel::Info);
 
@@ -1226,59 +1309,108 @@ bool LoadLevel(int levelIndex)
 			SystemNameHash = 0;
 		}
 
-		// Read data sizes
-		ReadFileEx(&uncompressedSize, 1, 4, filePtr);
-		ReadFileEx(&compressedSize, 1, 4, filePtr);
+		if (header[3] == LEVEL_HEADER_MAPPED)
+		{
+			MapLevelSections(levelPath, sections);
+		}
+		else if (isSectioned)
+		{
+			ReadLevelSections(filePtr, sections);
+		}
+		else
+		{
+			int compressedSize;
+			int uncompressedSize;
+
+			// Read data sizes
+			ReadFileEx(&uncompressedSize, 1, 4, filePtr);
+			ReadFileEx(&compressedSize, 1, 4, filePtr);
 
-		// The entire level is ZLIB compressed
-		auto compressedBuffer = (char*)malloc(compressedSize);
-		dataPtr = (char*)malloc(uncompressedSize);
-		LevelDataPtr = dataPtr;
+			// The entire level is ZLIB compressed
+			auto compressedData = std::vector<char>(compressedSize);
+			ReadFileEx(compressedData.data(), compressedSize, 1, filePtr);
 
-		ReadFileEx(compressedBuffer, compressedSize, 1, filePtr);
-		Decompress((byte*)LevelDataPtr, (byte*)compressedBuffer, compressedSize, uncompressedSize);
+			legacyData = std::vector<char>(uncompressedSize);
+			if (!Decompress((byte*)legacyData.data(), (byte*)compressedData.data(), compressedSize, uncompressedSize))
+				throw std::runtime_error("Unable to decompress level data.");
 
-		// Now the entire level is decompressed, we can close it
-		free(compressedBuffer);
+			legacyCursor = LevelDataCursor(legacyData.data(), legacyData.size());
+		}
+
+		// Now all compressed data is in memory, we can close the file
 		FileClose(filePtr);
 		filePtr = nullptr;
 
-		LoadTextures();
+		// Parse sections in dependency order while the remaining ones are still being decompressed.
+		auto convertedSections = std::vector<LevelSectionRange>{};
+		auto convertedArrays = std::vector<LevelArrayRecord>{};
+		if (!isSectioned && LevelConversionFormat != '\0')
+			legacyCursor.SetArrayLog(&convertedArrays);
 
+		auto loadSection = [&](LevelSectionType type, void(*loader)(LevelDataCursor&))
+		{
+			if (!isSectioned)
+			{
+				// Legacy data is parsed in section order, so section boundaries are known for conversion.
+				size_t offset = legacyCursor.GetPosition();
+				loader(legacyCursor);
+				convertedSections.push_back(LevelSectionRange{ (int)type, offset, legacyCursor.GetPosition() - offset });
+				return;
+			}
+
+			// Empty section leaves nothing to parse.
+			auto& cursor = AcquireLevelSection(sections, type);
+			if (!cursor.IsEnd())
+				loader(cursor);
+
+			ReleaseLevelSection(sections, type);
+		};
+
+		loadSection(LevelSectionType::Textures, LoadTextures);
 		g_Renderer.UpdateProgress(20);
 
-		LoadRooms();
+		loadSection(LevelSectionType::Rooms, LoadRooms);
 		g_Renderer.UpdateProgress(40);
 
-		LoadObjects();
+		loadSection(LevelSectionType::Objects, LoadObjects);
 		g_Renderer.UpdateProgress(50);
 
-		LoadSprites();
-		LoadCameras();
-		LoadSoundSources();
+		loadSection(LevelSectionType::Sprites, LoadSprites);
+		loadSection(LevelSectionType::Cameras, LoadCameras);
+		loadSection(LevelSectionType::SoundSources, LoadSoundSources);
 		g_Renderer.UpdateProgress(60);
 
-		LoadBoxes();
+		loadSection(LevelSectionType::Boxes, LoadBoxes);
 
 		//InitializeLOTarray(true);
 
-		LoadAnimatedTextures();
+		loadSection(LevelSectionType::AnimatedTextures, LoadAnimatedTextures);
 		g_Renderer.UpdateProgress(70);
 
-		LoadItems();
-		LoadAIObjects();
+		loadSection(LevelSectionType::Items, LoadItems);
+		loadSection(LevelSectionType::AIObjects, LoadAIObjects);
 
-		LoadEventSets();
+		loadSection(LevelSectionType::EventSets, LoadEventSets);
 
-		LoadSamples();
+		loadSection(LevelSectionType::Samples, LoadSamples);
 		g_Renderer.UpdateProgress(80);
 
+		if (!isSectioned && LevelConversionFormat != '\0')
+			ConvertLevelFile(levelPath, header, version, systemHash, legacyData, convertedSections, convertedArrays);
+
+		// Decompressed level data is no longer needed.
+		legacyCursor = {};
+		legacyData = {};
+
 		TENLog("Initializing level...", LogLevel::Info);
 
 		// Initialize the game
 		InitializeGameFlags();
 		InitializeLara(!InitializeGame && CurrentLevel > 0);
 		InitializeNeighborRoomList();
+		g_BroadPhase.Initialize();
+		g_Raycast.Initialize();
+		g_Pathfinding.InvalidateCache();
 		GetCarriedItems();
 		GetAIPickups();
 		g_GameScriptEntities->AssignLara();
@@ -1303,31 +1435,34 @@ bool LoadLevel(int levelIndex)
 			filePtr = nullptr;
 		}
 
+		// Wait for pending workers so they don't outlive their buffers.
+		for (auto& section : sections)
+		{
+			if (section.Task.valid())
+				section.Task.wait();
+		}
+
 		TENLog("Error while loading level: " + std::string(ex.what()), LogLevel::Error);
 		LoadedSuccessfully = false;
 		SystemNameHash = 0;
 	}
 
-	if (dataPtr)
-	{
-		free(dataPtr);
-		dataPtr = LevelDataPtr = nullptr;
-	}
-
 	return LoadedSuccessfully;
 }
 
-void LoadSamples()
+void LoadSamples(LevelDataCursor& cursor)
 {
+	constexpr auto SAMPLE_BATCH_SIZE = 64;
+
 	TENLog("Loading samples... ", LogLevel::Info);
 
-	int soundMapSize = ReadInt16();
+	int soundMapSize = cursor.ReadInt16();
 	TENLog("Sound map size: " + std::to_string(soundMapSize), LogLevel::Info);
 
 	g_Level.SoundMap.resize(soundMapSize);
-	ReadBytes(g_Level.SoundMap.data(), soundMapSize * sizeof(short));
+	cursor.ReadBytes(g_Level.SoundMap.data(), soundMapSize * sizeof(short));
 
-	int numSampleInfos = ReadInt32();
+	int numSampleInfos = cursor.ReadInt32();
 	if (!numSampleInfos)
 	{
 		TENLog("No samples were found and loaded.", LogLevel::Warning);
@@ -1337,45 +1472,74 @@ void LoadSamples()
 	TENLog("Num sample infos: " + std::to_string(numSampleInfos), LogLevel::Info);
 
 	g_Level.SoundDetails.resize(numSampleInfos);
-	ReadBytes(g_Level.SoundDetails.data(), numSampleInfos * sizeof(SampleInfo));
+	cursor.ReadBytes(g_Level.SoundDetails.data(), numSampleInfos * sizeof(SampleInfo));
 
-	int numSamples = ReadInt32();
+	int numSamples = cursor.ReadInt32();
 	if (numSamples <= 0)
 		return;
 
 	TENLog("Num samples: " + std::to_string(numSamples), LogLevel::Info);
 
-	int uncompressedSize;
-	int compressedSize;
-	char* buffer = (char*)malloc(2 * 1024 * 1024);
-
+	// Compressed samples are decoded in place, since section data outlives decoding.
+	auto sampleDataPtrs = std::vector<const char*>(numSamples);
+	auto sampleDataSizes = std::vector<int>(numSamples);
 	for (int i = 0; i < numSamples; i++)
 	{
-		uncompressedSize = ReadInt32();
-		compressedSize = ReadInt32();
-		ReadBytes(buffer, compressedSize);
-		LoadSample(buffer, compressedSize, uncompressedSize, i);
+		cursor.ReadInt32(); // Uncompressed size. Unreliable, as data is converted to 32-bit float.
+		sampleDataSizes[i] = cursor.ReadInt32();
+		sampleDataPtrs[i] = cursor.GetPointer();
+		cursor.Skip(sampleDataSizes[i]);
+	}
+
+	auto startTime = std::chrono::high_resolution_clock::now();
+
+	// Decode batch on workers, then create its samples in order on loading thread and free decoded PCM data
+	// before next batch, so only one batch of decoded samples is held in memory at a time.
+	auto samples = std::vector<DecodedSample>(std::min(numSamples, SAMPLE_BATCH_SIZE));
+	auto isDecoded = std::vector<char>(samples.size()); // Not std::vector<bool>, since workers write concurrently.
+
+	int numCachedSamples = 0;
+	for (int batchStart = 0; batchStart < numSamples; batchStart += SAMPLE_BATCH_SIZE)
+	{
+		int batchSize = std::min(SAMPLE_BATCH_SIZE, numSamples - batchStart);
+		g_Jobs.ParallelFor(batchSize, [&](int i)
+		{
+			int sampleIndex = batchStart + i;
+			isDecoded[i] = DecodeSample(sampleDataPtrs[sampleIndex], sampleDataSizes[sampleIndex], sampleIndex, samples[i]);
+		});
+
+		for (int i = 0; i < batchSize; i++)
+		{
+			if (isDecoded[i])
+			{
+				CreateSample(samples[i], batchStart + i);
+				numCachedSamples += samples[i].IsCached ? 1 : 0;
+			}
+
+			samples[i] = DecodedSample{};
+		}
 	}
 
-	free(buffer);
+	auto time = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - startTime).count();
+	TENLog("Samples loaded in " + std::to_string((int)time) + " ms (" + std::to_string(numCachedSamples) + " from cache).", LogLevel::Info);
 }
 
-void LoadBoxes()
+void LoadBoxes(LevelDataCursor& cursor)
 {
 	// Read boxes
-	int numBoxes = ReadInt32();
+	int numBoxes = cursor.ReadInt32();
 	TENLog("Num boxes: " + std::to_string(numBoxes), LogLevel::Info);
 	g_Level.Boxes.resize(numBoxes);
-	ReadBytes(g_Level.Boxes.data(), numBoxes * sizeof(BOX_INFO));
+	cursor.ReadBytes(g_Level.Boxes.data(), numBoxes * sizeof(BOX_INFO));
 
 	// Read overlaps
-	int numOverlaps = ReadInt32();
+	int numOverlaps = cursor.ReadInt32();
 	TENLog("Num overlaps: " + std::to_string(numOverlaps), LogLevel::Info);
 	g_Level.Overlaps.resize(numOverlaps);
-	ReadBytes(g_Level.Overlaps.data(), numOverlaps * sizeof(OVERLAP));
+	cursor.ReadBytes(g_Level.Overlaps.data(), numOverlaps * sizeof(OVERLAP));
 
 	// Read zones
-	int numZoneGroups = ReadInt32();
+	int numZoneGroups = cursor.ReadInt32();
 	TENLog("Num zone groups: " + std::to_string(numZoneGroups), LogLevel::Info);
 
 	for (int i = 0; i < 2; i++)
@@ -1387,12 +1551,12 @@ void LoadBoxes()
 				int excessiveZoneGroups = numZoneGroups - j + 1;
 				TENLog("Level file contains extra pathfinding data, number of excessive zone groups is " + 
 					std::to_string(excessiveZoneGroups) + ". These zone groups will be ignored.", LogLevel::Warning);
-				LevelDataPtr += numBoxes * sizeof(int);
+				cursor.Skip(numBoxes * sizeof(int));
 			}
 			else
 			{
 				g_Level.Zones[j][i].resize(numBoxes);
-				ReadBytes(g_Level.Zones[j][i].data(), numBoxes * sizeof(int));
+				cursor.ReadBytes(g_Level.Zones[j][i].data(), numBoxes * sizeof(int));
 			}
 		}
 	}
@@ -1418,9 +1582,9 @@ bool LoadLevelFile(int levelIndex)
 	return LevelLoadTask.get();
 }
 
-void LoadSprites()
+void LoadSprites(LevelDataCursor& cursor)
 {
-	int numSprites = ReadInt32();
+	int numSprites = cursor.ReadInt32();
 	g_Level.Sprites.resize(numSprites);
 
 	TENLog("Num sprites: " + std::to_string(numSprites), LogLevel::Info);
@@ -1428,26 +1592,26 @@ void LoadSprites()
 	for (int i = 0; i < numSprites; i++)
 	{
 		auto* spr = &g_Level.Sprites[i];
-		spr->tile = ReadInt32();
-		spr->x1 = ReadFloat();
-		spr->y1 = ReadFloat();
-		spr->x2 = ReadFloat();
-		spr->y2 = ReadFloat();
-		spr->x3 = ReadFloat();
-		spr->y3 = ReadFloat();
-		spr->x4 = ReadFloat();
-		spr->y4 = ReadFloat();
+		spr->tile = cursor.ReadInt32();
+		spr->x1 = cursor.ReadFloat();
+		spr->y1 = cursor.ReadFloat();
+		spr->x2 = cursor.ReadFloat();
+		spr->y2 = cursor.ReadFloat();
+		spr->x3 = cursor.ReadFloat();
+		spr->y3 = cursor.ReadFloat();
+		spr->x4 = cursor.ReadFloat();
+		spr->y4 = cursor.ReadFloat();
 	}
 
-	int numSequences = ReadInt32();
+	int numSequences = cursor.ReadInt32();
 
 	TENLog("Num sprite sequences: " + std::to_string(numSequences), LogLevel::Info);
 
 	for (int i = 0; i < numSequences; i++)
 	{
-		int spriteID = ReadInt32();
-		short negLength = ReadInt16();
-		short offset = ReadInt16();
+		int spriteID = cursor.ReadInt32();
+		short negLength = cursor.ReadInt16();
+		short offset = cursor.ReadInt16();
 		if (spriteID >= ID_NUMBER_OBJECTS)
 			StaticObjects[spriteID - ID_NUMBER_OBJECTS].meshNumber = offset;
 		else
@@ -1528,51 +1692,20 @@ void GetAIPickups()
 	}
 }
 
-void BuildOutsideRoomsTable()
-{
-	for (int x = 0; x < OUTSIDE_SIZE; x++)
-	{
-		for (int z = 0; z < OUTSIDE_SIZE; z++)
-			OutsideRoomTable[x][z].clear();
-	}
-
-	for (int i = 0; i < g_Level.Rooms.size(); i++)
-	{
-		auto* room = &g_Level.Rooms[i];
-
-		int rx = (room->x / BLOCK(1));
-		int rz = (room->z / BLOCK(1));
-
-		for (int x = 0; x < OUTSIDE_SIZE; x++)
-		{
-			if (x < (rx + 1) || x > (rx + room->xSize - 2))
-				continue;
-
-			for (int z = 0; z < OUTSIDE_SIZE; z++)
-			{
-				if (z < (rz + 1) || z > (rz + room->zSize - 2))
-					continue;
-
-				OutsideRoomTable[x][z].push_back(i);
-			}
-		}
-	}
-}
-
-void LoadPortal(ROOM_INFO& room) 
+void LoadPortal(LevelDataCursor& cursor, ROOM_INFO& room) 
 {
 	ROOM_DOOR door;
 
-	door.room = ReadInt16();
-	door.normal.x = ReadInt32();
-	door.normal.y = ReadInt32();
-	door.normal.z = ReadInt32();
+	door.room = cursor.ReadInt16();
+	door.normal.x = cursor.ReadInt32();
+	door.normal.y = cursor.ReadInt32();
+	door.normal.z = cursor.ReadInt32();
 
 	for (int k = 0; k < 4; k++)
 	{
-		door.vertices[k].x = ReadInt32();
-		door.vertices[k].y = ReadInt32();
-		door.vertices[k].z = ReadInt32();
+		door.vertices[k].x = cursor.ReadInt32();
+		door.vertices[k].y = cursor.ReadInt32();
+		door.vertices[k].z = cursor.ReadInt32();
 	}
 
 	room.doors.push_back(door);
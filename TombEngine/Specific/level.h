@@ -8,6 +8,8 @@
 #include "Specific/IO/ChunkId.h"
 #include "Specific/IO/ChunkReader.h"
 #include "Specific/IO/LEB128.h"
+#include "Specific/IO/LevelDataCursor.h"
+#include "Specific/IO/MappedFile.h"
 #include "Specific/IO/Streams.h"
 #include "Specific/LevelCameraInfo.h"
 #include "Specific/newtypes.h"
@@ -21,12 +23,58 @@ struct SinkInfo;
 struct BOX_INFO;
 struct OVERLAP;
 
+// Fourth header byte of level files built as independently compressed sections.
+constexpr auto LEVEL_HEADER_SECTIONED = 'S';
+// Fourth header byte of uncompressed level files with page-aligned sections which are memory-mapped.
+// Arrays within mapped sections are padded to alignment of their elements.
+constexpr auto LEVEL_HEADER_MAPPED	  = 'M';
+
+enum class LevelSectionType
+{
+	Textures,
+	Rooms,
+	Objects,
+	Sprites,
+	Cameras,
+	SoundSources,
+	Boxes,
+	AnimatedTextures,
+	Items,
+	AIObjects,
+	EventSets,
+	Samples,
+
+	Count
+};
+
+struct LevelSectionHeader
+{
+	int Type			 = 0;
+	int UncompressedSize = 0;
+	int CompressedSize	 = 0; // 0 = stored uncompressed.
+};
+
+struct LevelMappedSectionHeader
+{
+	int		  Type	 = 0;
+	int		  Size	 = 0;
+	long long Offset = 0; // Page-aligned offset from file start.
+};
+
+struct LevelSection
+{
+	bool						   IsPresent = false;
+	std::vector<char>			   Data		 = {};
+	std::future<std::vector<char>> Task		 = {};
+	LevelDataCursor				   Cursor	 = {};
+};
+
 struct TEXTURE
 {
 	int width;
 	int height;
-	std::vector<byte> colorMapData;
-	std::vector<byte> normalMapData;
+	MappableVector<byte> colorMapData;
+	MappableVector<byte> normalMapData;
 };
 
 struct ANIMATED_TEXTURES_FRAME
@@ -77,11 +125,11 @@ struct MESH
 {
 	LightMode lightMode;
 	BoundingSphere sphere;
-	std::vector<Vector3> positions;
+	MappableVector<Vector3> positions;
 	std::vector<Vector3> normals;
-	std::vector<Vector3> colors;
-	std::vector<Vector3> effects; // X = glow, Y = move, Z = refract
-	std::vector<int> bones;
+	MappableVector<Vector3> colors;
+	MappableVector<Vector3> effects; // X = glow, Y = move, Z = refract
+	MappableVector<int> bones;
 	std::vector<BUCKET> buckets;
 };
 
@@ -95,11 +143,14 @@ struct LEVEL
 	std::vector<int>	  Bones	   = {};
 
 	// Animation data
-	std::vector<AnimData>				Anims	 = {};
-	std::vector<AnimFrame>				Frames	 = {};
-	std::vector<StateDispatchData>		Changes	 = {};
-	std::vector<StateDispatchRangeData> Ranges	 = {};
-	std::vector<short>					Commands = {};
+	std::vector<AnimData>					Anims					= {};
+	std::vector<AnimFrame>					Frames					= {};
+	std::vector<PackedQuaternion>			FrameOrientations		= {};	// Bone orientations of all frames in one buffer.
+	std::vector<std::vector<Quaternion>>	SourceFrameOrientations = {};	// Unquantized orientations in per-frame layout. Kept only for headless benchmark.
+	float									FrameOrientationError	= 0.0f; // Max angular quantization error of bone orientations in radians.
+	std::vector<StateDispatchData>			Changes					= {};
+	std::vector<StateDispatchRangeData>		Ranges					= {};
+	std::vector<short>						Commands				= {};
 
 	// Collision data
 	std::vector<ROOM_INFO> Rooms	 = {};
@@ -132,6 +183,9 @@ struct LEVEL
 	std::vector<TEXTURE> AnimatedTextures  = {};
 	std::vector<TEXTURE> SpritesTextures   = {};
 	std::vector<ANIMATED_TEXTURES_SEQUENCE> AnimatedTexturesSequences = {};
+
+	// Mapped level file which texture and vertex data views point into. Must outlive them.
+	MappedFile MappedData = {};
 };
 
 extern const std::vector<GAME_OBJECT_ID> BRIDGE_OBJECT_IDS;
@@ -141,6 +195,9 @@ extern std::vector<int> StaticObjectsIds;
 extern std::vector<int> SpriteSequencesIds;
 extern LEVEL g_Level;
 
+// Header byte of format which loaded legacy levels are converted to, or 0 for no conversion.
+extern char LevelConversionFormat;
+
 inline std::future<bool> LevelLoadTask;
 
 size_t ReadFileEx(void* ptr, size_t size, size_t count, FILE* stream);
@@ -151,21 +208,20 @@ bool Decompress(byte* dest, byte* src, unsigned long compressedSize, unsigned lo
 bool LoadLevelFile(int levelIndex);
 void FreeLevel();
 
-void LoadTextures();
-void LoadRooms();
-void LoadItems();
-void LoadObjects();
-void LoadCameras();
-void LoadSprites();
-void LoadBoxes();
-void LoadSamples();
-void LoadSoundSources();
-void LoadAnimatedTextures();
-void LoadEventSets();
-void LoadAIObjects();
-
-void LoadPortal(ROOM_INFO& room);
+void LoadTextures(LevelDataCursor& cursor);
+void LoadRooms(LevelDataCursor& cursor);
+void LoadItems(LevelDataCursor& cursor);
+void LoadObjects(LevelDataCursor& cursor);
+void LoadCameras(LevelDataCursor& cursor);
+void LoadSprites(LevelDataCursor& cursor);
+void LoadBoxes(LevelDataCursor& cursor);
+void LoadSamples(LevelDataCursor& cursor);
+void LoadSoundSources(LevelDataCursor& cursor);
+void LoadAnimatedTextures(LevelDataCursor& cursor);
+void LoadEventSets(LevelDataCursor& cursor);
+void LoadAIObjects(LevelDataCursor& cursor);
+
+void LoadPortal(LevelDataCursor& cursor, ROOM_INFO& room);
 
 void GetCarriedItems();
 void GetAIPickups();
-void BuildOutsideRoomsTable();
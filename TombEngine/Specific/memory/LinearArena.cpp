@@ -0,0 +1,76 @@
+#include "framework.h"
+#include "Specific/memory/LinearArena.h"
+
+namespace TEN::Memory
+{
+	size_t LinearArena::GetCapacity() const
+	{
+		size_t capacity = 0;
+		for (const auto& block : _blocks)
+			capacity += block.Size;
+
+		return capacity;
+	}
+
+	size_t LinearArena::GetUsedSize() const
+	{
+		return _usedSize;
+	}
+
+	int LinearArena::GetHeapAllocationCount() const
+	{
+		return _heapAllocCount;
+	}
+
+	void* LinearArena::Allocate(size_t size, size_t alignment)
+	{
+		while (true)
+		{
+			if (_blockIndex < _blocks.size())
+			{
+				auto& block = _blocks[_blockIndex];
+
+				auto base = (uintptr_t)block.Data.get();
+				auto address = (base + _offset + (alignment - 1)) & ~(uintptr_t)(alignment - 1);
+				size_t end = (address - base) + size;
+
+				if (end <= block.Size)
+				{
+					_offset = end;
+					_usedSize += size;
+					return (void*)address;
+				}
+
+				// Block is full; continue in next one.
+				_blockIndex++;
+				_offset = 0;
+				continue;
+			}
+
+			// Out of blocks; grow geometrically.
+			size_t blockSize = std::max<size_t>(BLOCK_SIZE_DEFAULT, size + alignment);
+			if (!_blocks.empty())
+				blockSize = std::max(blockSize, _blocks.back().Size * 2);
+
+			_blocks.push_back(Block{ std::make_unique<std::byte[]>(blockSize), blockSize });
+			_heapAllocCount++;
+		}
+	}
+
+	void LinearArena::Reset()
+	{
+		// Frame needed more than one block. Merge them, so same frame fits into single block next time.
+		if (_blocks.size() > 1)
+		{
+			size_t capacity = GetCapacity();
+
+			_blocks.clear();
+			_blocks.push_back(Block{ std::make_unique<std::byte[]>(capacity), capacity });
+		}
+
+		_blockIndex = 0;
+		_offset = 0;
+		_usedSize = 0;
+		_heapAllocCount = 0;
+	}
+}
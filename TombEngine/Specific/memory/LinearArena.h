@@ -0,0 +1,94 @@
+#pragma once
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace TEN::Memory
+{
+	// Linear allocator for per-frame scratch data. Allocations bump offset into current block and are never freed
+	// individually; Reset() releases everything at once. If frame spilled into more blocks, Reset() merges them into
+	// one block of combined size, so frames of steady size make no heap allocations.
+	// NOTE: Containers using arena must be destroyed or reassigned before Reset(), as debug containers keep
+	// bookkeeping data in their allocator's memory.
+	class LinearArena
+	{
+	private:
+		// Constants
+		static constexpr auto BLOCK_SIZE_DEFAULT = 64 * 1024;
+
+		struct Block
+		{
+			std::unique_ptr<std::byte[]> Data = nullptr;
+			size_t						 Size = 0;
+		};
+
+		// Members
+		std::vector<Block> _blocks		   = {};
+		size_t			   _blockIndex	   = 0;
+		size_t			   _offset		   = 0;
+		size_t			   _usedSize	   = 0; // Bytes allocated since reset.
+		int				   _heapAllocCount = 0; // Blocks allocated from heap since reset.
+
+	public:
+		// Constructors
+		LinearArena() = default;
+		LinearArena(const LinearArena& other) = delete;
+
+		// Getters
+		size_t GetCapacity() const;
+		size_t GetUsedSize() const;
+		int	   GetHeapAllocationCount() const;
+
+		// Utilities
+		void* Allocate(size_t size, size_t alignment);
+		void  Reset();
+	};
+
+	// Standard allocator adapter for containers backed by linear arena. Default-constructed allocator uses heap.
+	template <typename T>
+	class LinearArenaAllocator
+	{
+	public:
+		using value_type							 = T;
+		using propagate_on_container_copy_assignment = std::true_type;
+		using propagate_on_container_move_assignment = std::true_type;
+		using propagate_on_container_swap			 = std::true_type;
+
+		// Members
+		LinearArena* Arena = nullptr;
+
+		// Constructors
+		LinearArenaAllocator() = default;
+		LinearArenaAllocator(LinearArena& arena) : Arena(&arena) {}
+		LinearArenaAllocator(LinearArena* arena) : Arena(arena) {}
+
+		template <typename U>
+		LinearArenaAllocator(const LinearArenaAllocator<U>& other) : Arena(other.Arena) {}
+
+		// Utilities
+		T* allocate(size_t count)
+		{
+			if (Arena == nullptr)
+				return static_cast<T*>(::operator new(count * sizeof(T)));
+
+			return static_cast<T*>(Arena->Allocate(count * sizeof(T), alignof(T)));
+		}
+
+		void deallocate(T* ptr, size_t count)
+		{
+			// Arena memory is released all at once on reset.
+			if (Arena == nullptr)
+				::operator delete(ptr);
+		}
+
+		// Operators
+		template <typename U>
+		bool operator ==(const LinearArenaAllocator<U>& other) const { return (Arena == other.Arena); }
+
+		template <typename U>
+		bool operator !=(const LinearArenaAllocator<U>& other) const { return (Arena != other.Arena); }
+	};
+
+	template <typename T>
+	using ArenaVector = std::vector<T, LinearArenaAllocator<T>>;
+}
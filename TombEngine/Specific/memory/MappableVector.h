@@ -0,0 +1,86 @@
+#pragma once
+#include <vector>
+
+namespace TEN::Memory
+{
+	// Read-only vector-like container which either owns its elements
+	// or views external memory (e.g. memory-mapped level data) without copying.
+	template <typename T>
+	class MappableVector
+	{
+	private:
+		// Members
+		std::vector<T> _storage = {};
+		const T*	   _view	= nullptr;
+		size_t		   _size	= 0;
+
+	public:
+		// Constructors
+		MappableVector() = default;
+
+		MappableVector(const MappableVector& other)
+		{
+			*this = other;
+		}
+
+		MappableVector(MappableVector&& other) noexcept
+		{
+			*this = std::move(other);
+		}
+
+		// Getters
+		const T* data() const	{ return (_view != nullptr) ? _view : _storage.data(); }
+		size_t	 size() const	{ return (_view != nullptr) ? _size : _storage.size(); }
+		bool	 empty() const	{ return (size() == 0); }
+		bool	 IsView() const { return (_view != nullptr); }
+
+		const T* begin() const { return data(); }
+		const T* end() const   { return (data() + size()); }
+
+		const T& operator [](size_t index) const { return data()[index]; }
+
+		// Setters
+		void SetView(const T* data, size_t size)
+		{
+			_storage.clear();
+			_storage.shrink_to_fit();
+			_view = data;
+			_size = size;
+		}
+
+		void Assign(const T* data, size_t size)
+		{
+			_view = nullptr;
+			_size = 0;
+			_storage.assign(data, data + size);
+		}
+
+		// Utilities
+		void clear()
+		{
+			_storage.clear();
+			_view = nullptr;
+			_size = 0;
+		}
+
+		// Operators
+		MappableVector& operator =(const MappableVector& other)
+		{
+			_storage = other._storage;
+			_view = other._view;
+			_size = other._size;
+			return *this;
+		}
+
+		MappableVector& operator =(MappableVector&& other) noexcept
+		{
+			_storage = std::move(other._storage);
+			_view = other._view;
+			_size = other._size;
+
+			other._view = nullptr;
+			other._size = 0;
+			return *this;
+		}
+	};
+}
@@ -8,19 +8,31 @@
 #include <codecvt>
 #include <filesystem>
 
+#include "Game/collision/BroadPhase.h"
+#include "Game/collision/CollisionCache.h"
+#include "Game/collision/Raycast.h"
 #include "Game/control/control.h"
+#include "Game/control/Pathfinding.h"
 #include "Game/savegame.h"
 #include "Renderer/Renderer.h"
 #include "Sound/sound.h"
+#include "Specific/Benchmark.h"
 #include "Specific/level.h"
 #include "Specific/configuration.h"
+#include "Specific/JobSystem.h"
 #include "Specific/trutils.h"
 #include "Scripting/Internal/LanguageScript.h"
 #include "Scripting/Include/ScriptInterfaceState.h"
 #include "Scripting/Include/ScriptInterfaceLevel.h"
 
+using namespace TEN::Benchmark;
+using namespace TEN::Collision::BroadPhase;
+using namespace TEN::Collision::CollisionCache;
+using namespace TEN::Collision::Raycast;
+using namespace TEN::Control::Pathfinding;
 using namespace TEN::Renderer;
 using namespace TEN::Input;
+using namespace TEN::Jobs;
 using namespace TEN::Utils;
 
 using std::exception;
@@ -197,7 +209,7 @@ LRESULT CALLBACK WinAppProc(HWND hWnd, UINT msg, WPARAM wParam, LPARAM lParam)
 			if (!g_Configuration.EnableWindowedMode)
 				g_Renderer.ToggleFullScreen(true);
 
-			if (!DebugMode && ThreadHandle > 0)
+			if (!DebugMode && !g_Benchmark.IsHeadless() && ThreadHandle > 0)
 			{
 				TENLog("Resuming game thread", LogLevel::Info);
 				ResumeThread((HANDLE)ThreadHandle);
@@ -212,7 +224,7 @@ LRESULT CALLBACK WinAppProc(HWND hWnd, UINT msg, WPARAM wParam, LPARAM lParam)
 		if (!g_Configuration.EnableWindowedMode)
 			ShowWindow(hWnd, SW_MINIMIZE);
 
-		if (!DebugMode)
+		if (!DebugMode && !g_Benchmark.IsHeadless())
 		{
 			TENLog("Suspending game thread", LogLevel::Info);
 			SuspendThread((HANDLE)ThreadHandle);
@@ -237,6 +249,8 @@ int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPSTR lpCmdLine
 	int argc;
 	argv = CommandLineToArgvW(GetCommandLineW(), &argc);
 	std::string gameDir{};
+	auto benchmarkSettings = BenchmarkSettings{};
+	int jobWorkerCount = NO_VALUE;
 
 	// Parse command line arguments.
 	for (int i = 1; i < argc; i++)
@@ -261,15 +275,88 @@ int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPSTR lpCmdLine
 		{
 			gameDir = TEN::Utils::ToString(argv[i + 1]);
 		}
+		else if (ArgEquals(argv[i], "benchmark") && argc > (i + 1))
+		{
+			benchmarkSettings.IsHeadless = true;
+			benchmarkSettings.FrameCount = std::stoi(std::wstring(argv[i + 1]));
+		}
+		else if (ArgEquals(argv[i], "playback") && argc > (i + 1))
+		{
+			benchmarkSettings.PlaybackPath = TEN::Utils::ToString(argv[i + 1]);
+		}
+		else if (ArgEquals(argv[i], "record") && argc > (i + 1))
+		{
+			benchmarkSettings.RecordPath = TEN::Utils::ToString(argv[i + 1]);
+		}
+		else if (ArgEquals(argv[i], "report") && argc > (i + 1))
+		{
+			benchmarkSettings.ReportPath = TEN::Utils::ToString(argv[i + 1]);
+		}
+		else if (ArgEquals(argv[i], "callbackbenchmark") && argc > (i + 1))
+		{
+			benchmarkSettings.CallbackCount = std::stoi(std::wstring(argv[i + 1]));
+		}
+		else if (ArgEquals(argv[i], "microbenchmark") && argc > (i + 1))
+		{
+			// Runs named micro-benchmark (or all of them) instead of game.
+			benchmarkSettings.MicroBenchmark = TEN::Utils::ToString(argv[i + 1]);
+		}
+		else if (ArgEquals(argv[i], "sortdump") && argc > (i + 1))
+		{
+			// Game run records sorted face keys to this file; sorting benchmark replays them.
+			benchmarkSettings.SortDumpPath = TEN::Utils::ToString(argv[i + 1]);
+		}
+		else if (ArgEquals(argv[i], "losbenchmark"))
+		{
+			// Records LOS queries of headless benchmark run and replays them with legacy and sector raycaster.
+			benchmarkSettings.IsLosBenchmark = true;
+		}
+		else if (ArgEquals(argv[i], "jobcheck"))
+		{
+			// Repeats headless benchmark run with all jobs on game thread and compares state hashes.
+			benchmarkSettings.IsJobCheck = true;
+		}
+		else if (ArgEquals(argv[i], "seed") && argc > (i + 1))
+		{
+			benchmarkSettings.Seed = std::stoul(std::wstring(argv[i + 1]));
+		}
+		else if (ArgEquals(argv[i], "legacycollision"))
+		{
+			// Used to compare broad-phase grid, probe cache and sector raycaster against legacy full scans.
+			g_BroadPhase.SetEnabled(false);
+			g_CollisionCache.SetEnabled(false);
+			g_Raycast.SetEnabled(false);
+		}
+		else if (ArgEquals(argv[i], "legacypathfinding"))
+		{
+			// Used to compare AI behaviour and cost of A* search against legacy search.
+			g_Pathfinding.SetMode(PathfindingMode::Legacy);
+		}
+		else if (ArgEquals(argv[i], "jobs") && argc > (i + 1))
+		{
+			// Used to compare serial and parallel runs. Zero runs all jobs on game thread.
+			jobWorkerCount = std::stoi(std::wstring(argv[i + 1]));
+		}
+		else if (ArgEquals(argv[i], "convertlevels") && argc > (i + 1))
+		{
+			// Writes every loaded legacy level next to original in sectioned or mapped format, used to build test levels.
+			auto format = TEN::Utils::ToString(argv[i + 1]);
+			LevelConversionFormat = (format == "mapped") ? LEVEL_HEADER_MAPPED : LEVEL_HEADER_SECTIONED;
+		}
+		else if (ArgEquals(argv[i], "samplecache"))
+		{
+			// Keeps decoded samples on disk, so repeated loads of same level skip decoding.
+			Sound_SetSampleCacheEnabled(true);
+		}
 	}
 	LocalFree(argv);
 
 	// Construct asset directory.
 	gameDir = ConstructAssetDirectory(gameDir);
 
-	// Hide console window if mode isn't debug.
+	// Hide console window if mode isn't debug or headless benchmark.
 #ifndef _DEBUG
-	if (!DebugMode)
+	if (!DebugMode && !benchmarkSettings.IsHeadless && benchmarkSettings.MicroBenchmark.empty())
 		ShowWindow(GetConsoleWindow(), 0);
 #endif
 
@@ -293,6 +380,21 @@ int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPSTR lpCmdLine
 					   );
 	TENLog(windowName, LogLevel::Info);
 
+	// Micro-benchmarks need no window or level, so quit right after them.
+	if (!benchmarkSettings.MicroBenchmark.empty())
+	{
+		bool isSuccess = RunMicroBenchmark(benchmarkSettings);
+
+		ShutdownTENLog();
+		return (isSuccess ? 0 : 1);
+	}
+
+	// Initialize benchmark controller (input recording, headless mode).
+	g_Benchmark.Initialize(benchmarkSettings);
+
+	// Initialize job system worker threads.
+	g_Jobs.Initialize(jobWorkerCount);
+
 	// Initialize savegame and scripting systems.
 	SaveGame::Init(gameDir);
 	ScriptInterfaceState::Init(gameDir);
@@ -358,11 +460,20 @@ int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPSTR lpCmdLine
 	}
 
 	// Create renderer and enumerate adapters and video modes.
-	g_Renderer.Create();
+	// Headless mode uses software rasterizer so that no GPU is required.
+	g_Renderer.Create(g_Benchmark.IsHeadless());
 
 	// Load configuration and optionally show setup dialog.
 	InitDefaultConfiguration();
-	if (setup || !LoadConfiguration())
+	if (g_Benchmark.IsHeadless())
+	{
+		LoadConfiguration();
+
+		// Headless mode never outputs audio or takes exclusive screen.
+		g_Configuration.EnableSound = false;
+		g_Configuration.EnableWindowedMode = true;
+	}
+	else if (setup || !LoadConfiguration())
 	{
 		if (!SetupDialog())
 		{
@@ -436,11 +547,15 @@ int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPSTR lpCmdLine
 		App.bNoFocus = false;
 		App.isInScene = false;
 
-		UpdateWindow(WindowsHandle);
-		ShowWindow(WindowsHandle, nShowCmd);
+		if (!g_Benchmark.IsHeadless())
+		{
+			UpdateWindow(WindowsHandle);
+			ShowWindow(WindowsHandle, nShowCmd);
+
+			SetCursor(NULL);
+			ShowCursor(FALSE);
+		}
 
-		SetCursor(NULL);
-		ShowCursor(FALSE);
 		hAccTable = LoadAccelerators(hInstance, (LPCSTR)0x65);
 	}
 	catch (std::exception& ex)
@@ -457,7 +572,7 @@ int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPSTR lpCmdLine
 
 	// The game window likes to steal input anyway, so let's put it at the
 	// foreground so the user at least expects it.
-	if (GetForegroundWindow() != WindowsHandle)
+	if (!g_Benchmark.IsHeadless() && GetForegroundWindow() != WindowsHandle)
 		SetForegroundWindow(WindowsHandle);
 
 	WinProcMsg();
@@ -477,6 +592,8 @@ void WinClose()
 
 	Sound_DeInit();
 	DeinitializeInput();
+	SaveGame::Deinit();
+	g_Jobs.Deinitialize();
 
 	TENLog("Cleaning up and exiting...", LogLevel::Info);
 	